@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief BenchmarkCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_BENCHMARKCASE_HPP_
+#define BENCHMARK_BENCHMARKCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief BenchmarkCase class is a base for all benchmarks.
+ *
+ * Benchmarks are executed at priority which is lower than the priority of helper threads, so that any operation which
+ * unblocks helper thread causes immediate context switch.
+ */
+
+class BenchmarkCase : public test::PrioritizedTestCase
+{
+public:
+
+	/// priority at which benchmarks are executed
+	constexpr static uint8_t benchmarkPriority {UINT8_MAX - 1};
+
+	/// priority of helper threads
+	constexpr static uint8_t helperThreadPriority {UINT8_MAX};
+
+	/// size of stack of helper threads, bytes
+	constexpr static size_t helperThreadStackSize {1024};
+
+	/// number of samples collected for each benchmark
+	constexpr static size_t iterations {CONFIG_BENCHMARK_APPLICATION_ITERATIONS};
+
+	/**
+	 * \brief BenchmarkCase's constructor
+	 */
+
+	constexpr BenchmarkCase() :
+			PrioritizedTestCase{benchmarkPriority}
+	{
+
+	}
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_BENCHMARKCASE_HPP_
@@ -0,0 +1,45 @@
+/**
+ * \file
+ * \brief CycleCounterBenchmark class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "CycleCounterBenchmark.hpp"
+
+#include "getCycles.hpp"
+#include "Measurement.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool CycleCounterBenchmark::run_() const
+{
+	Measurement measurement;
+	for (size_t iteration {}; iteration < iterations; ++iteration)
+	{
+		const auto start = getCycles();
+		const auto end = getCycles();
+		measurement.add(end - start);
+	}
+	measurement.write("getCycles");
+	// minimum is used, as other samples may include handling of "tick" interrupt
+	Measurement::setOverhead(measurement.getMinimum());
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
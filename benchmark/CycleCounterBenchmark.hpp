@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief CycleCounterBenchmark class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_CYCLECOUNTERBENCHMARK_HPP_
+#define BENCHMARK_CYCLECOUNTERBENCHMARK_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures overhead of getCycles().
+ *
+ * The result is the number of cycles between two consecutive calls to getCycles(), which is included in results of all
+ * other benchmarks. Its minimum is used as overhead which is subtracted from samples of all other benchmarks, so this
+ * benchmark must be executed first.
+ */
+
+class CycleCounterBenchmark : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_CYCLECOUNTERBENCHMARK_HPP_
@@ -0,0 +1,127 @@
+/**
+ * \file
+ * \brief FifoQueueBenchmark class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "FifoQueueBenchmark.hpp"
+
+#include "getCycles.hpp"
+#include "Measurement.hpp"
+
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of queue used in benchmarks
+using Queue = StaticFifoQueue<uint32_t, 1>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures the pair of FifoQueue::push() and FifoQueue::pop() calls executed by benchmark thread.
+ *
+ * \return true if benchmark succeeded, false otherwise
+ */
+
+bool pushPop()
+{
+	Queue queue;
+	Measurement measurement;
+	for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+	{
+		uint32_t value {};
+		const auto start = getCycles();
+		const auto pushRet = queue.push(value);
+		const auto popRet = queue.pop(value);
+		const auto end = getCycles();
+		if (pushRet != 0 || popRet != 0)
+			return false;
+		measurement.add(end - start);
+	}
+
+	measurement.write("fifoQueue-push-pop");
+	return true;
+}
+
+/**
+ * \brief Measures round trip in which benchmark thread pushes an element to one queue and helper thread pops it and
+ * pushes it to another queue.
+ *
+ * \return true if benchmark succeeded, false otherwise
+ */
+
+bool roundTrip()
+{
+	Queue requestQueue;
+	Queue responseQueue;
+	auto helperThread = makeAndStartStaticThread<BenchmarkCase::helperThreadStackSize>(
+			BenchmarkCase::helperThreadPriority,
+			[&requestQueue, &responseQueue]()
+			{
+				for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+				{
+					uint32_t value {};
+					requestQueue.pop(value);
+					responseQueue.push(value);
+				}
+			});
+
+	Measurement measurement;
+	bool result {true};
+	for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+	{
+		const auto sentValue = static_cast<uint32_t>(iteration);
+		auto value = sentValue;
+		const auto start = getCycles();
+		// helper thread preempts this thread, pushes the element back and blocks again, so it can be popped immediately
+		if (requestQueue.push(value) != 0 || responseQueue.tryPop(value) != 0)
+			result = false;
+		const auto end = getCycles();
+		if (value != sentValue)
+			result = false;
+		measurement.add(end - start);
+	}
+
+	helperThread.join();
+	measurement.write("fifoQueue-round-trip");
+	return result;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool FifoQueueBenchmark::run_() const
+{
+	for (const auto& function : {pushPop, roundTrip})
+		if (function() == false)
+			return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief FifoQueueBenchmark class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_FIFOQUEUEBENCHMARK_HPP_
+#define BENCHMARK_FIFOQUEUEBENCHMARK_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures FifoQueue operations.
+ *
+ * Measures the pair of FifoQueue::push() and FifoQueue::pop() calls executed by benchmark thread and the time of a
+ * round trip, in which benchmark thread pushes an element to one queue, higher priority helper thread pops it and
+ * pushes it to another queue, from which it is popped by benchmark thread.
+ */
+
+class FifoQueueBenchmark : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_FIFOQUEUEBENCHMARK_HPP_
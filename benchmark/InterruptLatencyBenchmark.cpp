@@ -0,0 +1,59 @@
+/**
+ * \file
+ * \brief InterruptLatencyBenchmark class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "InterruptLatencyBenchmark.hpp"
+
+#include "getCycles.hpp"
+#include "Measurement.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool InterruptLatencyBenchmark::run_() const
+{
+	Semaphore semaphore {0};
+	uint32_t postCycles {};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&semaphore, &postCycles]()
+			{
+				postCycles = getCycles();
+				semaphore.post();
+			});
+
+	Measurement measurement;
+	for (size_t iteration {}; iteration < iterations; ++iteration)
+	{
+		if (softwareTimer.start(TickClock::duration{1}) != 0)
+			return false;
+		const auto waitRet = semaphore.wait();
+		const auto end = getCycles();
+		if (waitRet != 0)
+			return false;
+		measurement.add(end - postCycles);
+	}
+
+	measurement.write("interrupt-post-to-thread");
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
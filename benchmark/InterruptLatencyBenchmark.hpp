@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief InterruptLatencyBenchmark class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_INTERRUPTLATENCYBENCHMARK_HPP_
+#define BENCHMARK_INTERRUPTLATENCYBENCHMARK_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency from interrupt to thread.
+ *
+ * Measures time from the call to Semaphore::post() in software timer's function (executed from system tick interrupt)
+ * to the moment in which benchmark thread - blocked in Semaphore::wait() - starts running.
+ */
+
+class InterruptLatencyBenchmark : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_INTERRUPTLATENCYBENCHMARK_HPP_
@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief Measurement class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "Measurement.hpp"
+
+#include "output.hpp"
+
+#include <algorithm>
+
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private static member variables
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t Measurement::overhead_;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void Measurement::add(uint32_t cycles)
+{
+	cycles = cycles > overhead_ ? cycles - overhead_ : 0;
+	sum_ += cycles;
+	maximum_ = std::max(maximum_, cycles);
+	minimum_ = std::min(minimum_, cycles);
+	++samples_;
+}
+
+void Measurement::write(const char* const name) const
+{
+	// "long" is used, as not all variants of printf() support "long long"
+	const unsigned long average = samples_ != 0 ? sum_ / samples_ : 0;
+	const unsigned long minimum = samples_ != 0 ? minimum_ : 0;
+	char buffer[80];
+	snprintf(buffer, sizeof(buffer), "%s,%lu,%lu,%lu,%lu\n", name, static_cast<unsigned long>(samples_), minimum,
+			average, static_cast<unsigned long>(maximum_));
+	writeOutput(buffer);
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,107 @@
+/**
+ * \file
+ * \brief Measurement class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_MEASUREMENT_HPP_
+#define BENCHMARK_MEASUREMENT_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/// Measurement class collects samples of one benchmark and writes their summary to output
+class Measurement
+{
+public:
+
+	/**
+	 * \brief Measurement's constructor
+	 */
+
+	constexpr Measurement() :
+			sum_{},
+			maximum_{},
+			minimum_{UINT32_MAX},
+			samples_{}
+	{
+
+	}
+
+	/**
+	 * \brief Adds one sample.
+	 *
+	 * Overhead of getCycles() (set with setOverhead()) is subtracted from the sample.
+	 *
+	 * \param [in] cycles is the value of sample, core clock cycles
+	 */
+
+	void add(uint32_t cycles);
+
+	/**
+	 * \return minimum value of sample, UINT32_MAX if no samples were added
+	 */
+
+	uint32_t getMinimum() const
+	{
+		return minimum_;
+	}
+
+	/**
+	 * \brief Writes summary of collected samples to output.
+	 *
+	 * The summary is a single line of comma-separated values: \a name, number of samples, minimum, average and maximum
+	 * value of samples (in core clock cycles).
+	 *
+	 * \param [in] name is the name of benchmark, should not contain commas
+	 */
+
+	void write(const char* name) const;
+
+	/**
+	 * \brief Sets overhead of getCycles().
+	 *
+	 * This value - the cost of reading the time twice (with interrupts masked on ARM) - is included in every sample,
+	 * so it is subtracted from all samples added afterwards.
+	 *
+	 * \param [in] overhead is the overhead of getCycles(), core clock cycles
+	 */
+
+	static void setOverhead(const uint32_t overhead)
+	{
+		overhead_ = overhead;
+	}
+
+private:
+
+	/// overhead of getCycles() subtracted from each sample, core clock cycles
+	static uint32_t overhead_;
+
+	/// sum of all samples
+	uint64_t sum_;
+
+	/// maximum value of sample
+	uint32_t maximum_;
+
+	/// minimum value of sample
+	uint32_t minimum_;
+
+	/// number of samples
+	uint32_t samples_;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_MEASUREMENT_HPP_
@@ -0,0 +1,157 @@
+/**
+ * \file
+ * \brief MutexBenchmark class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MutexBenchmark.hpp"
+
+#include "getCycles.hpp"
+#include "Measurement.hpp"
+
+#include "distortos/Mutex.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// parameters of benchmark for single protocol
+struct Parameters
+{
+	/// tested protocol
+	Mutex::Protocol protocol;
+
+	/// name of benchmark of lock-unlock pair
+	const char* lockUnlockName;
+
+	/// name of benchmark of unlock with contention
+	const char* unlockToWaiterName;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// parameters of benchmarks for all protocols
+const Parameters parametersArray[]
+{
+		{Mutex::Protocol::none, "mutex-lock-unlock-none", "mutex-unlock-to-waiter-none"},
+		{Mutex::Protocol::priorityInheritance, "mutex-lock-unlock-priorityInheritance",
+				"mutex-unlock-to-waiter-priorityInheritance"},
+		{Mutex::Protocol::priorityProtect, "mutex-lock-unlock-priorityProtect",
+				"mutex-unlock-to-waiter-priorityProtect"},
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures the pair of Mutex::lock() and Mutex::unlock() calls without contention.
+ *
+ * \param [in] parameters is a reference to parameters of benchmark
+ *
+ * \return true if benchmark succeeded, false otherwise
+ */
+
+bool lockUnlock(const Parameters& parameters)
+{
+	Mutex mutex {parameters.protocol, BenchmarkCase::helperThreadPriority};
+	Measurement measurement;
+	for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+	{
+		const auto start = getCycles();
+		const auto lockRet = mutex.lock();
+		const auto unlockRet = mutex.unlock();
+		const auto end = getCycles();
+		if (lockRet != 0 || unlockRet != 0)
+			return false;
+		measurement.add(end - start);
+	}
+
+	measurement.write(parameters.lockUnlockName);
+	return true;
+}
+
+/**
+ * \brief Measures time from Mutex::unlock() to the moment in which helper thread starts running as the new owner of the
+ * mutex.
+ *
+ * \param [in] parameters is a reference to parameters of benchmark
+ *
+ * \return true if benchmark succeeded, false otherwise
+ */
+
+bool unlockToWaiter(const Parameters& parameters)
+{
+	Mutex mutex {parameters.protocol, BenchmarkCase::helperThreadPriority};
+	Semaphore semaphore {0};
+	uint32_t lockCycles {};
+	auto helperThread = makeAndStartStaticThread<BenchmarkCase::helperThreadStackSize>(
+			BenchmarkCase::helperThreadPriority,
+			[&mutex, &semaphore, &lockCycles]()
+			{
+				for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+				{
+					semaphore.wait();
+					mutex.lock();
+					lockCycles = getCycles();
+					mutex.unlock();
+				}
+			});
+
+	Measurement measurement;
+	bool result {true};
+	for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+	{
+		if (mutex.lock() != 0)
+			result = false;
+		// helper thread preempts this thread and blocks on the mutex (unless priority ceiling prevents preemption)
+		if (semaphore.post() != 0)
+			result = false;
+		const auto start = getCycles();
+		if (mutex.unlock() != 0)
+			result = false;
+		measurement.add(lockCycles - start);
+	}
+
+	helperThread.join();
+	measurement.write(parameters.unlockToWaiterName);
+	return result;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MutexBenchmark::run_() const
+{
+	for (const auto& parameters : parametersArray)
+		for (const auto& function : {lockUnlock, unlockToWaiter})
+			if (function(parameters) == false)
+				return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
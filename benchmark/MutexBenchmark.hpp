@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief MutexBenchmark class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_MUTEXBENCHMARK_HPP_
+#define BENCHMARK_MUTEXBENCHMARK_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures Mutex operations for each MutexProtocol.
+ *
+ * Measures the pair of Mutex::lock() and Mutex::unlock() calls without contention and the time from the call to
+ * Mutex::unlock() in benchmark thread to the moment in which higher priority helper thread - blocked in Mutex::lock() -
+ * starts running as the new owner of the mutex. With MutexProtocol::priorityProtect helper thread cannot be blocked on
+ * the mutex, as benchmark thread's priority is raised to priority ceiling (equal to priority of helper thread), so
+ * the second result is the time from the call to Mutex::unlock() to the moment in which helper thread locks the
+ * mutex.
+ */
+
+class MutexBenchmark : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_MUTEXBENCHMARK_HPP_
@@ -0,0 +1,126 @@
+/**
+ * \file
+ * \brief SemaphoreBenchmark class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SemaphoreBenchmark.hpp"
+
+#include "getCycles.hpp"
+#include "Measurement.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures time from Semaphore::post() to the moment in which helper thread blocked on the semaphore starts
+ * running.
+ *
+ * \return true if benchmark succeeded, false otherwise
+ */
+
+bool postToWaiter()
+{
+	Semaphore semaphore {0};
+	uint32_t wakeUpCycles {};
+	auto helperThread = makeAndStartStaticThread<BenchmarkCase::helperThreadStackSize>(
+			BenchmarkCase::helperThreadPriority,
+			[&semaphore, &wakeUpCycles]()
+			{
+				for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+				{
+					semaphore.wait();
+					wakeUpCycles = getCycles();
+				}
+			});
+
+	Measurement measurement;
+	bool result {true};
+	for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+	{
+		const auto start = getCycles();
+		if (semaphore.post() != 0)
+			result = false;
+		measurement.add(wakeUpCycles - start);
+	}
+
+	helperThread.join();
+	measurement.write("semaphore-post-to-waiter");
+	return result;
+}
+
+/**
+ * \brief Measures round trip in which benchmark thread posts one semaphore and helper thread responds by posting
+ * another one.
+ *
+ * \return true if benchmark succeeded, false otherwise
+ */
+
+bool pingPong()
+{
+	Semaphore pingSemaphore {0};
+	Semaphore pongSemaphore {0};
+	auto helperThread = makeAndStartStaticThread<BenchmarkCase::helperThreadStackSize>(
+			BenchmarkCase::helperThreadPriority,
+			[&pingSemaphore, &pongSemaphore]()
+			{
+				for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+				{
+					pingSemaphore.wait();
+					pongSemaphore.post();
+				}
+			});
+
+	Measurement measurement;
+	bool result {true};
+	for (size_t iteration {}; iteration < BenchmarkCase::iterations; ++iteration)
+	{
+		const auto start = getCycles();
+		// helper thread preempts this thread, posts the semaphore and blocks again, so it can be taken immediately
+		if (pingSemaphore.post() != 0 || pongSemaphore.tryWait() != 0)
+			result = false;
+		const auto end = getCycles();
+		measurement.add(end - start);
+	}
+
+	helperThread.join();
+	measurement.write("semaphore-ping-pong");
+	return result;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SemaphoreBenchmark::run_() const
+{
+	for (const auto& function : {postToWaiter, pingPong})
+		if (function() == false)
+			return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
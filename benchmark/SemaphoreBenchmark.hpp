@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief SemaphoreBenchmark class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_SEMAPHOREBENCHMARK_HPP_
+#define BENCHMARK_SEMAPHOREBENCHMARK_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures context switches caused by Semaphore.
+ *
+ * Measures time from the call to Semaphore::post() in benchmark thread to the moment in which higher priority helper
+ * thread - blocked in Semaphore::wait() - starts running, as well as the time of a "ping-pong" round trip, in which
+ * benchmark thread posts one semaphore and helper thread responds by posting another one.
+ */
+
+class SemaphoreBenchmark : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_SEMAPHOREBENCHMARK_HPP_
@@ -0,0 +1,69 @@
+/**
+ * \file
+ * \brief SoftwareTimerBenchmark class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerBenchmark.hpp"
+
+#include "getCycles.hpp"
+#include "Measurement.hpp"
+
+#include "distortos/StaticSoftwareTimer.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Empty function executed by software timer
+ */
+
+void emptyFunction()
+{
+
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerBenchmark::run_() const
+{
+	auto softwareTimer = makeStaticSoftwareTimer(emptyFunction);
+	Measurement measurement;
+	for (size_t iteration {}; iteration < iterations; ++iteration)
+	{
+		const auto start = getCycles();
+		// duration is long enough to make sure the timer is always stopped before it expires
+		const auto startRet = softwareTimer.start(std::chrono::seconds{1});
+		const auto stopRet = softwareTimer.stop();
+		const auto end = getCycles();
+		if (startRet != 0 || stopRet != 0)
+			return false;
+		measurement.add(end - start);
+	}
+
+	measurement.write("softwareTimer-start-stop");
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,46 @@
+/**
+ * \file
+ * \brief SoftwareTimerBenchmark class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_SOFTWARETIMERBENCHMARK_HPP_
+#define BENCHMARK_SOFTWARETIMERBENCHMARK_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures SoftwareTimer operations.
+ *
+ * Measures the pair of SoftwareTimer::start() and SoftwareTimer::stop() calls.
+ */
+
+class SoftwareTimerBenchmark : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_SOFTWARETIMERBENCHMARK_HPP_
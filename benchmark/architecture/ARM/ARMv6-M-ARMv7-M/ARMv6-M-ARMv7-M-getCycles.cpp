@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief getCycles() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "getCycles.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t getCycles()
+{
+	// SysTick combined with tick count is used instead of DWT's cycle counter, as it is available in all ARMv6-M and
+	// ARMv7-M cores and is emulated by QEMU
+	const InterruptMaskingLock interruptMaskingLock;
+
+	auto ticks = TickClock::now().time_since_epoch().count();
+	const uint32_t value {SysTick->VAL};
+	const uint32_t period {SysTick->LOAD + 1};	// LOAD is different from regular period only during tickless idle
+	// if SysTick was reloaded after interrupts were masked, "tick" interrupt is pending and tick count is not updated
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0 && value > period / 2)
+		++ticks;
+
+	const uint32_t cycles {static_cast<uint32_t>(ticks) * period + (period - 1 - value)};
+	// SysTick is clocked with core clock divided by 8 if its clock source is not the processor clock
+	return (SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk) != 0 ? cycles : cycles * 8;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,99 @@
+/**
+ * \file
+ * \brief endOutput() and writeOutput() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "output.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+#ifdef CONFIG_BENCHMARK_APPLICATION_SEMIHOSTING_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// SYS_EXIT semihosting operation
+constexpr uintptr_t sysExit {0x18};
+
+/// SYS_WRITE0 semihosting operation
+constexpr uintptr_t sysWrite0 {0x04};
+
+/// ADP_Stopped_ApplicationExit reason code of SYS_EXIT semihosting operation
+constexpr uintptr_t adpStoppedApplicationExit {0x20026};
+
+/// ADP_Stopped_RunTimeErrorUnknown reason code of SYS_EXIT semihosting operation
+constexpr uintptr_t adpStoppedRunTimeErrorUnknown {0x20023};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Executes semihosting operation.
+ *
+ * \param [in] operation is the number of semihosting operation
+ * \param [in] parameter is the parameter of semihosting operation
+ */
+
+void semihostingCall(const uintptr_t operation, const uintptr_t parameter)
+{
+	asm volatile
+	(
+			"	mov		r0, %[operation]	\n"
+			"	mov		r1, %[parameter]	\n"
+			"	bkpt	0xab				\n"
+
+			::	[operation] "r" (operation),
+				[parameter] "r" (parameter)
+			:	"r0", "r1", "memory"
+	);
+}
+
+#endif	// def CONFIG_BENCHMARK_APPLICATION_SEMIHOSTING_ENABLE
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void endOutput(const bool result)
+{
+#ifdef CONFIG_BENCHMARK_APPLICATION_SEMIHOSTING_ENABLE
+	// QEMU exits with status 0 for ADP_Stopped_ApplicationExit and with status 1 for any other reason
+	semihostingCall(sysExit, result == true ? adpStoppedApplicationExit : adpStoppedRunTimeErrorUnknown);
+#else	// !def CONFIG_BENCHMARK_APPLICATION_SEMIHOSTING_ENABLE
+	static_cast<void>(result);
+#endif	// !def CONFIG_BENCHMARK_APPLICATION_SEMIHOSTING_ENABLE
+}
+
+void writeOutput(const char* const string)
+{
+#ifdef CONFIG_BENCHMARK_APPLICATION_SEMIHOSTING_ENABLE
+	semihostingCall(sysWrite0, reinterpret_cast<uintptr_t>(string));
+#else	// !def CONFIG_BENCHMARK_APPLICATION_SEMIHOSTING_ENABLE
+	static_cast<void>(string);
+#endif	// !def CONFIG_BENCHMARK_APPLICATION_SEMIHOSTING_ENABLE
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
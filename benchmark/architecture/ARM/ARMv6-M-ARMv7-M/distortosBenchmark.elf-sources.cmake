@@ -0,0 +1,16 @@
+#
+# file: distortosBenchmark.elf-sources.cmake
+#
+# author: Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+if(CONFIG_ARCHITECTURE_ARMV6_M OR CONFIG_ARCHITECTURE_ARMV7_M)
+
+	target_sources(distortosBenchmark.elf PRIVATE
+			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-getCycles.cpp
+			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-output.cpp)
+
+endif()
@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief getCycles() implementation for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "getCycles.hpp"
+
+#include <x86intrin.h>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t getCycles()
+{
+	return static_cast<uint32_t>(__rdtsc());
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief endOutput() and writeOutput() implementation for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "output.hpp"
+
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void endOutput(bool)
+{
+	// nothing to do - result is returned from main()
+}
+
+void writeOutput(const char* const string)
+{
+	fputs(string, stdout);
+	fflush(stdout);
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,74 @@
+/**
+ * \file
+ * \brief benchmarkCases object definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "benchmarkCases.hpp"
+
+#include "CycleCounterBenchmark.hpp"
+#include "FifoQueueBenchmark.hpp"
+#include "InterruptLatencyBenchmark.hpp"
+#include "MutexBenchmark.hpp"
+#include "SemaphoreBenchmark.hpp"
+#include "SoftwareTimerBenchmark.hpp"
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// CycleCounterBenchmark instance
+const CycleCounterBenchmark cycleCounterBenchmark;
+
+/// SemaphoreBenchmark instance
+const SemaphoreBenchmark semaphoreBenchmark;
+
+/// MutexBenchmark instance
+const MutexBenchmark mutexBenchmark;
+
+/// FifoQueueBenchmark instance
+const FifoQueueBenchmark fifoQueueBenchmark;
+
+/// SoftwareTimerBenchmark instance
+const SoftwareTimerBenchmark softwareTimerBenchmark;
+
+/// InterruptLatencyBenchmark instance
+const InterruptLatencyBenchmark interruptLatencyBenchmark;
+
+/// array with references to all benchmarks
+const test::TestCaseGroup::Range::value_type benchmarkCases_[]
+{
+		test::TestCaseGroup::Range::value_type{cycleCounterBenchmark},
+		test::TestCaseGroup::Range::value_type{semaphoreBenchmark},
+		test::TestCaseGroup::Range::value_type{mutexBenchmark},
+		test::TestCaseGroup::Range::value_type{fifoQueueBenchmark},
+		test::TestCaseGroup::Range::value_type{softwareTimerBenchmark},
+		test::TestCaseGroup::Range::value_type{interruptLatencyBenchmark},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const test::TestCaseGroup benchmarkCases {test::TestCaseGroup::Range{benchmarkCases_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
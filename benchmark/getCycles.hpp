@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief getCycles() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_GETCYCLES_HPP_
+#define BENCHMARK_GETCYCLES_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Architecture-specific read of current time in core clock cycles.
+ *
+ * The value wraps around, so only differences of values read less than 2^32 cycles apart are meaningful.
+ *
+ * \return current time, core clock cycles
+ */
+
+uint32_t getCycles();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_GETCYCLES_HPP_
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief Main code block of benchmark application.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "benchmarkCases.hpp"
+#include "output.hpp"
+#include "TestCaseGroup.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include "distortos/ThisThread.hpp"
+
+#include <cstdlib>
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Main code block of benchmark application
+ *
+ * Runs all benchmarks (until the first one which fails) and writes their results to output. On host the result is
+ * returned as exit status of the process.
+ */
+
+int main()
+{
+	distortos::benchmark::writeOutput("# name,samples,minimum,average,maximum\n");
+
+	// "volatile" to allow examination of the value with debugger - the variable will not be optimized out
+	const volatile auto result = distortos::benchmark::benchmarkCases.run();
+	distortos::benchmark::writeOutput(result == true ? "# success\n" : "# failure\n");
+	distortos::benchmark::endOutput(result);
+
+#ifdef CONFIG_ARCHITECTURE_HOST
+
+	return result == true ? EXIT_SUCCESS : EXIT_FAILURE;
+
+#endif	// def CONFIG_ARCHITECTURE_HOST
+
+	while (1)
+		distortos::ThisThread::sleepFor(std::chrono::seconds{1});
+}
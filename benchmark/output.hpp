@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief Declarations of functions used to output results of benchmarks
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_OUTPUT_HPP_
+#define BENCHMARK_OUTPUT_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Architecture-specific end of output.
+ *
+ * Called once, after all results were written.
+ *
+ * \param [in] result is the result of all benchmarks, true if all of them succeeded, false otherwise
+ */
+
+void endOutput(bool result);
+
+/**
+ * \brief Architecture-specific write of null-terminated string to output.
+ *
+ * \param [in] string is a pointer to null-terminated string which will be written
+ */
+
+void writeOutput(const char* string);
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_OUTPUT_HPP_
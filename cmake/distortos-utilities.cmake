@@ -105,6 +105,10 @@ endfunction()
 #
 
 function(size elfFilename)
+	# native toolchains don't set CMAKE_SIZE
+	if(NOT CMAKE_SIZE)
+		find_program(CMAKE_SIZE size)
+	endif()
 	add_custom_target(${elfFilename}-size ALL
 			COMMAND ${CMAKE_SIZE} -B ${elfFilename}
 			DEPENDS ${elfFilename}
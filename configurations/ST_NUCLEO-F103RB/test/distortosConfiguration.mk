@@ -257,6 +257,7 @@ CONFIG_CHIP_STM32_GPIOV1_HAS_GPIOD=y
 # CONFIG_CHIP_STM32_GPIOV1_HAS_GPIOE is not set
 # CONFIG_CHIP_STM32_GPIOV1_HAS_GPIOF is not set
 # CONFIG_CHIP_STM32_GPIOV1_HAS_GPIOG is not set
+# CONFIG_CHIP_STM32_DMAV2 is not set
 CONFIG_CHIP_STM32_GPIOV1=y
 # CONFIG_CHIP_STM32_GPIOV2 is not set
 CONFIG_CHIP_STM32_SPIV1=y
@@ -314,6 +315,9 @@ CONFIG_ARCHITECTURE_INCLUDES="source/architecture/ARM/ARMv6-M-ARMv7-M/include so
 # CONFIG_ARCHITECTURE_ASCENDING_STACK is not set
 # CONFIG_ARCHITECTURE_EMPTY_STACK is not set
 # CONFIG_ARCHITECTURE_HAS_FPU is not set
+CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER=y
+CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS=y
+CONFIG_ARCHITECTURE_STACK_OVERHEAD=0
 CONFIG_ARCHITECTURE_ARM=y
 
 #
@@ -323,6 +327,16 @@ CONFIG_TICK_FREQUENCY=1000
 CONFIG_ROUND_ROBIN_FREQUENCY=10
 CONFIG_SIGNALS_ENABLE=y
 CONFIG_THREAD_DETACH_ENABLE=y
+# CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE is not set
+CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE=y
+CONFIG_SCHEDULER_CPU_BUDGET_ENABLE=y
+# CONFIG_TICKLESS_IDLE_ENABLE is not set
+# CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE is not set
+# CONFIG_RUN_TIME_STATISTICS_ENABLE is not set
+CONFIG_SYSTEM_WORK_QUEUE_ENABLE=y
+CONFIG_SYSTEM_WORK_QUEUE_THREADS=1
+CONFIG_SYSTEM_WORK_QUEUE_THREAD_STACK_SIZE=512
+CONFIG_SYSTEM_WORK_QUEUE_THREAD_PRIORITY=192
 
 #
 # main() thread options
@@ -346,6 +360,7 @@ CONFIG_STACK_GUARD_SIZE=32
 #
 # Applications configuration
 #
+# CONFIG_BENCHMARK_APPLICATION_ENABLE is not set
 CONFIG_TEST_APPLICATION_ENABLE=y
 
 #
@@ -59,7 +59,7 @@ CONFIG_BOARD_HAS_YAML=y
 CONFIG_CHIP_ROM_SIZE=524288
 CONFIG_CHIP_ROM_ADDRESS=0x08000000
 CONFIG_CHIP="STM32F401RE"
-CONFIG_CHIP_INCLUDES="source/chip/STM32/include source/chip/STM32/STM32F4/include source/chip/STM32/peripherals/GPIOv2/include source/chip/STM32/peripherals/SPIv1/include source/chip/STM32/peripherals/USARTv1/include source/chip/STM32/STM32F4/external/CMSIS-STM32F4"
+CONFIG_CHIP_INCLUDES="source/chip/STM32/include source/chip/STM32/STM32F4/include source/chip/STM32/peripherals/DMAv2/include source/chip/STM32/peripherals/GPIOv2/include source/chip/STM32/peripherals/SPIv1/include source/chip/STM32/peripherals/USARTv1/include source/chip/STM32/STM32F4/external/CMSIS-STM32F4"
 
 #
 # STM32F4 chip options
@@ -369,6 +369,8 @@ CONFIG_CHIP_STM32F4_RCC_PPRE2=1
 #
 # Peripherals configuration
 #
+# CONFIG_CHIP_STM32_DMAV2_DMA1_ENABLE is not set
+# CONFIG_CHIP_STM32_DMAV2_DMA2_ENABLE is not set
 CONFIG_CHIP_STM32_GPIO_V2_GPIOA_ENABLE=y
 # CONFIG_CHIP_STM32_GPIO_V2_GPIOB_ENABLE is not set
 CONFIG_CHIP_STM32_GPIO_V2_GPIOC_ENABLE=y
@@ -387,6 +389,7 @@ CONFIG_CHIP_STM32_GPIOV2_HAS_GPIOH=y
 # CONFIG_CHIP_STM32_GPIOV2_HAS_GPIOI is not set
 # CONFIG_CHIP_STM32_GPIOV2_HAS_GPIOJ is not set
 # CONFIG_CHIP_STM32_GPIOV2_HAS_GPIOK is not set
+CONFIG_CHIP_STM32_DMAV2=y
 # CONFIG_CHIP_STM32_GPIOV1 is not set
 CONFIG_CHIP_STM32_GPIOV2=y
 CONFIG_CHIP_STM32_SPIV1=y
@@ -446,6 +449,9 @@ CONFIG_ARCHITECTURE_FPU=y
 # CONFIG_ARCHITECTURE_ASCENDING_STACK is not set
 # CONFIG_ARCHITECTURE_EMPTY_STACK is not set
 CONFIG_ARCHITECTURE_HAS_FPU=y
+CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER=y
+CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS=y
+CONFIG_ARCHITECTURE_STACK_OVERHEAD=0
 CONFIG_ARCHITECTURE_ARM=y
 
 #
@@ -455,6 +461,16 @@ CONFIG_TICK_FREQUENCY=1000
 CONFIG_ROUND_ROBIN_FREQUENCY=10
 CONFIG_SIGNALS_ENABLE=y
 CONFIG_THREAD_DETACH_ENABLE=y
+# CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE is not set
+CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE=y
+CONFIG_SCHEDULER_CPU_BUDGET_ENABLE=y
+# CONFIG_TICKLESS_IDLE_ENABLE is not set
+# CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE is not set
+# CONFIG_RUN_TIME_STATISTICS_ENABLE is not set
+CONFIG_SYSTEM_WORK_QUEUE_ENABLE=y
+CONFIG_SYSTEM_WORK_QUEUE_THREADS=1
+CONFIG_SYSTEM_WORK_QUEUE_THREAD_STACK_SIZE=512
+CONFIG_SYSTEM_WORK_QUEUE_THREAD_PRIORITY=192
 
 #
 # main() thread options
@@ -478,6 +494,7 @@ CONFIG_STACK_GUARD_SIZE=32
 #
 # Applications configuration
 #
+# CONFIG_BENCHMARK_APPLICATION_ENABLE is not set
 CONFIG_TEST_APPLICATION_ENABLE=y
 
 #
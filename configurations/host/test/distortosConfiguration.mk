@@ -0,0 +1,111 @@
+#
+# Automatically generated file; DO NOT EDIT.
+# Configuration
+#
+
+#
+# Board, chip & architecture configuration
+#
+# CONFIG_CHIP_STM32 is not set
+CONFIG_CHIP_HOST=y
+CONFIG_BOARD_CUSTOM=y
+CONFIG_BOARD="Custom"
+CONFIG_CHIP="host"
+CONFIG_CHIP_INCLUDES=""
+
+#
+# Peripherals configuration
+#
+
+#
+# Generic chip options
+#
+
+#
+# Host architecture options
+#
+CONFIG_ARCHITECTURE_STACK_ALIGNMENT=16
+CONFIG_ARCHITECTURE_STACK_OVERHEAD=65536
+CONFIG_TOOLCHAIN_PREFIX=""
+CONFIG_ARCHITECTURE_FLAGS=""
+CONFIG_ARCHITECTURE_INCLUDES="source/architecture/host/include"
+CONFIG_LDSCRIPT="source/architecture/host/host.ld"
+
+#
+# Generic architecture options
+#
+# CONFIG_ARCHITECTURE_ASCENDING_STACK is not set
+# CONFIG_ARCHITECTURE_EMPTY_STACK is not set
+# CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER is not set
+# CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS is not set
+# CONFIG_ARCHITECTURE_HAS_FPU is not set
+# CONFIG_ARCHITECTURE_ARM is not set
+CONFIG_ARCHITECTURE_HOST=y
+CONFIG_CHIP_ROM_SIZE=0
+
+#
+# Scheduler configuration
+#
+CONFIG_TICK_FREQUENCY=1000
+CONFIG_ROUND_ROBIN_FREQUENCY=10
+CONFIG_SIGNALS_ENABLE=y
+CONFIG_THREAD_DETACH_ENABLE=y
+# CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE is not set
+CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE=y
+CONFIG_SCHEDULER_CPU_BUDGET_ENABLE=y
+# CONFIG_TICKLESS_IDLE_ENABLE is not set
+# CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE is not set
+CONFIG_RUN_TIME_STATISTICS_ENABLE=y
+CONFIG_SYSTEM_WORK_QUEUE_ENABLE=y
+CONFIG_SYSTEM_WORK_QUEUE_THREADS=1
+CONFIG_SYSTEM_WORK_QUEUE_THREAD_STACK_SIZE=1024
+CONFIG_SYSTEM_WORK_QUEUE_THREAD_PRIORITY=192
+
+#
+# main() thread options
+#
+CONFIG_MAIN_THREAD_STACK_SIZE=2097152
+CONFIG_MAIN_THREAD_PRIORITY=127
+CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS=y
+CONFIG_MAIN_THREAD_QUEUED_SIGNALS=8
+CONFIG_MAIN_THREAD_SIGNAL_ACTIONS=8
+
+#
+# Runtime checks
+#
+CONFIG_CHECK_FUNCTION_CONTEXT_ENABLE=y
+CONFIG_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE=y
+CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE=y
+CONFIG_CHECK_STACK_GUARD_CONTEXT_SWITCH_ENABLE=y
+CONFIG_CHECK_STACK_GUARD_SYSTEM_TICK_ENABLE=y
+CONFIG_STACK_GUARD_SIZE=32
+
+#
+# Applications configuration
+#
+CONFIG_BENCHMARK_APPLICATION_ENABLE=y
+CONFIG_BENCHMARK_APPLICATION_ITERATIONS=100
+CONFIG_TEST_APPLICATION_ENABLE=y
+
+#
+# Build configuration
+#
+# CONFIG_BUILD_OPTIMIZATION_O0 is not set
+# CONFIG_BUILD_OPTIMIZATION_O1 is not set
+CONFIG_BUILD_OPTIMIZATION_O2=y
+# CONFIG_BUILD_OPTIMIZATION_O3 is not set
+# CONFIG_BUILD_OPTIMIZATION_OS is not set
+# CONFIG_BUILD_OPTIMIZATION_OG is not set
+# CONFIG_LINK_TIME_OPTIMIZATION_ENABLE is not set
+# CONFIG_STATIC_DESTRUCTORS_ENABLE is not set
+CONFIG_DEBUGGING_INFORMATION_ENABLE=y
+CONFIG_ASSERT_ENABLE=y
+CONFIG_LDSCRIPT_ROM_BEGIN=0
+CONFIG_LDSCRIPT_ROM_END=0
+CONFIG_BUILD_OPTIMIZATION="-O2"
+CONFIG_LINK_TIME_OPTIMIZATION_COMPILATION=""
+CONFIG_LINK_TIME_OPTIMIZATION_LINKING=""
+CONFIG_STATIC_DESTRUCTORS_RUN_TIME_REGISTRATION="-fno-use-cxa-atexit"
+CONFIG_DEBUGGING_INFORMATION_COMPILATION="-g -ggdb3"
+CONFIG_DEBUGGING_INFORMATION_LINKING="-g"
+CONFIG_ASSERT=""
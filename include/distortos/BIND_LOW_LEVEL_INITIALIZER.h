@@ -28,7 +28,8 @@
  * - 40 - chip low-level initialization,
  * - 50 - peripherals low-level initialization,
  * - 60 - board low-level initialization,
- * - 70 - start of scheduling.
+ * - 70 - start of scheduling,
+ * - 80 - system work queue low-level initialization.
  *
  * \param [in] order is an order of the low-level initializer, [0; 99]
  * \param [in] function is the low-level initializer function
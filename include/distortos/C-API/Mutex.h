@@ -45,20 +45,20 @@ struct distortos_Mutex
 	/** node for intrusive list */
 	struct estd_IntrusiveListNode node;
 
-	/** ThreadControlBlock objects blocked on mutex */
-	struct estd_IntrusiveList blockedList;
+	/** "boosted priority" of mutex - priority ceiling when protocol_ == Protocol::priorityProtect, 0 otherwise */
+	uint8_t boostedPriority;
 
-	/** owner of the mutex */
-	void* owner;
+	/** type of mutex and its protocol */
+	uint8_t typeProtocol;
 
 	/** number of recursive locks, used when mutex type is recursive */
 	uint16_t recursiveLocksCount;
 
-	/** priority ceiling of mutex, valid only when protocol_ == Protocol::priorityProtect */
-	uint8_t priorityCeiling;
+	/** ThreadControlBlock objects blocked on mutex */
+	struct estd_IntrusiveList blockedList;
 
-	/** type of mutex and its protocol */
-	uint8_t typeProtocol;
+	/** owner of the mutex */
+	void* owner;
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -116,14 +116,15 @@ enum
  */
 
 #define DISTORTOS_MUTEX_INITIALIZER(self, type, protocol, priorityCeiling) \
-		{ESTD_INTRUSIVELISTNODE_INITIALIZER((self).node), ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), \
-		NULL, 0, (priorityCeiling), \
+		{ESTD_INTRUSIVELISTNODE_INITIALIZER((self).node), \
+		(uint8_t)((protocol) == distortos_Mutex_Protocol_priorityProtect ? (priorityCeiling) : 0), \
 		(uint8_t)(((type) == distortos_Mutex_Type_normal || (type) == distortos_Mutex_Type_errorChecking || \
 				(type) == distortos_Mutex_Type_recursive ? \
 				(uint8_t)(type) : (uint8_t)distortos_Mutex_Type_normal) << distortos_Mutex_typeShift | \
 		((protocol) == distortos_Mutex_Protocol_none || (protocol) == distortos_Mutex_Protocol_priorityInheritance || \
 				(protocol) == distortos_Mutex_Protocol_priorityProtect ? \
-				(uint8_t)(protocol) : (uint8_t)distortos_Mutex_Protocol_none) << distortos_Mutex_protocolShift)}
+				(uint8_t)(protocol) : (uint8_t)distortos_Mutex_Protocol_none) << distortos_Mutex_protocolShift), \
+		0, ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), NULL}
 
 /**
  * \brief C-API equivalent of distortos::Mutex's constructor
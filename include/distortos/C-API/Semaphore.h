@@ -49,6 +49,9 @@ struct distortos_Semaphore
 
 	/** max value of the semaphore */
 	unsigned int maxValue;
+
+	/** pointer to control block of wait set which waits for this semaphore, NULL if none */
+	void* waitSetControlBlock;
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -67,7 +70,8 @@ struct distortos_Semaphore
  */
 
 #define DISTORTOS_SEMAPHORE_INITIALIZER(self, value, maxValue) \
-		{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), (value) < (maxValue) ? (value) : (maxValue), (maxValue)}
+		{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), (value) < (maxValue) ? (value) : (maxValue), (maxValue), \
+		NULL}
 
 /**
  * \brief C-API equivalent of distortos::Semaphore's constructor
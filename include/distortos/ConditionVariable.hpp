@@ -75,6 +75,11 @@ public:
 	 *
 	 * Unblocks all threads waiting on this condition variable. The notifying thread does not need to hold the same
 	 * mutex as the one held by the waiting thread(s).
+	 *
+	 * Waiting threads are not woken just to block again on the mutex - if the mutex is locked, they are moved directly
+	 * to the list of threads blocked on the mutex, so only the thread which gets the lock is woken. If the mutex is
+	 * unlocked, it is locked for the first waiting thread before that thread is woken. Mutexes with priorityProtect
+	 * protocol are excluded from this optimization.
 	 */
 
 	void notifyAll();
@@ -89,6 +94,9 @@ public:
 	 *
 	 * Unblocks one thread waiting on this condition variable. The notifying thread does not need to hold the same
 	 * mutex as the one held by the waiting thread(s).
+	 *
+	 * If the mutex is locked, the waiting thread is moved directly to the list of threads blocked on the mutex and it is
+	 * woken only when it gets the lock.
 	 */
 
 	void notifyOne();
@@ -302,6 +310,32 @@ public:
 
 private:
 
+	/**
+	 * \brief Blocks current thread on this condition variable.
+	 *
+	 * \param [in] mutex is a reference to mutex which was released by current thread
+	 * \param [in] released selects whether \a mutex was actually released (true) - so the wait of current thread may be
+	 * moved to this mutex - or whether it is still held by current thread due to recursive locks (false)
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, nullptr to block without
+	 * timeout
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - values returned by internal::Scheduler::block() (for blocking without timeout) /
+	 * internal::Scheduler::blockUntil() (for blocking with timeout);
+	 */
+
+	int blockInternal(Mutex& mutex, bool released, const TickClock::time_point* timePoint);
+
+	/**
+	 * \brief Notifies first waiting thread.
+	 *
+	 * Thread is moved to the list of threads blocked on its mutex if the mutex is locked, otherwise it is unblocked.
+	 *
+	 * \attention blockedList_ must not be empty
+	 */
+
+	void notifyFirst();
+
 	/// ThreadControlBlock objects blocked on this condition variable
 	internal::ThreadList blockedList_;
 };
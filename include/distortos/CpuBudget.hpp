@@ -0,0 +1,116 @@
+/**
+ * \file
+ * \brief CpuBudget class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_CPUBUDGET_HPP_
+#define INCLUDE_DISTORTOS_CPUBUDGET_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#include "distortos/internal/scheduler/CpuBudgetControlBlock.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadControlBlock;
+
+}	// namespace internal
+
+/**
+ * \brief CpuBudget class is a reservation of CPU time shared by a set of threads
+ *
+ * Each tick during which one of the threads of the budget is running is charged to the budget. When the budget is
+ * exhausted, all of its threads are throttled - their effective priority is lowered to 0 (priority of idle thread),
+ * unless it is boosted by a mutex - until the budget is replenished at the beginning of next period. This bounds the
+ * interference of a subsystem (e.g. logging or diagnostics) with other threads, regardless of the priorities of its
+ * threads.
+ *
+ * A thread is added to the budget with ThisThread::setCpuBudget(). Threads started by a thread which has a budget
+ * inherit this budget.
+ *
+ * \ingroup threads
+ */
+
+class CpuBudget
+{
+	friend internal::ThreadControlBlock;
+
+public:
+
+	/**
+	 * \brief CpuBudget's constructor
+	 *
+	 * Starts periodic replenishment of the budget.
+	 *
+	 * \param [in] budget is the amount of CPU time available to all threads of the budget in each period, > 0
+	 * \param [in] period is the replenishment period, > 0
+	 */
+
+	CpuBudget(const TickClock::duration budget, const TickClock::duration period) :
+			cpuBudgetControlBlock_{budget, period}
+	{
+
+	}
+
+	/**
+	 * \brief CpuBudget's constructor
+	 *
+	 * Starts periodic replenishment of the budget.
+	 *
+	 * \tparam Rep1 is type of tick counter used in \a budget
+	 * \tparam Period1 is std::ratio type representing the tick period of the clock used in \a budget, seconds
+	 * \tparam Rep2 is type of tick counter used in \a period
+	 * \tparam Period2 is std::ratio type representing the tick period of the clock used in \a period, seconds
+	 *
+	 * \param [in] budget is the amount of CPU time available to all threads of the budget in each period, > 0
+	 * \param [in] period is the replenishment period, > 0
+	 */
+
+	template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+	CpuBudget(const std::chrono::duration<Rep1, Period1> budget, const std::chrono::duration<Rep2, Period2> period) :
+			CpuBudget{std::chrono::duration_cast<TickClock::duration>(budget),
+					std::chrono::duration_cast<TickClock::duration>(period)}
+	{
+
+	}
+
+	/**
+	 * \return remaining amount of CPU time in current period
+	 */
+
+	TickClock::duration getRemainingBudget() const;
+
+	/**
+	 * \return true if the budget is exhausted and its threads are throttled, false otherwise
+	 */
+
+	bool isThrottled() const;
+
+	CpuBudget(const CpuBudget&) = delete;
+	CpuBudget(CpuBudget&&) = delete;
+	const CpuBudget& operator=(const CpuBudget&) = delete;
+	CpuBudget& operator=(CpuBudget&&) = delete;
+
+private:
+
+	/// contained internal::CpuBudgetControlBlock object
+	internal::CpuBudgetControlBlock cpuBudgetControlBlock_;
+};
+
+}	// namespace distortos
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_CPUBUDGET_HPP_
@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief DynamicSharedMutex class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICSHAREDMUTEX_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICSHAREDMUTEX_HPP_
+
+#include "distortos/SharedMutex.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicSharedMutex class is a variant of SharedMutex that has dynamic storage for slots of owners.
+ *
+ * \ingroup synchronization
+ */
+
+class DynamicSharedMutex : public SharedMutex
+{
+public:
+
+	/**
+	 * \brief DynamicSharedMutex's constructor
+	 *
+	 * \param [in] maxReaders is the maximum number of readers which may hold the lock at the same time, must be greater
+	 * than 0
+	 */
+
+	explicit DynamicSharedMutex(size_t maxReaders);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICSHAREDMUTEX_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThreadParameters class header
  *
- * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 #define INCLUDE_DISTORTOS_DYNAMICTHREADPARAMETERS_HPP_
 
 #include "distortos/SchedulingPolicy.hpp"
+#include "distortos/TickClock.hpp"
 
 #include <cstddef>
 
@@ -43,11 +44,15 @@ struct DynamicThreadParameters
 	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
 	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 * \param [in] roundRobinQuantumm is the length of round-robin quantum of the thread, default - 0 (default length
+	 * derived from CONFIG_TICK_FREQUENCY and CONFIG_ROUND_ROBIN_FREQUENCY)
 	 */
 
 	constexpr DynamicThreadParameters(const size_t stackSizee, const bool canReceiveSignalss,
 			const size_t queuedSignalss, const size_t signalActionss, const uint8_t priorityy,
-			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin,
+			const TickClock::duration roundRobinQuantumm = {}) :
+					roundRobinQuantum{roundRobinQuantumm},
 					queuedSignals{queuedSignalss},
 					signalActions{signalActionss},
 					stackSize{stackSizee},
@@ -64,15 +69,21 @@ struct DynamicThreadParameters
 	 * \param [in] stackSizee is the size of stack, bytes
 	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 * \param [in] roundRobinQuantumm is the length of round-robin quantum of the thread, default - 0 (default length
+	 * derived from CONFIG_TICK_FREQUENCY and CONFIG_ROUND_ROBIN_FREQUENCY)
 	 */
 
 	constexpr DynamicThreadParameters(const size_t stackSizee, const uint8_t priorityy,
-			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
-					DynamicThreadParameters{stackSizee, false, 0, 0, priorityy, schedulingPolicyy}
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin,
+			const TickClock::duration roundRobinQuantumm = {}) :
+					DynamicThreadParameters{stackSizee, false, 0, 0, priorityy, schedulingPolicyy, roundRobinQuantumm}
 	{
 
 	}
 
+	/// length of round-robin quantum of the thread, 0 to use default length
+	TickClock::duration roundRobinQuantum;
+
 	/// max number of queued signals for this thread, relevant only if \a canReceiveSignals == true, 0 to disable
 	/// queuing of signals for this thread
 	size_t queuedSignals;
@@ -0,0 +1,409 @@
+/**
+ * \file
+ * \brief EventGroup class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_EVENTGROUP_HPP_
+#define INCLUDE_DISTORTOS_EVENTGROUP_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief EventGroup is a set of event bits which may be awaited by multiple threads at once
+ *
+ * Each thread waits either for any or for all of the selected event bits. Event bits may be set and cleared from
+ * interrupt context. set() evaluates all waiting threads (in priority order) with single pass and single critical
+ * section, unblocking all threads whose waits are satisfied. Each waiting thread may request the awaited bits to be
+ * cleared when its wait is satisfied - such clearing takes effect immediately, so threads which are later in priority
+ * order may not see these bits.
+ *
+ * \ingroup synchronization
+ */
+
+class EventGroup
+{
+public:
+
+	/// type of event bits
+	using Bits = uint32_t;
+
+	/**
+	 * \brief EventGroup's constructor
+	 *
+	 * \param [in] bits is the initial value of event bits, default - 0
+	 */
+
+	constexpr explicit EventGroup(const Bits bits = {}) :
+			blockedList_{},
+			bits_{bits}
+	{
+
+	}
+
+	/**
+	 * \brief EventGroup's destructor
+	 *
+	 * It is safe to destroy an event group upon which no threads are currently blocked. The effect of destroying an
+	 * event group upon which other threads are currently blocked is system error.
+	 */
+
+	~EventGroup() = default;
+
+	/**
+	 * \brief Clears selected event bits.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] bits are the event bits which will be cleared
+	 *
+	 * \return value of event bits before clearing
+	 */
+
+	Bits clear(Bits bits);
+
+	/**
+	 * \return current value of event bits
+	 */
+
+	Bits get() const
+	{
+		return bits_;
+	}
+
+	/**
+	 * \brief Sets selected event bits.
+	 *
+	 * All waiting threads whose waits are satisfied are unblocked.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] bits are the event bits which will be set
+	 *
+	 * \return value of event bits before setting
+	 */
+
+	Bits set(Bits bits);
+
+	/**
+	 * \brief Tries to wait for all of selected event bits.
+	 *
+	 * \param [in] bits are the event bits which are checked
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EAGAIN - not all of \a bits are set;
+	 * - EINVAL - \a bits is 0;
+	 */
+
+	std::pair<int, Bits> tryWaitAll(Bits bits, bool clearOnExit = {});
+
+	/**
+	 * \brief Tries to wait for all of selected event bits for given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 * - ETIMEDOUT - not all of \a bits were set before the specified timeout expired;
+	 */
+
+	std::pair<int, Bits> tryWaitAllFor(TickClock::duration duration, Bits bits, bool clearOnExit = {});
+
+	/**
+	 * \brief Tries to wait for all of selected event bits for given duration of time.
+	 *
+	 * Template variant of tryWaitAllFor(TickClock::duration duration, Bits bits, bool clearOnExit).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 * - ETIMEDOUT - not all of \a bits were set before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, Bits> tryWaitAllFor(const std::chrono::duration<Rep, Period> duration, const Bits bits,
+			const bool clearOnExit = {})
+	{
+		return tryWaitAllFor(std::chrono::duration_cast<TickClock::duration>(duration), bits, clearOnExit);
+	}
+
+	/**
+	 * \brief Tries to wait for all of selected event bits until given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 * - ETIMEDOUT - not all of \a bits were set before the specified timeout expired;
+	 */
+
+	std::pair<int, Bits> tryWaitAllUntil(TickClock::time_point timePoint, Bits bits, bool clearOnExit = {});
+
+	/**
+	 * \brief Tries to wait for all of selected event bits until given time point.
+	 *
+	 * Template variant of tryWaitAllUntil(TickClock::time_point timePoint, Bits bits, bool clearOnExit).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 * - ETIMEDOUT - not all of \a bits were set before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	std::pair<int, Bits> tryWaitAllUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const Bits bits, const bool clearOnExit = {})
+	{
+		return tryWaitAllUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), bits, clearOnExit);
+	}
+
+	/**
+	 * \brief Tries to wait for any of selected event bits.
+	 *
+	 * \param [in] bits are the event bits which are checked
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EAGAIN - none of \a bits is set;
+	 * - EINVAL - \a bits is 0;
+	 */
+
+	std::pair<int, Bits> tryWaitAny(Bits bits, bool clearOnExit = {});
+
+	/**
+	 * \brief Tries to wait for any of selected event bits for given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 * - ETIMEDOUT - none of \a bits was set before the specified timeout expired;
+	 */
+
+	std::pair<int, Bits> tryWaitAnyFor(TickClock::duration duration, Bits bits, bool clearOnExit = {});
+
+	/**
+	 * \brief Tries to wait for any of selected event bits for given duration of time.
+	 *
+	 * Template variant of tryWaitAnyFor(TickClock::duration duration, Bits bits, bool clearOnExit).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 * - ETIMEDOUT - none of \a bits was set before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, Bits> tryWaitAnyFor(const std::chrono::duration<Rep, Period> duration, const Bits bits,
+			const bool clearOnExit = {})
+	{
+		return tryWaitAnyFor(std::chrono::duration_cast<TickClock::duration>(duration), bits, clearOnExit);
+	}
+
+	/**
+	 * \brief Tries to wait for any of selected event bits until given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 * - ETIMEDOUT - none of \a bits was set before the specified timeout expired;
+	 */
+
+	std::pair<int, Bits> tryWaitAnyUntil(TickClock::time_point timePoint, Bits bits, bool clearOnExit = {});
+
+	/**
+	 * \brief Tries to wait for any of selected event bits until given time point.
+	 *
+	 * Template variant of tryWaitAnyUntil(TickClock::time_point timePoint, Bits bits, bool clearOnExit).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 * - ETIMEDOUT - none of \a bits was set before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	std::pair<int, Bits> tryWaitAnyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const Bits bits, const bool clearOnExit = {})
+	{
+		return tryWaitAnyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), bits, clearOnExit);
+	}
+
+	/**
+	 * \brief Waits for all of selected event bits.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 */
+
+	std::pair<int, Bits> waitAll(Bits bits, bool clearOnExit = {});
+
+	/**
+	 * \brief Waits for any of selected event bits.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] clearOnExit selects whether \a bits will be cleared if the wait is satisfied, default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 */
+
+	std::pair<int, Bits> waitAny(Bits bits, bool clearOnExit = {});
+
+	EventGroup(const EventGroup&) = delete;
+	EventGroup(EventGroup&&) = default;
+	const EventGroup& operator=(const EventGroup&) = delete;
+	EventGroup& operator=(EventGroup&&) = delete;
+
+private:
+
+	/// flag of wait - all of awaited bits must be set to satisfy the wait
+	constexpr static uint8_t waitAllFlag {1 << 0};
+
+	/// flag of wait - awaited bits are cleared when the wait is satisfied
+	constexpr static uint8_t clearOnExitFlag {1 << 1};
+
+	/**
+	 * \brief Checks whether the wait is satisfied by current value of event bits.
+	 *
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] flags are the flags of wait
+	 *
+	 * \return true if the wait is satisfied, false otherwise
+	 */
+
+	bool isSatisfied(const Bits bits, const uint8_t flags) const
+	{
+		return (flags & waitAllFlag) != 0 ? (bits_ & bits) == bits : (bits_ & bits) != 0;
+	}
+
+	/**
+	 * \brief Internal version of tryWaitAll() and tryWaitAny().
+	 *
+	 * Internal version with no interrupt masking.
+	 *
+	 * \param [in] bits are the event bits which are checked
+	 * \param [in] flags are the flags of wait
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EAGAIN - the wait is not satisfied;
+	 * - EINVAL - \a bits is 0;
+	 */
+
+	std::pair<int, Bits> tryWaitInternal(Bits bits, uint8_t flags);
+
+	/**
+	 * \brief Internal version of all blocking wait functions.
+	 *
+	 * \param [in] bits are the event bits which are awaited
+	 * \param [in] flags are the flags of wait
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, nullptr to wait
+	 * indefinitely
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event bits (which satisfied the
+	 * wait if return code is 0, current value otherwise); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bits is 0;
+	 * - ETIMEDOUT - the wait was not satisfied before the specified timeout expired;
+	 */
+
+	std::pair<int, Bits> waitInternal(Bits bits, uint8_t flags, const TickClock::time_point* timePoint);
+
+	/// ThreadControlBlock objects blocked on this event group
+	internal::ThreadList blockedList_;
+
+	/// current value of event bits
+	Bits bits_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_EVENTGROUP_HPP_
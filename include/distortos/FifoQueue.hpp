@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueue class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 #define INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
 
 #include "distortos/internal/synchronization/FifoQueueBase.hpp"
+#include "distortos/internal/synchronization/BoundQueueBlockFunctor.hpp"
 #include "distortos/internal/synchronization/BoundQueueFunctor.hpp"
 #include "distortos/internal/synchronization/CopyConstructQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MoveConstructQueueFunctor.hpp"
@@ -30,6 +31,8 @@
 namespace distortos
 {
 
+class WaitSet;
+
 /**
  * \brief FifoQueue class is a simple FIFO queue for thread-thread, thread-interrupt or interrupt-interrupt
  * communication. It supports multiple readers and multiple writers. It is implemented as a wrapper for
@@ -43,6 +46,8 @@ namespace distortos
 template<typename T>
 class FifoQueue
 {
+	friend WaitSet;
+
 public:
 
 	/// type of uninitialized storage for data
@@ -116,6 +121,28 @@ public:
 		return popInternal(semaphoreWaitFunctor, value);
 	}
 
+	/**
+	 * \brief Pops up to \a count oldest elements from the queue, waiting until at least one element is available.
+	 *
+	 * All elements are transferred under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popN(T* const values, const size_t count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return popNInternal(semaphoreWaitFunctor, values, count);
+	}
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -153,6 +180,28 @@ public:
 		return pushInternal(semaphoreWaitFunctor, std::move(value));
 	}
 
+	/**
+	 * \brief Pushes up to \a count elements to the queue, waiting until at least one free slot is available.
+	 *
+	 * All elements are transferred under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushN(const T* const values, const size_t count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return pushNInternal(semaphoreWaitFunctor, values, count);
+	}
+
 	/**
 	 * \brief Tries to emplace the element in the queue.
 	 *
@@ -338,6 +387,125 @@ public:
 		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
 	}
 
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue.
+	 *
+	 * All elements are transferred under one critical section.
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopN(T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return popNInternal(semaphoreTryWaitFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue for a given duration of time.
+	 *
+	 * All elements are transferred under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopNFor(const TickClock::duration duration, T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return popNInternal(semaphoreTryWaitForFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopNFor(TickClock::duration, T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopNFor(const std::chrono::duration<Rep, Period> duration, T* const values,
+			const size_t count)
+	{
+		return tryPopNFor(std::chrono::duration_cast<TickClock::duration>(duration), values, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue until a given time point.
+	 *
+	 * All elements are transferred under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopNUntil(const TickClock::time_point timePoint, T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return popNInternal(semaphoreTryWaitUntilFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopNUntil(TickClock::time_point, T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopNUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T* const values,
+			const size_t count)
+	{
+		return tryPopNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, count);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
 	 *
@@ -503,6 +671,126 @@ public:
 		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), std::move(value));
 	}
 
+	/**
+	 * \brief Tries to push up to \a count elements to the queue.
+	 *
+	 * All elements are transferred under one critical section.
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushN(const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return pushNInternal(semaphoreTryWaitFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue for a given duration of time.
+	 *
+	 * All elements are transferred under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushNFor(const TickClock::duration duration, const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return pushNInternal(semaphoreTryWaitForFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushNFor(TickClock::duration, const T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushNFor(const std::chrono::duration<Rep, Period> duration, const T* const values,
+			const size_t count)
+	{
+		return tryPushNFor(std::chrono::duration_cast<TickClock::duration>(duration), values, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue until a given time point.
+	 *
+	 * All elements are transferred under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushNUntil(const TickClock::time_point timePoint, const T* const values,
+			const size_t count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return pushNInternal(semaphoreTryWaitUntilFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushNUntil(TickClock::time_point, const T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushNUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const T* const values, const size_t count)
+	{
+		return tryPushNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, count);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
@@ -627,6 +915,24 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value);
 
+	/**
+	 * \brief Pops up to \a count oldest elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T* values,
+			size_t count);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -658,6 +964,24 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T&& value);
 
+	/**
+	 * \brief Pushes up to \a count elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T* values,
+			size_t count);
+
 	/// contained internal::FifoQueueBase object which implements whole functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
@@ -688,6 +1012,23 @@ int FifoQueue<T>::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFun
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, swapPopQueueFunctor);
 }
 
+template<typename T>
+std::pair<int, size_t> FifoQueue<T>::popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		T* values, const size_t count)
+{
+	const auto swapPopQueueBlockFunctor = internal::makeBoundQueueBlockFunctor(
+			[&values](void* const storage, const size_t blockCount)
+			{
+				const auto block = static_cast<Storage*>(storage);
+				for (size_t i {}; i < blockCount; ++i)
+				{
+					const internal::SwapPopQueueFunctor<T> swapPopQueueFunctor {*values++};
+					swapPopQueueFunctor(block + i);
+				}
+			});
+	return fifoQueueBase_.popN(waitSemaphoreFunctor, swapPopQueueBlockFunctor, count);
+}
+
 template<typename T>
 int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T& value)
 {
@@ -702,6 +1043,23 @@ int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, moveConstructQueueFunctor);
 }
 
+template<typename T>
+std::pair<int, size_t> FifoQueue<T>::pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const T* values, const size_t count)
+{
+	const auto copyConstructQueueBlockFunctor = internal::makeBoundQueueBlockFunctor(
+			[&values](void* const storage, const size_t blockCount)
+			{
+				const auto block = static_cast<Storage*>(storage);
+				for (size_t i {}; i < blockCount; ++i)
+				{
+					const internal::CopyConstructQueueFunctor<T> copyConstructQueueFunctor {*values++};
+					copyConstructQueueFunctor(block + i);
+				}
+			});
+	return fifoQueueBase_.pushN(waitSemaphoreFunctor, copyConstructQueueBlockFunctor, count);
+}
+
 }	// namespace distortos
 
 #endif	// INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
@@ -0,0 +1,328 @@
+/**
+ * \file
+ * \brief Future class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_FUTURE_HPP_
+#define INCLUDE_DISTORTOS_FUTURE_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include <new>
+#include <type_traits>
+
+namespace distortos
+{
+
+/// \addtogroup threads
+/// \{
+
+/**
+ * \brief FutureBase class implements common functionality of Future
+ *
+ * Readiness of the result is signaled with a binary Semaphore. Waiting for the result doesn't consume it, so the
+ * result may be waited for multiple times and by multiple threads.
+ */
+
+class FutureBase
+{
+public:
+
+	/**
+	 * \brief FutureBase's constructor
+	 */
+
+	constexpr FutureBase() :
+			semaphore_{0, 1}
+	{
+
+	}
+
+	/**
+	 * \return true if the result is ready, false otherwise
+	 */
+
+	bool isReady() const
+	{
+		return semaphore_.getValue() != 0;
+	}
+
+	/**
+	 * \brief Tries to wait for the result for given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without the result
+	 *
+	 * \return 0 if the result is ready, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryWaitFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to wait for the result for given duration of time.
+	 *
+	 * Template variant of tryWaitFor(TickClock::duration duration).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without the result
+	 *
+	 * \return 0 if the result is ready, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryWaitFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to wait for the result until given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without the result
+	 *
+	 * \return 0 if the result is ready, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryWaitUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to wait for the result until given time point.
+	 *
+	 * Template variant of tryWaitUntil(TickClock::time_point timePoint).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without the result
+	 *
+	 * \return 0 if the result is ready, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Waits for the result.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the result is ready, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int wait();
+
+	FutureBase(const FutureBase&) = delete;
+	FutureBase(FutureBase&&) = default;
+	const FutureBase& operator=(const FutureBase&) = delete;
+	FutureBase& operator=(FutureBase&&) = delete;
+
+protected:
+
+	/**
+	 * \brief Marks the result as not ready.
+	 */
+
+	void resetReady()
+	{
+		semaphore_.tryWait();
+	}
+
+	/**
+	 * \brief Marks the result as ready and wakes all threads waiting for it.
+	 */
+
+	void setReady()
+	{
+		semaphore_.post();
+	}
+
+private:
+
+	/// binary semaphore which is posted when the result is ready
+	Semaphore semaphore_;
+};
+
+/**
+ * \brief Future class is a result of asynchronous operation - for example a job executed by ThreadPool
+ *
+ * \tparam T is the type of result
+ */
+
+template<typename T>
+class Future : public FutureBase
+{
+public:
+
+	/**
+	 * \brief Future's constructor
+	 */
+
+	constexpr Future() :
+			FutureBase{},
+			storage_{},
+			valid_{}
+	{
+
+	}
+
+	/**
+	 * \brief Future's move constructor
+	 *
+	 * \param [in] other is a rvalue reference to Future used as source of move construction
+	 */
+
+	Future(Future&& other) :
+			FutureBase{std::move(other)},
+			storage_{},
+			valid_{}
+	{
+		if (other.valid_ == false)
+			return;
+
+		new (&storage_) T(std::move(*reinterpret_cast<T*>(&other.storage_)));
+		valid_ = true;
+	}
+
+	/**
+	 * \brief Future's destructor
+	 */
+
+	~Future()
+	{
+		destroyValue();
+	}
+
+	/**
+	 * \brief Waits for the result and returns it.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return reference to the result
+	 */
+
+	T& get()
+	{
+		while (wait() != 0);
+		return *reinterpret_cast<T*>(&storage_);
+	}
+
+protected:
+
+	/**
+	 * \brief Destroys previous result and marks the result as not ready.
+	 */
+
+	void reset()
+	{
+		resetReady();
+		destroyValue();
+	}
+
+	/**
+	 * \brief Executes functor, stores its return value as the result and marks the result as ready.
+	 *
+	 * \tparam Functor is the type of functor
+	 *
+	 * \param [in] functor is a reference to functor which will be executed
+	 */
+
+	template<typename Functor>
+	void setValue(Functor& functor)
+	{
+		new (&storage_) T(functor());
+		valid_ = true;
+		setReady();
+	}
+
+private:
+
+	/**
+	 * \brief Destroys the result, if it was constructed.
+	 */
+
+	void destroyValue()
+	{
+		if (valid_ == false)
+			return;
+
+		reinterpret_cast<T*>(&storage_)->~T();
+		valid_ = false;
+	}
+
+	/// storage for the result
+	typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+
+	/// true if \a storage_ contains constructed result, false otherwise
+	bool valid_;
+};
+
+/**
+ * \brief Future class specialization for asynchronous operations without result
+ */
+
+template<>
+class Future<void> : public FutureBase
+{
+public:
+
+	/**
+	 * \brief Waits for completion of asynchronous operation.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 */
+
+	void get()
+	{
+		while (wait() != 0);
+	}
+
+protected:
+
+	/**
+	 * \brief Marks the operation as not completed.
+	 */
+
+	void reset()
+	{
+		resetReady();
+	}
+
+	/**
+	 * \brief Executes functor and marks the operation as completed.
+	 *
+	 * \tparam Functor is the type of functor
+	 *
+	 * \param [in] functor is a reference to functor which will be executed
+	 */
+
+	template<typename Functor>
+	void setValue(Functor& functor)
+	{
+		functor();
+		setReady();
+	}
+};
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_FUTURE_HPP_
@@ -0,0 +1,61 @@
+/**
+ * \file
+ * \brief Job class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_JOB_HPP_
+#define INCLUDE_DISTORTOS_JOB_HPP_
+
+namespace distortos
+{
+
+class ThreadPool;
+
+/**
+ * \brief Job class is an abstract interface for job, which can be submitted to ThreadPool
+ *
+ * Job is owned by the submitter, so submitting it to thread pool doesn't allocate any memory.
+ *
+ * \ingroup threads
+ */
+
+class Job
+{
+	friend ThreadPool;
+
+public:
+
+	/**
+	 * \brief Job's destructor
+	 */
+
+	virtual ~Job() = 0;
+
+private:
+
+	/**
+	 * \brief "Execute" function of job
+	 *
+	 * This function is executed by worker thread of thread pool. It runs the job and makes its result ready.
+	 */
+
+	virtual void execute() = 0;
+
+	/**
+	 * \brief "Prepare" function of job
+	 *
+	 * This function is executed when the job is submitted to thread pool. It marks the result of job as not ready.
+	 */
+
+	virtual void prepare() = 0;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_JOB_HPP_
@@ -30,6 +30,8 @@
 namespace distortos
 {
 
+class WaitSet;
+
 /**
  * \brief MessageQueue class is a message queue for thread-thread, thread-interrupt or interrupt-interrupt
  * communication. It supports multiple readers and multiple writers. It is implemented as a wrapper for
@@ -45,6 +47,8 @@ namespace distortos
 template<typename T>
 class MessageQueue
 {
+	friend WaitSet;
+
 public:
 
 	/// type of uninitialized storage for Entry with link
@@ -17,6 +17,8 @@
 namespace distortos
 {
 
+class ConditionVariable;
+
 /**
  * \brief Mutex is the basic synchronization primitive
  *
@@ -29,8 +31,13 @@ namespace distortos
 
 class Mutex : private internal::MutexControlBlock
 {
+	friend ConditionVariable;
+
 public:
 
+	/// mode in which mutex is passed to waiting threads
+	using Mode = MutexMode;
+
 	/// mutex protocols
 	using Protocol = MutexProtocol;
 
@@ -64,11 +71,12 @@ public:
 	 * \param [in] protocol is the mutex protocol, default - Protocol::none
 	 * \param [in] priorityCeiling is the priority ceiling of mutex, ignored when protocol != Protocol::priorityProtect,
 	 * default - 0
+	 * \param [in] mode is the mode in which mutex is passed to waiting threads, default - Mode::handoff
 	 */
 
 	constexpr explicit Mutex(const Type type = Type::normal, const Protocol protocol = Protocol::none,
-			const uint8_t priorityCeiling = {}) :
-					MutexControlBlock{type, protocol, priorityCeiling}
+			const uint8_t priorityCeiling = {}, const Mode mode = Mode::handoff) :
+					MutexControlBlock{type, protocol, priorityCeiling, mode}
 	{
 
 	}
@@ -83,10 +91,12 @@ public:
 	 * \param [in] protocol is the mutex protocol
 	 * \param [in] priorityCeiling is the priority ceiling of mutex, ignored when protocol != Protocol::priorityProtect,
 	 * default - 0
+	 * \param [in] mode is the mode in which mutex is passed to waiting threads, default - Mode::handoff
 	 */
 
-	constexpr explicit Mutex(const Protocol protocol, const uint8_t priorityCeiling = {}) :
-			Mutex{Type::normal, protocol, priorityCeiling}
+	constexpr explicit Mutex(const Protocol protocol, const uint8_t priorityCeiling = {},
+			const Mode mode = Mode::handoff) :
+					Mutex{Type::normal, protocol, priorityCeiling, mode}
 	{
 
 	}
@@ -274,6 +284,10 @@ public:
 	 * highest priority thread blocked waiting, then the highest priority thread that has been waiting the longest shall
 	 * be unblocked.
 	 *
+	 * In Mode::handoff the unblocked thread becomes the owner of the mutex. In Mode::competitive the mutex is left
+	 * unlocked and the unblocked thread tries to lock it when it runs, so the current thread (or any other thread which
+	 * runs before) may lock the mutex again without a context switch.
+	 *
 	 * \warning This function must not be called from interrupt context!
 	 *
 	 * \return 0 if the caller successfully unlocked the mutex, error code otherwise:
@@ -289,6 +303,18 @@ public:
 
 private:
 
+	/**
+	 * \brief Checks whether locking must be retried after blocking on the mutex.
+	 *
+	 * \param [in] blockRet is the value returned by internal::MutexControlBlock::doBlock() or
+	 * internal::MutexControlBlock::doBlockUntil()
+	 *
+	 * \return true if the wait was interrupted by a signal or if current thread was unblocked without becoming the owner
+	 * of the mutex (Mode::competitive), false otherwise
+	 */
+
+	bool isRetryRequired(int blockRet) const;
+
 	/**
 	 * \brief Internal version of tryLock().
 	 *
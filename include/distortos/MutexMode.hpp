@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief MutexMode enum class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_MUTEXMODE_HPP_
+#define INCLUDE_DISTORTOS_MUTEXMODE_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+/// mode in which mutex is passed to threads waiting for it
+enum class MutexMode : uint8_t
+{
+	/// unlock transfers ownership to the highest priority waiting thread, which gets the mutex even if it is not
+	/// scheduled immediately
+	handoff,
+	/// unlock only wakes the highest priority waiting thread, which competes for the mutex when it runs - the mutex may
+	/// be locked again by a running thread in the meantime, which prevents lock convoys
+	competitive,
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_MUTEXMODE_HPP_
@@ -0,0 +1,40 @@
+/**
+ * \file
+ * \brief NotificationAction enum class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_NOTIFICATIONACTION_HPP_
+#define INCLUDE_DISTORTOS_NOTIFICATIONACTION_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+/**
+ * \brief action performed on notification value of the thread by Thread::notify()
+ *
+ * \ingroup threads
+ */
+
+enum class NotificationAction : uint8_t
+{
+	/// bits of value are set in notification value
+	setBits,
+	/// notification value is incremented by value
+	increment,
+	/// notification value is overwritten with value, even if previous notification is still pending
+	overwrite,
+	/// notification value is overwritten with value only if there is no pending notification
+	tryOverwrite,
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_NOTIFICATIONACTION_HPP_
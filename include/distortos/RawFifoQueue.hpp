@@ -2,7 +2,7 @@
  * \file
  * \brief RawFifoQueue class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -17,6 +17,8 @@
 namespace distortos
 {
 
+class WaitSet;
+
 /**
  * \brief RawFifoQueue class is very similar to FifoQueue, but optimized for binary serializable types (like POD types).
  *
@@ -29,6 +31,8 @@ namespace distortos
 
 class RawFifoQueue
 {
+	friend WaitSet;
+
 public:
 
 	/// unique_ptr (with deleter) to storage
@@ -82,6 +86,48 @@ public:
 		return pop(&buffer, sizeof(buffer));
 	}
 
+	/**
+	 * \brief Pops up to \a count oldest elements from the queue, waiting until at least one element is available.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks, all under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is a pointer to array for popped elements
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popN(void* buffer, size_t size, size_t count);
+
+	/**
+	 * \brief Pops up to \a count oldest elements from the queue, waiting until at least one element is available.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a pointer to array of objects that will be used to return popped values
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename T>
+	std::pair<int, size_t> popN(T* const buffer, const size_t count)
+	{
+		return popN(buffer, sizeof(*buffer), count);
+	}
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -119,6 +165,48 @@ public:
 		return push(&data, sizeof(data));
 	}
 
+	/**
+	 * \brief Pushes up to \a count elements to the queue, waiting until at least one free slot is available.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks, all under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] data is a pointer to array with elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushN(const void* data, size_t size, size_t count);
+
+	/**
+	 * \brief Pushes up to \a count elements to the queue, waiting until at least one free slot is available.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a pointer to array with objects that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename T>
+	std::pair<int, size_t> pushN(const T* const data, const size_t count)
+	{
+		return pushN(data, sizeof(*data), count);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue.
 	 *
@@ -219,6 +307,195 @@ public:
 		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), &buffer, sizeof(buffer));
 	}
 
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks, all under one critical section.
+	 *
+	 * \param [out] buffer is a pointer to array for popped elements
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopN(void* buffer, size_t size, size_t count);
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue.
+	 *
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a pointer to array of objects that will be used to return popped values
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename T>
+	std::pair<int, size_t> tryPopN(T* const buffer, const size_t count)
+	{
+		return tryPopN(buffer, sizeof(*buffer), count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue for a given duration of time.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks, all under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to array for popped elements
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopNFor(TickClock::duration duration, void* buffer, size_t size, size_t count);
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopNFor(TickClock::duration, void*, size_t, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to array for popped elements
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopNFor(const std::chrono::duration<Rep, Period> duration, void* const buffer,
+			const size_t size, const size_t count)
+	{
+		return tryPopNFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to array of objects that will be used to return popped values
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period, typename T>
+	std::pair<int, size_t> tryPopNFor(const std::chrono::duration<Rep, Period> duration, T* const buffer,
+			const size_t count)
+	{
+		return tryPopNFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, sizeof(*buffer), count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue until a given time point.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks, all under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to array for popped elements
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopNUntil(TickClock::time_point timePoint, void* buffer, size_t size, size_t count);
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopNUntil(TickClock::time_point, void*, size_t, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to array for popped elements
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopNUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			void* const buffer, const size_t size, const size_t count)
+	{
+		return tryPopNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to array of objects that will be used to return popped values
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration, typename T>
+	std::pair<int, size_t> tryPopNUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T* const buffer,
+			const size_t count)
+	{
+		return tryPopNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, sizeof(*buffer),
+				count);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
 	 *
@@ -384,6 +661,194 @@ public:
 		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Tries to push up to \a count elements to the queue.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks, all under one critical section.
+	 *
+	 * \param [in] data is a pointer to array with elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushN(const void* data, size_t size, size_t count);
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue.
+	 *
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a pointer to array with objects that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename T>
+	std::pair<int, size_t> tryPushN(const T* const data, const size_t count)
+	{
+		return tryPushN(data, sizeof(*data), count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue for a given duration of time.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks, all under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to array with elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushNFor(TickClock::duration duration, const void* data, size_t size, size_t count);
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushNFor(TickClock::duration, const void*, size_t, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to array with elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushNFor(const std::chrono::duration<Rep, Period> duration, const void* const data,
+			const size_t size, const size_t count)
+	{
+		return tryPushNFor(std::chrono::duration_cast<TickClock::duration>(duration), data, size, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to array with objects that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period, typename T>
+	std::pair<int, size_t> tryPushNFor(const std::chrono::duration<Rep, Period> duration, const T* const data,
+			const size_t count)
+	{
+		return tryPushNFor(std::chrono::duration_cast<TickClock::duration>(duration), data, sizeof(*data), count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue until a given time point.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks, all under one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to array with elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushNUntil(TickClock::time_point timePoint, const void* data, size_t size, size_t count);
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushNUntil(TickClock::time_point, const void*, size_t, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to array with elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushNUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const void* const data, const size_t size, const size_t count)
+	{
+		return tryPushNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, size, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to array with objects that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration, typename T>
+	std::pair<int, size_t> tryPushNUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const T* const data, const size_t count)
+	{
+		return tryPushNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, sizeof(*data), count);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
@@ -469,6 +934,26 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer, size_t size);
 
+	/**
+	 * \brief Pops up to \a count oldest elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] buffer is a pointer to array for popped elements
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer,
+			size_t size, size_t count);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -486,6 +971,26 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data, size_t size);
 
+	/**
+	 * \brief Pushes up to \a count elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] data is a pointer to array with elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data,
+			size_t size, size_t count);
+
 	/// contained internal::FifoQueueBase object which implements base functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
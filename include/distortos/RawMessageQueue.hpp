@@ -17,6 +17,8 @@
 namespace distortos
 {
 
+class WaitSet;
+
 /**
  * \brief RawMessageQueue class is very similar to MessageQueue, but optimized for binary serializable types (like POD
  * types).
@@ -32,6 +34,8 @@ namespace distortos
 
 class RawMessageQueue
 {
+	friend WaitSet;
+
 public:
 
 	/// type of uninitialized storage for Entry with link
@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -19,16 +19,34 @@
 namespace distortos
 {
 
+class WaitSet;
+
+namespace internal
+{
+
+class WaitSetControlBlock;
+
+}	// namespace internal
+
 /**
  * \brief Semaphore is the basic synchronization primitive
  *
  * Similar to POSIX semaphores - http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/V1_chap04.html#tag_04_16
  *
+ * Lock and unlock operations with "N" suffix (postN(), tryWaitN(), tryWaitNFor(), tryWaitNUntil() and waitN()) take
+ * the number of units, so that multiple units of the semaphore can be acquired or released with single critical
+ * section. Thread waiting for multiple units is unblocked only when all of them are available at once - postN()
+ * unblocks (in priority order) all waiting threads whose requests can be satisfied, skipping those which request more
+ * units than currently available. Threads requesting large number of
+ * units may therefore be starved by threads requesting small number of units.
+ *
  * \ingroup synchronization
  */
 
 class Semaphore
 {
+	friend WaitSet;
+
 public:
 
 	/// type used for semaphore's "value"
@@ -48,7 +66,8 @@ public:
 	constexpr explicit Semaphore(const Value value, const Value maxValue = std::numeric_limits<Value>::max()) :
 			blockedList_{},
 			value_{value < maxValue ? value : maxValue},
-			maxValue_{maxValue}
+			maxValue_{maxValue},
+			waitSetControlBlock_{}
 	{
 
 	}
@@ -95,6 +114,22 @@ public:
 
 	int post();
 
+	/**
+	 * \brief Unlocks the semaphore by multiple units.
+	 *
+	 * The semaphore value is incremented by \a value with single critical section and all waiting threads whose
+	 * requests can be satisfied are unblocked - in the order described in post(), skipping threads which request more
+	 * units than are currently available. If some units are still available after that and the semaphore is waited
+	 * for by a WaitSet, the thread waiting on that WaitSet is unblocked.
+	 *
+	 * \param [in] value is the number of units by which the semaphore will be unlocked
+	 *
+	 * \return 0 if the calling process successfully "posted" the semaphore, error code otherwise:
+	 * - EOVERFLOW - the maximum allowable value for a semaphore would be exceeded;
+	 */
+
+	int postN(Value value);
+
 	/**
 	 * \brief Tries to lock the semaphore.
 	 *
@@ -156,6 +191,106 @@ public:
 		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration));
 	}
 
+	/**
+	 * \brief Tries to lock multiple units of the semaphore.
+	 *
+	 * Similar to tryWait(), but either all \a value units are locked or none.
+	 *
+	 * \param [in] value is the number of units which will be locked
+	 *
+	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EAGAIN - semaphore value is lower than \a value, so it cannot be immediately locked by the tryWaitN()
+	 * operation;
+	 * - EINVAL - \a value is greater than 1 and greater than max value of the semaphore;
+	 */
+
+	int tryWaitN(Value value);
+
+	/**
+	 * \brief Tries to lock multiple units of the semaphore for given duration of time.
+	 *
+	 * Similar to tryWaitFor(TickClock::duration duration), but either all \a value units are locked or none.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the semaphore
+	 * \param [in] value is the number of units which will be locked
+	 *
+	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a value is greater than 1 and greater than max value of the semaphore;
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	int tryWaitNFor(TickClock::duration duration, Value value);
+
+	/**
+	 * \brief Tries to lock multiple units of the semaphore for given duration of time.
+	 *
+	 * Template variant of tryWaitNFor(TickClock::duration duration, Value value).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the semaphore
+	 * \param [in] value is the number of units which will be locked
+	 *
+	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a value is greater than 1 and greater than max value of the semaphore;
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryWaitNFor(const std::chrono::duration<Rep, Period> duration, const Value value)
+	{
+		return tryWaitNFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
+	}
+
+	/**
+	 * \brief Tries to lock multiple units of the semaphore until given time point.
+	 *
+	 * Similar to tryWaitUntil(TickClock::time_point timePoint), but either all \a value units are locked or none.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the semaphore
+	 * \param [in] value is the number of units which will be locked
+	 *
+	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a value is greater than 1 and greater than max value of the semaphore;
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	int tryWaitNUntil(TickClock::time_point timePoint, Value value);
+
+	/**
+	 * \brief Tries to lock multiple units of the semaphore until given time point.
+	 *
+	 * Template variant of tryWaitNUntil(TickClock::time_point timePoint, Value value).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the semaphore
+	 * \param [in] value is the number of units which will be locked
+	 *
+	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a value is greater than 1 and greater than max value of the semaphore;
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryWaitNUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const Value value)
+	{
+		return tryWaitNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value);
+	}
+
 	/**
 	 * \brief Tries to lock the semaphore until given time point.
 	 *
@@ -219,6 +354,22 @@ public:
 
 	int wait();
 
+	/**
+	 * \brief Locks multiple units of the semaphore.
+	 *
+	 * Similar to wait(), but the calling thread doesn't return until it locks all \a value units at once.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] value is the number of units which will be locked
+	 *
+	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a value is greater than 1 and greater than max value of the semaphore;
+	 */
+
+	int waitN(Value value);
+
 	Semaphore(const Semaphore&) = delete;
 	Semaphore(Semaphore&&) = default;
 	const Semaphore& operator=(const Semaphore&) = delete;
@@ -227,15 +378,19 @@ public:
 private:
 
 	/**
-	 * \brief Internal version of tryWait().
+	 * \brief Internal version of tryWait() and tryWaitN().
+	 *
+	 * Internal version with no interrupt masking. If architecture supports exclusive access, the value is decreased
+	 * atomically, so this function may also be used without masking interrupts.
 	 *
-	 * Internal version with no interrupt masking.
+	 * \param [in] value is the number of units which will be locked, either all of them are locked or none
 	 *
 	 * \return 0 if the calling process successfully performed the semaphore lock operation, error code otherwise:
 	 * - EAGAIN - semaphore was already locked, so it cannot be immediately locked by the tryWait() operation;
+	 * - EINVAL - \a value is greater than 1 and greater than max value of the semaphore;
 	 */
 
-	int tryWaitInternal();
+	int tryWaitInternal(Value value);
 
 	/// ThreadControlBlock objects blocked on this semaphore
 	internal::ThreadList blockedList_;
@@ -245,6 +400,9 @@ private:
 
 	/// max value of the semaphore
 	Value maxValue_;
+
+	/// pointer to control block of wait set which waits for this semaphore, nullptr if none
+	internal::WaitSetControlBlock* waitSetControlBlock_;
 };
 
 }	// namespace distortos
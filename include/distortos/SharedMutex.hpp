@@ -0,0 +1,356 @@
+/**
+ * \file
+ * \brief SharedMutex class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_SHAREDMUTEX_HPP_
+#define INCLUDE_DISTORTOS_SHAREDMUTEX_HPP_
+
+#include "distortos/internal/synchronization/SharedMutexControlBlock.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief SharedMutex is a synchronization primitive which may be locked exclusively by single writer or shared by
+ * multiple readers
+ *
+ * Similar to std::shared_timed_mutex - http://en.cppreference.com/w/cpp/thread/shared_timed_mutex
+ * Similar to POSIX pthread_rwlock_t
+ *
+ * Readers don't serialize on each other - any number of them (limited only by the number of slots provided in the
+ * constructor) may hold the lock at the same time. Writers are preferred - when any writer is waiting, new readers are
+ * blocked, and the lock is handed over directly to the highest priority waiting writer as soon as the last owner
+ * releases it. Threads blocked on the shared mutex boost the priority of all its current owners (priority inheritance).
+ *
+ * \ingroup synchronization
+ */
+
+class SharedMutex : private internal::SharedMutexControlBlock
+{
+public:
+
+	/// type of uninitialized storage for slots of owners
+	using Storage = SharedMutexControlBlock::Storage;
+
+	/// unique_ptr (with deleter) to Storage[]
+	using StorageUniquePointer = SharedMutexControlBlock::StorageUniquePointer;
+
+	/**
+	 * \brief SharedMutex's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for slots of owners
+	 * (sufficiently large for \a maxReaders elements) and appropriate deleter
+	 * \param [in] maxReaders is the maximum number of readers which may hold the lock at the same time, must be greater
+	 * than 0
+	 */
+
+	SharedMutex(StorageUniquePointer&& storageUniquePointer, size_t maxReaders);
+
+	/**
+	 * \brief SharedMutex's destructor
+	 *
+	 * Similar to std::shared_timed_mutex::~shared_timed_mutex() -
+	 * http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/~shared_timed_mutex
+	 *
+	 * Attempting to destroy a locked shared mutex, or a shared mutex that another thread is attempting to lock, results
+	 * in undefined behavior.
+	 */
+
+	~SharedMutex();
+
+	/**
+	 * \brief Locks the shared mutex exclusively.
+	 *
+	 * Similar to std::shared_timed_mutex::lock() - http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/lock
+	 * Similar to pthread_rwlock_wrlock()
+	 *
+	 * If the shared mutex is already locked by any thread (exclusively or shared), the calling thread shall block until
+	 * the lock is handed over to it.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 */
+
+	int lock();
+
+	/**
+	 * \brief Locks the shared mutex for shared ownership.
+	 *
+	 * Similar to std::shared_timed_mutex::lock_shared() -
+	 * http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/lock_shared
+	 * Similar to pthread_rwlock_rdlock()
+	 *
+	 * If the shared mutex is locked exclusively, if any writer is waiting for it or if maximum number of readers already
+	 * hold the lock, the calling thread shall block until the lock is handed over to it.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 */
+
+	int lockShared();
+
+	/**
+	 * \brief Tries to lock the shared mutex exclusively.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock() -
+	 * http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock
+	 * Similar to pthread_rwlock_trywrlock()
+	 *
+	 * This function shall be equivalent to lock(), except that if the shared mutex cannot be locked immediately (also
+	 * when it is already owned by the current thread), the call shall return immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EBUSY - the shared mutex could not be locked immediately;
+	 */
+
+	int tryLock();
+
+	/**
+	 * \brief Tries to lock the shared mutex exclusively for given duration of time.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_for() -
+	 * http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_for
+	 * Similar to pthread_rwlock_timedwrlock()
+	 *
+	 * Similar to lock(), but the wait is terminated when given duration of time expires. Under no circumstance shall the
+	 * function fail with a timeout if the shared mutex can be locked immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the shared mutex
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 * - ETIMEDOUT - the shared mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to lock the shared mutex exclusively for given duration of time.
+	 *
+	 * Template variant of tryLockFor(TickClock::duration duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the shared mutex
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 * - ETIMEDOUT - the shared mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryLockFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryLockFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to lock the shared mutex for shared ownership.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_shared() -
+	 * http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared
+	 * Similar to pthread_rwlock_tryrdlock()
+	 *
+	 * This function shall be equivalent to lockShared(), except that if the shared mutex cannot be locked immediately
+	 * (also when it is already owned by the current thread), the call shall return immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EBUSY - the shared mutex could not be locked immediately;
+	 */
+
+	int tryLockShared();
+
+	/**
+	 * \brief Tries to lock the shared mutex for shared ownership for given duration of time.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_shared_for() -
+	 * http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared_for
+	 * Similar to pthread_rwlock_timedrdlock()
+	 *
+	 * Similar to lockShared(), but the wait is terminated when given duration of time expires. Under no circumstance
+	 * shall the function fail with a timeout if the shared mutex can be locked immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the shared mutex
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 * - ETIMEDOUT - the shared mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockSharedFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to lock the shared mutex for shared ownership for given duration of time.
+	 *
+	 * Template variant of tryLockSharedFor(TickClock::duration duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the shared mutex
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 * - ETIMEDOUT - the shared mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryLockSharedFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryLockSharedFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to lock the shared mutex for shared ownership until given time point.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_shared_until() -
+	 * http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared_until
+	 * Similar to pthread_rwlock_timedrdlock()
+	 *
+	 * Similar to lockShared(), but the wait is terminated at given time point. Under no circumstance shall the function
+	 * fail with a timeout if the shared mutex can be locked immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the shared mutex
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 * - ETIMEDOUT - the shared mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockSharedUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to lock the shared mutex for shared ownership until given time point.
+	 *
+	 * Template variant of tryLockSharedUntil(TickClock::time_point timePoint).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the shared mutex
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 * - ETIMEDOUT - the shared mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryLockSharedUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryLockSharedUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Tries to lock the shared mutex exclusively until given time point.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_until() -
+	 * http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_until
+	 * Similar to pthread_rwlock_timedwrlock()
+	 *
+	 * Similar to lock(), but the wait is terminated at given time point. Under no circumstance shall the function fail
+	 * with a timeout if the shared mutex can be locked immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the shared mutex
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 * - ETIMEDOUT - the shared mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to lock the shared mutex exclusively until given time point.
+	 *
+	 * Template variant of tryLockUntil(TickClock::time_point timePoint).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the shared mutex
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EDEADLK - the current thread already owns the shared mutex (exclusively or shared);
+	 * - ETIMEDOUT - the shared mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryLockUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryLockUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Unlocks the shared mutex which was locked exclusively.
+	 *
+	 * Similar to std::shared_timed_mutex::unlock() - http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/unlock
+	 * Similar to pthread_rwlock_unlock()
+	 *
+	 * If any writer is waiting, the lock is handed over to the highest priority one. Otherwise the lock is handed over
+	 * to waiting readers, in priority order.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully unlocked the shared mutex, error code otherwise:
+	 * - EPERM - the current thread does not own the shared mutex exclusively;
+	 */
+
+	int unlock();
+
+	/**
+	 * \brief Unlocks the shared mutex which was locked for shared ownership.
+	 *
+	 * Similar to std::shared_timed_mutex::unlock_shared() -
+	 * http://en.cppreference.com/w/cpp/thread/shared_timed_mutex/unlock_shared
+	 * Similar to pthread_rwlock_unlock()
+	 *
+	 * If any writer is waiting and the current thread is the last reader, the lock is handed over to the highest
+	 * priority writer. Otherwise the released slot is handed over to the highest priority waiting reader (if any).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully unlocked the shared mutex, error code otherwise:
+	 * - EPERM - the current thread does not own the shared mutex for shared ownership;
+	 */
+
+	int unlockShared();
+
+	SharedMutex(const SharedMutex&) = delete;
+	SharedMutex(SharedMutex&&) = delete;
+	const SharedMutex& operator=(const SharedMutex&) = delete;
+	SharedMutex& operator=(SharedMutex&&) = delete;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SHAREDMUTEX_HPP_
@@ -0,0 +1,368 @@
+/**
+ * \file
+ * \brief SpscRingQueue class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_SPSCRINGQUEUE_HPP_
+#define INCLUDE_DISTORTOS_SPSCRINGQUEUE_HPP_
+
+#include "distortos/internal/synchronization/SpscRingQueueBase.hpp"
+#include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/**
+ * \brief SpscRingQueue class is a lock-free FIFO queue for communication between exactly one producer and exactly one
+ * consumer. It is implemented as a wrapper for internal::SpscRingQueueBase.
+ *
+ * Producer side is wait-free and doesn't mask interrupts (unless it has to unblock the consumer), so it can be used in
+ * interrupt context with high rate of data, e.g. to stream samples from ISR to thread. Consumer side may block until
+ * the data is available. Elements may be transferred in bulk or accessed directly in queue's storage with
+ * getReadBlock() / increaseReadPosition() and getWriteBlock() / increaseWritePosition().
+ *
+ * \warning All producer functions must be called from the same context (one thread or one interrupt) and all consumer
+ * functions must be called from the same thread!
+ *
+ * \tparam T is the type of data in queue, must be trivially copyable
+ *
+ * \ingroup queues
+ */
+
+template<typename T>
+class SpscRingQueue
+{
+	static_assert(std::is_trivially_copyable<T>::value == true, "SpscRingQueue supports only trivially copyable types!");
+
+public:
+
+	/// type of uninitialized storage for data
+	using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+	/// unique_ptr (with deleter) to Storage[]
+	using StorageUniquePointer =
+			std::unique_ptr<Storage[], internal::SpscRingQueueBase::StorageUniquePointer::deleter_type>;
+
+	/**
+	 * \brief SpscRingQueue's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for queue elements
+	 * (sufficiently large for \a maxElements, each sizeof(T) bytes long) and appropriate deleter
+	 * \param [in] maxElements is the number of elements in storage array
+	 */
+
+	SpscRingQueue(StorageUniquePointer&& storageUniquePointer, const size_t maxElements) :
+			spscRingQueueBase_{{storageUniquePointer.release(), storageUniquePointer.get_deleter()}, sizeof(T),
+					maxElements}
+	{
+
+	}
+
+	/**
+	 * \return maximum number of elements in the queue
+	 */
+
+	size_t getCapacity() const
+	{
+		return spscRingQueueBase_.getCapacity();
+	}
+
+	/**
+	 * \brief Gets first contiguous block of elements available for reading.
+	 *
+	 * \warning This function may be called only by the consumer!
+	 *
+	 * \return first contiguous block (as a pair with pointer and number of elements) available for reading
+	 */
+
+	std::pair<const T*, size_t> getReadBlock() const
+	{
+		const auto readBlock = spscRingQueueBase_.getReadBlock();
+		return {static_cast<const T*>(readBlock.first), readBlock.second};
+	}
+
+	/**
+	 * \brief Gets number of elements in the queue.
+	 *
+	 * \note Value returned by this function is only a snapshot - it may already be outdated when this function
+	 * returns.
+	 *
+	 * \return number of elements in the queue
+	 */
+
+	size_t getSize() const
+	{
+		return spscRingQueueBase_.getSize();
+	}
+
+	/**
+	 * \brief Gets first contiguous block of free slots available for writing.
+	 *
+	 * \warning This function may be called only by the producer!
+	 *
+	 * \return first contiguous block (as a pair with pointer and number of elements) available for writing
+	 */
+
+	std::pair<T*, size_t> getWriteBlock() const
+	{
+		const auto writeBlock = spscRingQueueBase_.getWriteBlock();
+		return {static_cast<T*>(writeBlock.first), writeBlock.second};
+	}
+
+	/**
+	 * \brief Releases elements read from block returned by getReadBlock().
+	 *
+	 * \warning This function may be called only by the consumer!
+	 *
+	 * \param [in] value is the number of elements which will be released, must not be greater than the size of block
+	 * returned by previous call to getReadBlock()
+	 */
+
+	void increaseReadPosition(const size_t value)
+	{
+		spscRingQueueBase_.increaseReadPosition(value);
+	}
+
+	/**
+	 * \brief Publishes elements written to block returned by getWriteBlock().
+	 *
+	 * If the consumer is blocked waiting for data, it is unblocked.
+	 *
+	 * \warning This function may be called only by the producer!
+	 *
+	 * \param [in] value is the number of elements which will be published, must not be greater than the size of block
+	 * returned by previous call to getWriteBlock()
+	 */
+
+	void increaseWritePosition(const size_t value)
+	{
+		spscRingQueueBase_.increaseWritePosition(value);
+	}
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * \warning This function may be called only by the consumer and it must not be called from interrupt context!
+	 *
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int pop(T& value)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return popInternal(semaphoreWaitFunctor, value);
+	}
+
+	/**
+	 * \brief Pops up to \a count oldest elements from the queue, waiting until at least one element is available.
+	 *
+	 * \warning This function may be called only by the consumer and it must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is a pointer to array for popped elements
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, size_t> popN(T* const buffer, const size_t count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		const auto ret = spscRingQueueBase_.wait(semaphoreWaitFunctor);
+		if (ret != 0)
+			return {ret, {}};
+
+		return {{}, tryPopN(buffer, count)};
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * \warning This function may be called only by the consumer!
+	 *
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EAGAIN - the queue is empty;
+	 */
+
+	int tryPop(T& value)
+	{
+		return tryPopN(&value, 1) != 0 ? 0 : EAGAIN;
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * \warning This function may be called only by the consumer and it must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopFor(const TickClock::duration duration, T& value)
+	{
+		return tryPopUntil(TickClock::now() + duration + TickClock::duration{1}, value);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopFor(TickClock::duration, T&).
+	 *
+	 * \warning This function may be called only by the consumer and it must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& value)
+	{
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count oldest elements from the queue.
+	 *
+	 * Elements are copied in at most two chunks.
+	 *
+	 * \warning This function may be called only by the consumer!
+	 *
+	 * \param [out] buffer is a pointer to array for popped elements
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return number of popped elements, 0 if the queue is empty
+	 */
+
+	size_t tryPopN(T* const buffer, const size_t count)
+	{
+		return spscRingQueueBase_.pop(buffer, count);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * \warning This function may be called only by the consumer and it must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopUntil(const TickClock::time_point timePoint, T& value)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return popInternal(semaphoreTryWaitUntilFunctor, value);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * Template variant of tryPopUntil(TickClock::time_point, T&).
+	 *
+	 * \warning This function may be called only by the consumer and it must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& value)
+	{
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * This function is wait-free and may be used in interrupt context.
+	 *
+	 * \warning This function may be called only by the producer!
+	 *
+	 * \param [in] value is a reference to object that will be pushed
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - the queue is full;
+	 */
+
+	int tryPush(const T& value)
+	{
+		return tryPushN(&value, 1) != 0 ? 0 : EAGAIN;
+	}
+
+	/**
+	 * \brief Tries to push up to \a count elements to the queue.
+	 *
+	 * Elements are copied in at most two chunks. This function is wait-free and may be used in interrupt context.
+	 *
+	 * \warning This function may be called only by the producer!
+	 *
+	 * \param [in] data is a pointer to array with elements which will be pushed
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return number of pushed elements, 0 if the queue is full
+	 */
+
+	size_t tryPushN(const T* const data, const size_t count)
+	{
+		return spscRingQueueBase_.push(data, count);
+	}
+
+private:
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be used to wait for data
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value)
+	{
+		const auto ret = spscRingQueueBase_.wait(waitSemaphoreFunctor);
+		if (ret != 0)
+			return ret;
+
+		tryPopN(&value, 1);
+		return 0;
+	}
+
+	/// contained internal::SpscRingQueueBase object which implements whole functionality
+	internal::SpscRingQueueBase spscRingQueueBase_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SPSCRINGQUEUE_HPP_
@@ -0,0 +1,120 @@
+/**
+ * \file
+ * \brief StaticJob class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICJOB_HPP_
+#define INCLUDE_DISTORTOS_STATICJOB_HPP_
+
+#include "distortos/Future.hpp"
+#include "distortos/Job.hpp"
+
+#include <functional>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/// type of function object bound with std::bind() from \a Function and \a Args
+template<typename Function, typename... Args>
+using BoundFunction = decltype(std::bind(std::declval<Function>(), std::declval<Args>()...));
+
+/// decayed type of value returned by function object bound with std::bind() from \a Function and \a Args
+template<typename Function, typename... Args>
+using BoundFunctionResult =
+		typename std::decay<decltype(std::declval<BoundFunction<Function, Args...>&>()())>::type;
+
+}	// namespace internal
+
+/// \addtogroup threads
+/// \{
+
+/**
+ * \brief StaticJob class is a templated interface for job with its result
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for function
+ */
+
+template<typename Function, typename... Args>
+class StaticJob : public Job, public Future<internal::BoundFunctionResult<Function, Args...>>
+{
+public:
+
+	/// type of result of job
+	using Result = internal::BoundFunctionResult<Function, Args...>;
+
+	/**
+	 * \brief StaticJob's constructor
+	 *
+	 * \param [in] function is a function that will be executed by worker thread of thread pool
+	 * \param [in] args are arguments for function
+	 */
+
+	StaticJob(Function&& function, Args&&... args) :
+			Job{},
+			Future<Result>{},
+			boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief "Execute" function of job
+	 *
+	 * Executes bound function object and stores its return value as the result.
+	 */
+
+	void execute() override
+	{
+		Future<Result>::setValue(boundFunction_);
+	}
+
+	/**
+	 * \brief "Prepare" function of job
+	 *
+	 * Destroys previous result and marks the result as not ready.
+	 */
+
+	void prepare() override
+	{
+		Future<Result>::reset();
+	}
+
+	/// bound function object
+	internal::BoundFunction<Function, Args...> boundFunction_;
+};
+
+/**
+ * \brief Helper factory function to make StaticJob object with deduced template arguments
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for function
+ *
+ * \param [in] function is a function that will be executed by worker thread of thread pool
+ * \param [in] args are arguments for function
+ *
+ * \return StaticJob object with deduced template arguments
+ */
+
+template<typename Function, typename... Args>
+StaticJob<Function, Args...> makeStaticJob(Function&& function, Args&&... args)
+{
+	return {std::forward<Function>(function), std::forward<Args>(args)...};
+}
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICJOB_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief StaticMessageQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,6 +16,8 @@
 
 #include "distortos/internal/memory/dummyDeleter.hpp"
 
+#include <array>
+
 namespace distortos
 {
 
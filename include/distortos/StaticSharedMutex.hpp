@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \brief StaticSharedMutex class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICSHAREDMUTEX_HPP_
+#define INCLUDE_DISTORTOS_STATICSHAREDMUTEX_HPP_
+
+#include "distortos/SharedMutex.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticSharedMutex class is a variant of SharedMutex that has automatic storage for slots of owners.
+ *
+ * \tparam MaxReaders is the maximum number of readers which may hold the lock at the same time, must be greater than 0
+ *
+ * \ingroup synchronization
+ */
+
+template<size_t MaxReaders>
+class StaticSharedMutex : public SharedMutex
+{
+public:
+
+	static_assert(MaxReaders > 0, "Maximum number of readers must be greater than 0!");
+
+	/**
+	 * \brief StaticSharedMutex's constructor
+	 */
+
+	explicit StaticSharedMutex() :
+			SharedMutex{{storage_.data(), internal::dummyDeleter<Storage>}, storage_.size()}
+	{
+
+	}
+
+private:
+
+	/// storage for slots of owners
+	std::array<Storage, MaxReaders> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICSHAREDMUTEX_HPP_
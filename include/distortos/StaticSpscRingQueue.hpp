@@ -0,0 +1,59 @@
+/**
+ * \file
+ * \brief StaticSpscRingQueue class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICSPSCRINGQUEUE_HPP_
+#define INCLUDE_DISTORTOS_STATICSPSCRINGQUEUE_HPP_
+
+#include "SpscRingQueue.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticSpscRingQueue class is a variant of SpscRingQueue that has automatic storage for queue's contents.
+ *
+ * \tparam T is the type of data in queue, must be trivially copyable
+ * \tparam QueueSize is the maximum number of elements in queue
+ *
+ * \ingroup queues
+ */
+
+template<typename T, size_t QueueSize>
+class StaticSpscRingQueue : public SpscRingQueue<T>
+{
+public:
+
+	/// import Storage type from base class
+	using typename SpscRingQueue<T>::Storage;
+
+	/**
+	 * \brief StaticSpscRingQueue's constructor
+	 */
+
+	explicit StaticSpscRingQueue() :
+			SpscRingQueue<T>{{storage_.data(), internal::dummyDeleter<Storage>}, storage_.size()}
+	{
+
+	}
+
+private:
+
+	/// storage for queue's contents
+	std::array<Storage, QueueSize> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICSPSCRINGQUEUE_HPP_
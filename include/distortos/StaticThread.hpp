@@ -2,7 +2,7 @@
  * \file
  * \brief StaticThread class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -96,9 +96,10 @@ protected:
 
 private:
 
-	/// size of stack adjusted to alignment requirements, bytes
-	constexpr static size_t adjustedStackSize {(StackSize + CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) /
-			CONFIG_ARCHITECTURE_STACK_ALIGNMENT * CONFIG_ARCHITECTURE_STACK_ALIGNMENT};
+	/// size of stack increased by architecture-specific overhead and adjusted to alignment requirements, bytes
+	constexpr static size_t adjustedStackSize {(StackSize + CONFIG_ARCHITECTURE_STACK_OVERHEAD +
+			CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) / CONFIG_ARCHITECTURE_STACK_ALIGNMENT *
+			CONFIG_ARCHITECTURE_STACK_ALIGNMENT};
 
 	/// stack buffer
 	alignas(CONFIG_ARCHITECTURE_STACK_ALIGNMENT)
@@ -0,0 +1,303 @@
+/**
+ * \file
+ * \brief ThisThread::Notifications namespace header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_THISTHREAD_NOTIFICATIONS_HPP_
+#define INCLUDE_DISTORTOS_THISTHREAD_NOTIFICATIONS_HPP_
+
+#include "distortos/TickClock.hpp"
+
+#include <utility>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace ThisThread
+{
+
+/**
+ * \brief Notifications namespace contains functions which receive notifications sent to current thread with
+ * Thread::notify()
+ *
+ * Each thread has a single notification value and a flag which marks it as pending. Notifications need no additional
+ * objects and no wait lists, so they are a lightweight alternative to a Semaphore (take functions, with
+ * NotificationAction::increment) or to an event group (wait functions, with NotificationAction::setBits) which is
+ * dedicated to a single receiving thread - for example a driver thread woken from an interrupt handler.
+ */
+
+namespace Notifications
+{
+
+/// \addtogroup synchronization
+/// \{
+
+/**
+ * \brief Takes notification.
+ *
+ * Notification value is used as a counter. If it is 0, current thread is blocked until it is not 0. Then it is either
+ * cleared or decremented.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] clearOnExit selects whether notification value will be cleared (true) or decremented (false), default -
+ * true
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before it was cleared or
+ * decremented (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ */
+
+std::pair<int, uint32_t> take(bool clearOnExit = true);
+
+/**
+ * \brief Tries to take notification.
+ *
+ * Similar to take(), but returns immediately if notification value is 0.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] clearOnExit selects whether notification value will be cleared (true) or decremented (false), default -
+ * true
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before it was cleared or
+ * decremented (or current notification value if return code is not 0); error codes:
+ * - EAGAIN - notification value is 0;
+ */
+
+std::pair<int, uint32_t> tryTake(bool clearOnExit = true);
+
+/**
+ * \brief Tries to take notification for given duration of time.
+ *
+ * Similar to take(), but the wait is terminated when given duration of time expires.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] duration is the duration after which the wait will be terminated
+ * \param [in] clearOnExit selects whether notification value will be cleared (true) or decremented (false), default -
+ * true
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before it was cleared or
+ * decremented (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - notification value was 0 until the specified timeout expired;
+ */
+
+std::pair<int, uint32_t> tryTakeFor(TickClock::duration duration, bool clearOnExit = true);
+
+/**
+ * \brief Tries to take notification for given duration of time.
+ *
+ * Template variant of tryTakeFor(TickClock::duration, bool).
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Rep is type of tick counter
+ * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+ *
+ * \param [in] duration is the duration after which the wait will be terminated
+ * \param [in] clearOnExit selects whether notification value will be cleared (true) or decremented (false), default -
+ * true
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before it was cleared or
+ * decremented (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - notification value was 0 until the specified timeout expired;
+ */
+
+template<typename Rep, typename Period>
+std::pair<int, uint32_t> tryTakeFor(const std::chrono::duration<Rep, Period> duration, const bool clearOnExit = true)
+{
+	return tryTakeFor(std::chrono::duration_cast<TickClock::duration>(duration), clearOnExit);
+}
+
+/**
+ * \brief Tries to take notification until given time point.
+ *
+ * Similar to take(), but the wait is terminated at given time point.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] timePoint is the time point at which the wait will be terminated
+ * \param [in] clearOnExit selects whether notification value will be cleared (true) or decremented (false), default -
+ * true
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before it was cleared or
+ * decremented (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - notification value was 0 until the specified timeout expired;
+ */
+
+std::pair<int, uint32_t> tryTakeUntil(TickClock::time_point timePoint, bool clearOnExit = true);
+
+/**
+ * \brief Tries to take notification until given time point.
+ *
+ * Template variant of tryTakeUntil(TickClock::time_point, bool).
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Duration is a std::chrono::duration type used to measure duration
+ *
+ * \param [in] timePoint is the time point at which the wait will be terminated
+ * \param [in] clearOnExit selects whether notification value will be cleared (true) or decremented (false), default -
+ * true
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before it was cleared or
+ * decremented (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - notification value was 0 until the specified timeout expired;
+ */
+
+template<typename Duration>
+std::pair<int, uint32_t> tryTakeUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+		const bool clearOnExit = true)
+{
+	return tryTakeUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), clearOnExit);
+}
+
+/**
+ * \brief Tries to wait for notification.
+ *
+ * Similar to wait(), but returns immediately if no notification is pending.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] clearOnEntry are the bits of notification value which will be cleared if no notification is pending
+ * \param [in] clearOnExit are the bits of notification value which will be cleared when notification is received
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before \a clearOnExit bits
+ * were cleared (or current notification value if return code is not 0); error codes:
+ * - EAGAIN - no notification is pending;
+ */
+
+std::pair<int, uint32_t> tryWait(uint32_t clearOnEntry, uint32_t clearOnExit);
+
+/**
+ * \brief Tries to wait for notification for given duration of time.
+ *
+ * Similar to wait(), but the wait is terminated when given duration of time expires.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] duration is the duration after which the wait will be terminated
+ * \param [in] clearOnEntry are the bits of notification value which will be cleared if no notification is pending
+ * \param [in] clearOnExit are the bits of notification value which will be cleared when notification is received
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before \a clearOnExit bits
+ * were cleared (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - no notification was received before the specified timeout expired;
+ */
+
+std::pair<int, uint32_t> tryWaitFor(TickClock::duration duration, uint32_t clearOnEntry, uint32_t clearOnExit);
+
+/**
+ * \brief Tries to wait for notification for given duration of time.
+ *
+ * Template variant of tryWaitFor(TickClock::duration, uint32_t, uint32_t).
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Rep is type of tick counter
+ * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+ *
+ * \param [in] duration is the duration after which the wait will be terminated
+ * \param [in] clearOnEntry are the bits of notification value which will be cleared if no notification is pending
+ * \param [in] clearOnExit are the bits of notification value which will be cleared when notification is received
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before \a clearOnExit bits
+ * were cleared (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - no notification was received before the specified timeout expired;
+ */
+
+template<typename Rep, typename Period>
+std::pair<int, uint32_t> tryWaitFor(const std::chrono::duration<Rep, Period> duration, const uint32_t clearOnEntry,
+		const uint32_t clearOnExit)
+{
+	return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration), clearOnEntry, clearOnExit);
+}
+
+/**
+ * \brief Tries to wait for notification until given time point.
+ *
+ * Similar to wait(), but the wait is terminated at given time point.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] timePoint is the time point at which the wait will be terminated
+ * \param [in] clearOnEntry are the bits of notification value which will be cleared if no notification is pending
+ * \param [in] clearOnExit are the bits of notification value which will be cleared when notification is received
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before \a clearOnExit bits
+ * were cleared (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - no notification was received before the specified timeout expired;
+ */
+
+std::pair<int, uint32_t> tryWaitUntil(TickClock::time_point timePoint, uint32_t clearOnEntry, uint32_t clearOnExit);
+
+/**
+ * \brief Tries to wait for notification until given time point.
+ *
+ * Template variant of tryWaitUntil(TickClock::time_point, uint32_t, uint32_t).
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Duration is a std::chrono::duration type used to measure duration
+ *
+ * \param [in] timePoint is the time point at which the wait will be terminated
+ * \param [in] clearOnEntry are the bits of notification value which will be cleared if no notification is pending
+ * \param [in] clearOnExit are the bits of notification value which will be cleared when notification is received
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before \a clearOnExit bits
+ * were cleared (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - no notification was received before the specified timeout expired;
+ */
+
+template<typename Duration>
+std::pair<int, uint32_t> tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+		const uint32_t clearOnEntry, const uint32_t clearOnExit)
+{
+	return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), clearOnEntry, clearOnExit);
+}
+
+/**
+ * \brief Waits for notification.
+ *
+ * If no notification is pending, \a clearOnEntry bits of notification value are cleared and current thread is blocked
+ * until notification is received. Then \a clearOnExit bits of notification value are cleared and notification is no
+ * longer pending.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] clearOnEntry are the bits of notification value which will be cleared if no notification is pending
+ * \param [in] clearOnExit are the bits of notification value which will be cleared when notification is received
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before \a clearOnExit bits
+ * were cleared (or current notification value if return code is not 0); error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ */
+
+std::pair<int, uint32_t> wait(uint32_t clearOnEntry, uint32_t clearOnExit);
+
+/// \}
+
+}	// namespace Notifications
+
+}	// namespace ThisThread
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_THISTHREAD_NOTIFICATIONS_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief ThisThread namespace header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,12 @@
 namespace distortos
 {
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+class CpuBudget;
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
 class Thread;
 class ThreadIdentifier;
 
@@ -68,6 +74,27 @@ void exit();
 
 Thread& get();
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+/**
+ * \warning This function must not be called from interrupt context!
+ *
+ * \return absolute deadline of calling (current) thread, TickClock::time_point::max() if the thread doesn't use
+ * SchedulingPolicy::earliestDeadlineFirst or if its deadline was not set
+ */
+
+TickClock::time_point getDeadline();
+
+/**
+ * \warning This function must not be called from interrupt context!
+ *
+ * \return number of periods in which calling (current) thread missed its deadline
+ */
+
+uint32_t getDeadlineMissCount();
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 /**
  * \warning This function must not be called from interrupt context!
  *
@@ -92,6 +119,14 @@ ThreadIdentifier getIdentifier();
 
 uint8_t getPriority();
 
+/**
+ * \warning This function must not be called from interrupt context!
+ *
+ * \return length of round-robin quantum of calling (current) thread
+ */
+
+TickClock::duration getRoundRobinQuantum();
+
 /**
  * \return scheduling policy of calling (current) thread
  */
@@ -114,6 +149,45 @@ size_t getStackHighWaterMark();
 
 size_t getStackSize();
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+/**
+ * \brief Changes CPU budget of calling (current) thread.
+ *
+ * The thread is removed from its previous CPU budget (if any) and added to the new one (if any). If the new CPU budget
+ * is exhausted, the thread is throttled immediately. Threads started later by calling (current) thread inherit its CPU
+ * budget.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] cpuBudget is a pointer to CpuBudget to which calling (current) thread will be added, nullptr to remove
+ * calling (current) thread from its CPU budget
+ */
+
+void setCpuBudget(CpuBudget* cpuBudget);
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+/**
+ * \brief Changes absolute deadline of calling (current) thread.
+ *
+ * Among threads with equal effective priority which use SchedulingPolicy::earliestDeadlineFirst, the one with the
+ * earliest deadline is executed first. Setting a later deadline may cause a context switch.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] deadline is the new absolute deadline of calling (current) thread
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - calling (current) thread doesn't use SchedulingPolicy::earliestDeadlineFirst;
+ */
+
+int setDeadline(TickClock::time_point deadline);
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 /**
  * Changes priority of calling (current) thread.
  *
@@ -127,6 +201,23 @@ size_t getStackSize();
 
 void setPriority(uint8_t priority, bool alwaysBehind = {});
 
+/**
+ * \brief Changes length of round-robin quantum of calling (current) thread.
+ *
+ * The new length is used starting with the current quantum of thread. It has effect only when thread uses
+ * SchedulingPolicy::roundRobin, but it is preserved when scheduling policy is changed.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] length is the new length of round-robin quantum, [0; 65535] ticks, 0 restores the default length
+ * (derived from CONFIG_TICK_FREQUENCY and CONFIG_ROUND_ROBIN_FREQUENCY)
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - \a length is invalid;
+ */
+
+int setRoundRobinQuantum(TickClock::duration length);
+
 /**
  * param [in] schedulingPolicy is the new scheduling policy of calling (current) thread
  */
@@ -210,6 +301,51 @@ int sleepUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
 	return sleepUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
 }
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+/**
+ * \brief Finishes current period of calling (current) thread and waits for the next one.
+ *
+ * Periods are assumed to have implicit deadlines - deadline of each period is the start of the next one. The current
+ * deadline becomes the start of the next period, the deadline is advanced by \a period and the thread sleeps until the
+ * next period starts. If the deadline was not set, the next period starts immediately. If the current deadline has
+ * already passed, the deadline miss counter is incremented and the next period starts without sleeping - this way a
+ * thread which overran its deadline gradually catches up with its schedule.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] period is the period of calling (current) thread
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the sleep was interrupted by an unmasked, caught signal;
+ * - EINVAL - calling (current) thread doesn't use SchedulingPolicy::earliestDeadlineFirst;
+ */
+
+int waitForNextPeriod(TickClock::duration period);
+
+/**
+ * \brief Finishes current period of calling (current) thread and waits for the next one.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Rep is type of tick counter
+ * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+ *
+ * \param [in] period is the period of calling (current) thread
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the sleep was interrupted by an unmasked, caught signal;
+ * - EINVAL - calling (current) thread doesn't use SchedulingPolicy::earliestDeadlineFirst;
+ */
+
+template<typename Rep, typename Period>
+int waitForNextPeriod(const std::chrono::duration<Rep, Period> period)
+{
+	return waitForNextPeriod(std::chrono::duration_cast<TickClock::duration>(period));
+}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 /**
  * \brief Yields time slot of the scheduler to next thread.
  *
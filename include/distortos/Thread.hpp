@@ -2,7 +2,7 @@
  * \file
  * \brief Thread class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,9 +14,11 @@
 
 #include "distortos/distortosConfiguration.h"
 
+#include "distortos/NotificationAction.hpp"
 #include "distortos/SchedulingPolicy.hpp"
 #include "distortos/SignalSet.hpp"
 #include "distortos/ThreadState.hpp"
+#include "distortos/TickClock.hpp"
 
 #include <csignal>
 
@@ -84,6 +86,16 @@ public:
 
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \return number of periods in which the thread missed its deadline
+	 */
+
+	virtual uint32_t getDeadlineMissCount() const = 0;
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -121,6 +133,23 @@ public:
 
 	virtual uint8_t getPriority() const = 0;
 
+	/**
+	 * \return length of round-robin quantum of thread
+	 */
+
+	virtual TickClock::duration getRoundRobinQuantum() const = 0;
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \return run time of thread, in units of run time counter (core clock cycles if architecture has cycle counter,
+	 * ticks otherwise)
+	 */
+
+	virtual uint64_t getRunTime() const = 0;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -166,6 +195,27 @@ public:
 
 	virtual int join() = 0;
 
+	/**
+	 * \brief Notifies the thread.
+	 *
+	 * Notification value of the thread is modified according to \a action and notification is marked as pending. If
+	 * the thread is waiting for notification, it is unblocked.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] value is the value used by \a action
+	 * \param [in] action is the action performed on notification value of the thread
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - \a action is NotificationAction::tryOverwrite and notification is already pending;
+	 * - EINVAL - \a action is invalid;
+	 * - EOVERFLOW - \a action is NotificationAction::increment and notification value would overflow;
+	 *
+	 * \ingroup synchronization
+	 */
+
+	virtual int notify(uint32_t value, NotificationAction action) = 0;
+
 #if CONFIG_SIGNALS_ENABLE == 1
 
 	/**
@@ -205,6 +255,21 @@ public:
 
 	virtual void setPriority(uint8_t priority, bool alwaysBehind = {}) = 0;
 
+	/**
+	 * \brief Changes length of round-robin quantum of thread.
+	 *
+	 * The new length is used starting with the current quantum of thread. It has effect only when thread uses
+	 * SchedulingPolicy::roundRobin, but it is preserved when scheduling policy is changed.
+	 *
+	 * \param [in] length is the new length of round-robin quantum, [0; 65535] ticks, 0 restores the default length
+	 * (derived from CONFIG_TICK_FREQUENCY and CONFIG_ROUND_ROBIN_FREQUENCY)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a length is invalid;
+	 */
+
+	virtual int setRoundRobinQuantum(TickClock::duration length) = 0;
+
 	/**
 	 * param [in] schedulingPolicy is the new scheduling policy of the thread
 	 */
@@ -0,0 +1,149 @@
+/**
+ * \file
+ * \brief ThreadPool class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_THREADPOOL_HPP_
+#define INCLUDE_DISTORTOS_THREADPOOL_HPP_
+
+#include "distortos/DynamicFifoQueue.hpp"
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Job.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief ThreadPool class is an executor with fixed number of reusable worker threads and bounded queue of jobs
+ *
+ * All worker threads and the queue are allocated once, when the thread pool is constructed. Submitting a job only
+ * pushes a pointer to it into the queue, so short jobs don't pay for creation, start and (deferred) deletion of a
+ * separate DynamicThread. The result of job - StaticJob, which is also a Future - can be obtained with Future::get().
+ *
+ * \code
+ * distortos::ThreadPool threadPool {2, 8, {512, 100}};
+ * auto job = distortos::makeStaticJob(function, 1, 2);
+ * threadPool.submit(job);
+ * ...
+ * const auto result = job.get();
+ * \endcode
+ *
+ * Job must not be destroyed or submitted again before it is completed.
+ *
+ * \ingroup threads
+ */
+
+class ThreadPool
+{
+public:
+
+	/**
+	 * \brief ThreadPool's constructor
+	 *
+	 * Creates and starts worker threads.
+	 *
+	 * \param [in] threadsCount is the number of worker threads, > 0
+	 * \param [in] queueSize is the maximum number of jobs which may be queued, > 0
+	 * \param [in] parameters is a DynamicThreadParameters struct with parameters of each worker thread
+	 */
+
+	ThreadPool(size_t threadsCount, size_t queueSize, const DynamicThreadParameters& parameters);
+
+	/**
+	 * \brief ThreadPool's destructor
+	 *
+	 * Waits until all queued jobs are executed, then terminates and destroys worker threads.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 */
+
+	~ThreadPool();
+
+	/**
+	 * \return number of worker threads
+	 */
+
+	size_t getThreadsCount() const
+	{
+		return threadsCount_;
+	}
+
+	/**
+	 * \brief Submits job to the thread pool.
+	 *
+	 * Result of the job is marked as not ready and the job is added at the end of the queue. If the queue is full, the
+	 * calling thread is blocked until space in the queue becomes available.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] job is a reference to job which will be submitted
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by FifoQueue::push();
+	 */
+
+	int submit(Job& job);
+
+	/**
+	 * \brief Tries to submit job to the thread pool.
+	 *
+	 * Similar to submit(), but if the queue is full, an error is returned instead of blocking.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] job is a reference to job which will be submitted
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by FifoQueue::tryPush();
+	 */
+
+	int trySubmit(Job& job);
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool(ThreadPool&&) = delete;
+	const ThreadPool& operator=(const ThreadPool&) = delete;
+	ThreadPool& operator=(ThreadPool&&) = delete;
+
+private:
+
+	/// type of storage for single worker thread
+	using ThreadStorage = std::aligned_storage<sizeof(DynamicThread), alignof(DynamicThread)>::type;
+
+	/**
+	 * \return reference to worker thread with given index
+	 *
+	 * \param [in] index is the index of worker thread, [0; threadsCount_)
+	 */
+
+	DynamicThread& getThread(const size_t index)
+	{
+		return reinterpret_cast<DynamicThread&>(threadsStorage_[index]);
+	}
+
+	/**
+	 * \brief Function executed by each worker thread.
+	 *
+	 * Executes queued jobs until nullptr is popped from the queue.
+	 */
+
+	void worker();
+
+	/// queue with pointers to submitted jobs, nullptr terminates one worker thread
+	DynamicFifoQueue<Job*> queue_;
+
+	/// storage for worker threads
+	std::unique_ptr<ThreadStorage[]> threadsStorage_;
+
+	/// number of worker threads
+	size_t threadsCount_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_THREADPOOL_HPP_
@@ -43,6 +43,14 @@ enum class ThreadState : uint8_t
 	blockedOnMutex,
 	/// thread is blocked on ConditionVariable
 	blockedOnConditionVariable,
+	/// thread is blocked on EventGroup
+	blockedOnEventGroup,
+	/// thread is blocked on SharedMutex
+	blockedOnSharedMutex,
+	/// thread is blocked on WaitSet
+	blockedOnWaitSet,
+	/// thread is waiting for notification
+	waitingForNotification,
 
 #if CONFIG_SIGNALS_ENABLE == 1
 
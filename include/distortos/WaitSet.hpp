@@ -0,0 +1,357 @@
+/**
+ * \file
+ * \brief WaitSet class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_WAITSET_HPP_
+#define INCLUDE_DISTORTOS_WAITSET_HPP_
+
+#include "distortos/internal/synchronization/WaitSetControlBlock.hpp"
+
+namespace distortos
+{
+
+template<typename T>
+class FifoQueue;
+
+template<typename T>
+class MessageQueue;
+
+class RawFifoQueue;
+class RawMessageQueue;
+class Semaphore;
+
+namespace devices
+{
+
+class SerialPort;
+
+}	// namespace devices
+
+/**
+ * \brief WaitSet allows a thread to wait until any of multiple objects becomes ready
+ *
+ * Similar to POSIX poll() - http://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html
+ *
+ * Supported objects are semaphores (ready when they can be locked without blocking), queues (ready for reading when
+ * they are not empty, ready for writing when they are not full) and serial ports (ready when received data is
+ * available). Readiness is checked without modifying the objects, so after the wait the thread should use non-blocking
+ * operations on the objects which were reported as ready - if other threads use these objects too, they may have
+ * changed their state in the meantime.
+ *
+ * During the wait each object may be waited for by only one WaitSet and each WaitSet may be used by only one thread.
+ * Serial ports are additionally locked for reading for the whole duration of the wait.
+ *
+ * \ingroup synchronization
+ */
+
+class WaitSet : private internal::WaitSetControlBlock
+{
+public:
+
+	/// type of event which is awaited for queues
+	enum class Event : uint8_t
+	{
+		/// queue is not empty
+		readable,
+		/// queue is not full
+		writable,
+	};
+
+	/// Entry class is a single object waited for by WaitSet
+	class Entry
+	{
+		friend WaitSet;
+
+	public:
+
+		/**
+		 * \brief Entry's constructor for semaphore
+		 *
+		 * \param [in] semaphore is a reference to semaphore which is ready when its value is greater than 0
+		 */
+
+		constexpr explicit Entry(Semaphore& semaphore) :
+				semaphore_{&semaphore},
+				serialPort_{},
+				ready_{}
+		{
+
+		}
+
+		/**
+		 * \brief Entry's constructor for FifoQueue
+		 *
+		 * \tparam T is the type of data in queue
+		 *
+		 * \param [in] fifoQueue is a reference to FifoQueue which is waited for
+		 * \param [in] event is the type of event which is awaited
+		 */
+
+		template<typename T>
+		Entry(FifoQueue<T>& fifoQueue, const Event event) :
+				Entry{event == Event::readable ? fifoQueue.fifoQueueBase_.getPopSemaphore() :
+						fifoQueue.fifoQueueBase_.getPushSemaphore()}
+		{
+
+		}
+
+		/**
+		 * \brief Entry's constructor for MessageQueue
+		 *
+		 * \tparam T is the type of data in queue
+		 *
+		 * \param [in] messageQueue is a reference to MessageQueue which is waited for
+		 * \param [in] event is the type of event which is awaited
+		 */
+
+		template<typename T>
+		Entry(MessageQueue<T>& messageQueue, const Event event) :
+				Entry{event == Event::readable ? messageQueue.messageQueueBase_.getPopSemaphore() :
+						messageQueue.messageQueueBase_.getPushSemaphore()}
+		{
+
+		}
+
+		/**
+		 * \brief Entry's constructor for RawFifoQueue
+		 *
+		 * \param [in] rawFifoQueue is a reference to RawFifoQueue which is waited for
+		 * \param [in] event is the type of event which is awaited
+		 */
+
+		Entry(RawFifoQueue& rawFifoQueue, Event event);
+
+		/**
+		 * \brief Entry's constructor for RawMessageQueue
+		 *
+		 * \param [in] rawMessageQueue is a reference to RawMessageQueue which is waited for
+		 * \param [in] event is the type of event which is awaited
+		 */
+
+		Entry(RawMessageQueue& rawMessageQueue, Event event);
+
+		/**
+		 * \brief Entry's constructor for serial port
+		 *
+		 * \param [in] serialPort is a reference to serial port which is ready when received data is available
+		 */
+
+		explicit Entry(devices::SerialPort& serialPort);
+
+		/**
+		 * \return true if the object was ready when the last wait of WaitSet finished, false otherwise
+		 */
+
+		bool isReady() const
+		{
+			return ready_;
+		}
+
+	private:
+
+		/// pointer to semaphore which is waited for, nullptr if this entry is for serial port
+		Semaphore* semaphore_;
+
+		/// pointer to serial port which is waited for, nullptr if this entry is for semaphore
+		devices::SerialPort* serialPort_;
+
+		/// true if the object was ready when the last wait of WaitSet finished, false otherwise
+		bool ready_;
+	};
+
+	/**
+	 * \brief WaitSet's constructor
+	 *
+	 * \param [in] entries is a pointer to array with entries
+	 * \param [in] entriesCount is the number of elements in \a entries array
+	 */
+
+	constexpr WaitSet(Entry* const entries, const size_t entriesCount) :
+			WaitSetControlBlock{},
+			entries_{entries},
+			entriesCount_{entriesCount}
+	{
+
+	}
+
+	/**
+	 * \brief WaitSet's constructor
+	 *
+	 * \tparam N is the number of elements in \a entries array
+	 *
+	 * \param [in] entries is a reference to array with entries
+	 */
+
+	template<size_t N>
+	constexpr explicit WaitSet(Entry (& entries)[N]) :
+			WaitSet{entries, N}
+	{
+
+	}
+
+	/**
+	 * \brief Tries to wait until any of the objects is ready.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of ready objects; error codes:
+	 * - EAGAIN - none of the objects is ready;
+	 * - EBUSY - any of the objects is currently waited for by another WaitSet or any of the serial ports is currently
+	 * being read by another thread;
+	 * - error codes returned by SerialPort::startReadNotification();
+	 */
+
+	std::pair<int, size_t> tryWait();
+
+	/**
+	 * \brief Tries to wait until any of the objects is ready for given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of ready objects; error codes:
+	 * - EBUSY - any of the objects is currently waited for by another WaitSet or any of the serial ports is currently
+	 * being read by another thread;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - none of the objects became ready before the specified timeout expired;
+	 * - error codes returned by SerialPort::startReadNotification();
+	 */
+
+	std::pair<int, size_t> tryWaitFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to wait until any of the objects is ready for given duration of time.
+	 *
+	 * Template variant of tryWaitFor(TickClock::duration duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of ready objects; error codes:
+	 * - EBUSY - any of the objects is currently waited for by another WaitSet or any of the serial ports is currently
+	 * being read by another thread;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - none of the objects became ready before the specified timeout expired;
+	 * - error codes returned by SerialPort::startReadNotification();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryWaitFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to wait until any of the objects is ready until given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of ready objects; error codes:
+	 * - EBUSY - any of the objects is currently waited for by another WaitSet or any of the serial ports is currently
+	 * being read by another thread;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - none of the objects became ready before the specified timeout expired;
+	 * - error codes returned by SerialPort::startReadNotification();
+	 */
+
+	std::pair<int, size_t> tryWaitUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to wait until any of the objects is ready until given time point.
+	 *
+	 * Template variant of tryWaitUntil(TickClock::time_point timePoint).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of ready objects; error codes:
+	 * - EBUSY - any of the objects is currently waited for by another WaitSet or any of the serial ports is currently
+	 * being read by another thread;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - none of the objects became ready before the specified timeout expired;
+	 * - error codes returned by SerialPort::startReadNotification();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Waits until any of the objects is ready.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of ready objects; error codes:
+	 * - EBUSY - any of the objects is currently waited for by another WaitSet or any of the serial ports is currently
+	 * being read by another thread;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - error codes returned by SerialPort::startReadNotification();
+	 */
+
+	std::pair<int, size_t> wait();
+
+	WaitSet(const WaitSet&) = delete;
+	WaitSet(WaitSet&&) = delete;
+	const WaitSet& operator=(const WaitSet&) = delete;
+	WaitSet& operator=(WaitSet&&) = delete;
+
+private:
+
+	/**
+	 * \brief Updates readiness of all entries.
+	 *
+	 * \attention interrupts must be masked
+	 *
+	 * \return number of ready entries
+	 */
+
+	size_t updateReadiness();
+
+	/**
+	 * \brief Implementation of all wait functions.
+	 *
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, used only if blocking mode
+	 * is selected, nullptr to wait indefinitely
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of ready objects; error codes:
+	 * - EAGAIN - none of the objects is ready and non-blocking mode was selected;
+	 * - EBUSY - any of the objects is currently waited for by another WaitSet or any of the serial ports is currently
+	 * being read by another thread;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - none of the objects became ready before the specified timeout expired;
+	 * - error codes returned by SerialPort::startReadNotification();
+	 */
+
+	std::pair<int, size_t> waitImplementation(bool nonBlocking, const TickClock::time_point* timePoint);
+
+	/// pointer to array with entries
+	Entry* entries_;
+
+	/// number of elements in \a entries_ array
+	size_t entriesCount_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_WAITSET_HPP_
@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \brief WorkItem class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_WORKITEM_HPP_
+#define INCLUDE_DISTORTOS_WORKITEM_HPP_
+
+#include "estd/IntrusiveList.hpp"
+
+namespace distortos
+{
+
+class WorkQueue;
+
+/**
+ * \brief WorkItem class is an abstract interface for work item, which can be submitted to WorkQueue
+ *
+ * Work item is a piece of work deferred from interrupt context (or from a thread) to one of the worker threads of work
+ * queue. Work item is intrusive, so it must be allocated before it is submitted and submitting it to work queue never
+ * allocates any memory.
+ *
+ * \ingroup synchronization
+ */
+
+class WorkItem
+{
+	friend WorkQueue;
+
+public:
+
+	/**
+	 * \brief WorkItem's constructor
+	 */
+
+	constexpr WorkItem() :
+			node_{},
+			workQueue_{}
+	{
+
+	}
+
+	/**
+	 * \brief WorkItem's destructor
+	 *
+	 * If the work item is pending, it is cancelled.
+	 */
+
+	virtual ~WorkItem() = 0;
+
+	/**
+	 * \brief WorkItem's move constructor
+	 *
+	 * If \a other is pending, this work item takes its place in the work queue.
+	 *
+	 * \param [in] other is a rvalue reference to WorkItem used as source of move construction
+	 */
+
+	WorkItem(WorkItem&& other);
+
+	/**
+	 * \return true if the work item is pending (submitted, but not yet executed) in any work queue, false otherwise
+	 */
+
+	bool isPending() const;
+
+	WorkItem(const WorkItem&) = delete;
+	const WorkItem& operator=(const WorkItem&) = delete;
+	WorkItem& operator=(WorkItem&&) = delete;
+
+private:
+
+	/**
+	 * \brief "Run" function of work item
+	 *
+	 * This function is executed by worker thread of work queue, after the work item is removed from the queue.
+	 */
+
+	virtual void run() = 0;
+
+	/// node for intrusive list in WorkQueue
+	estd::IntrusiveListNode node_;
+
+	/// pointer to WorkQueue in which the work item is pending, nullptr if the work item is not pending
+	WorkQueue* workQueue_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_WORKITEM_HPP_
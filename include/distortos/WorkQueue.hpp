@@ -0,0 +1,157 @@
+/**
+ * \file
+ * \brief WorkQueue class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_WORKQUEUE_HPP_
+#define INCLUDE_DISTORTOS_WORKQUEUE_HPP_
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/WorkItem.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief WorkQueue class is a FIFO queue of work items executed by worker threads
+ *
+ * Work queue allows deferring work from interrupt context - e.g. from UartBase::readCompleteEvent() or
+ * SpiMasterBase::transferCompleteEvent() - to one or more worker threads, which reduces the time spent in interrupt
+ * handlers. Submitting a work item takes constant time, doesn't allocate any memory and can be done from interrupt
+ * context. Pending work items are executed in the order in which they were submitted.
+ *
+ * Worker threads are not a part of work queue - each of them should execute process() (directly or via a function
+ * which calls it), for example:
+ *
+ * \code
+ * distortos::WorkQueue workQueue;
+ * auto workerThread = distortos::makeAndStartStaticThread<512>(200, &distortos::WorkQueue::process,
+ * 		std::ref(workQueue));
+ * \endcode
+ *
+ * Priority of worker threads selects the priority of deferred work. When there are multiple worker threads, pending
+ * work items are still removed from the queue in FIFO order, but may be executed concurrently.
+ *
+ * \ingroup synchronization
+ */
+
+class WorkQueue
+{
+public:
+
+	/**
+	 * \brief WorkQueue's constructor
+	 */
+
+	constexpr WorkQueue() :
+			list_{},
+			semaphore_{0}
+	{
+
+	}
+
+	/**
+	 * \brief WorkQueue's destructor
+	 *
+	 * All pending work items are cancelled.
+	 */
+
+	~WorkQueue();
+
+	/**
+	 * \brief Cancels pending work item.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] workItem is a reference to work item which will be cancelled
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a workItem is not pending in this work queue;
+	 */
+
+	int cancel(WorkItem& workItem);
+
+	/**
+	 * \brief Processes work items, never returns.
+	 *
+	 * This function should be executed by worker threads of the work queue.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 */
+
+	__attribute__ ((noreturn))
+	void process();
+
+	/**
+	 * \brief Waits for pending work item and executes it.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int processOne();
+
+	/**
+	 * \brief Submits work item to the work queue.
+	 *
+	 * Work item is added at the end of the queue and one of the worker threads is woken.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] workItem is a reference to work item which will be submitted
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - \a workItem is already pending (in this or any other work queue);
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int submit(WorkItem& workItem);
+
+	/**
+	 * \brief Executes pending work item, if there is any.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EAGAIN - no work items are pending;
+	 */
+
+	int tryProcessOne();
+
+	WorkQueue(const WorkQueue&) = delete;
+	WorkQueue(WorkQueue&&) = delete;
+	const WorkQueue& operator=(const WorkQueue&) = delete;
+	WorkQueue& operator=(WorkQueue&&) = delete;
+
+private:
+
+	/// type of intrusive list of pending work items
+	using List = estd::IntrusiveList<WorkItem, &WorkItem::node_>;
+
+	/**
+	 * \brief Removes first pending work item from the queue and executes it.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EAGAIN - no work items are pending;
+	 */
+
+	int executeFirst();
+
+	/// list of pending work items
+	List list_;
+
+	/// semaphore with number of pending work items, used by worker threads to wait for work items
+	Semaphore semaphore_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_WORKQUEUE_HPP_
@@ -0,0 +1,38 @@
+/**
+ * \file
+ * \brief getCycleCounter() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNTER_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNTER_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific read of free-running counter of core clock cycles.
+ *
+ * \note This function is available only if architecture has such counter (CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER is
+ * defined).
+ *
+ * \return current value of free-running 32-bit counter of core clock cycles
+ */
+
+uint32_t getCycleCounter();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNTER_HPP_
@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief ticklessIdle() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_TICKLESSIDLE_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_TICKLESSIDLE_HPP_
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific low-power wait with suppressed "tick" interrupt.
+ *
+ * Called repeatedly by idle thread. If idle thread is the only runnable thread, "tick" interrupt is suppressed until
+ * the earliest active software timer expires (or for the longest period supported by the hardware) and the core is put
+ * to sleep. When the core is woken up (by "tick" interrupt or by any other interrupt), the number of ticks that elapsed
+ * is added to scheduler's tick count and regular "tick" interrupt is restored, keeping its phase.
+ */
+
+void ticklessIdle();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_TICKLESSIDLE_HPP_
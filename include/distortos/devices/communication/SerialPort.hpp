@@ -2,7 +2,7 @@
  * \file
  * \brief SerialPort class header
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -21,6 +21,8 @@ namespace distortos
 {
 
 class Semaphore;
+class Thread;
+class WaitSet;
 
 namespace devices
 {
@@ -35,6 +37,8 @@ class UartLowLevel;
 
 class SerialPort : private UartBase
 {
+	friend WaitSet;
+
 public:
 
 	/**
@@ -291,6 +295,8 @@ public:
 			void* const writeBuffer, const size_t writeBufferSize) :
 					readMutex_{Mutex::Protocol::priorityInheritance},
 					writeMutex_{Mutex::Protocol::priorityInheritance},
+					readBlockOwner_{},
+					writeBlockOwner_{},
 					readBuffer_{readBuffer, (readBufferSize / 2) * 2},
 					writeBuffer_{writeBuffer, (writeBufferSize / 2) * 2},
 					currentReadBuffer_{&readBuffer_},
@@ -325,6 +331,71 @@ public:
 
 	~SerialPort() override;
 
+	/**
+	 * \brief Acquires contiguous block of received data directly from internal read buffer.
+	 *
+	 * This function will block until at least \a minSize bytes are available in internal read buffer. Acquired block
+	 * is the first contiguous block of received data, so it may be shorter than \a minSize when the data wraps around
+	 * the end of internal read buffer - after the block is released, the rest of data can be acquired immediately. If
+	 * \a minSize is 0, then the function will not block at all.
+	 *
+	 * The data can be processed in place, without copying it to a separate buffer. Until the block is released with
+	 * releaseReadBlock(), the device is locked for reading - other threads calling read() or acquireReadBlock() will
+	 * wait.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] minSize is the minimum number of bytes available in internal read buffer, bytes, values greater
+	 * than capacity of internal read buffer are limited to it, default - 1
+	 * \param [in] timePoint is a pointer to the time point at which the wait will be terminated without acquiring the
+	 * block, nullptr to wait indefinitely, default - nullptr
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and acquired block (pointer to first byte and
+	 * size, bytes), the block is valid only when 0 is returned - in that case releaseReadBlock() must be called;
+	 * error codes:
+	 * - EAGAIN - no data can be acquired without blocking and non-blocking operation was requested (\a minSize is 0);
+	 * - EBADF - the device is not opened;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - required amount of data was not received before the specified timeout expired;
+	 * - error codes returned by UartLowLevel::startRead();
+	 */
+
+	std::pair<int, std::pair<const uint8_t*, size_t>> acquireReadBlock(size_t minSize = 1,
+			const TickClock::time_point* timePoint = nullptr);
+
+	/**
+	 * \brief Acquires contiguous block of free space directly in internal write buffer.
+	 *
+	 * This function will block until at least \a minSize bytes are free in internal write buffer. Acquired block is the
+	 * first contiguous block of free space, so it may be shorter than \a minSize when the free space wraps around the
+	 * end of internal write buffer - after the block is released, the rest of free space can be acquired immediately.
+	 * If \a minSize is 0, then the function will not block at all.
+	 *
+	 * The data can be serialized in place, without copying it from a separate buffer. Until the block is released with
+	 * releaseWriteBlock(), the device is locked for writing - other threads calling write() or acquireWriteBlock() will
+	 * wait.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] minSize is the minimum number of bytes free in internal write buffer, bytes, values greater than
+	 * capacity of internal write buffer are limited to it, default - 1
+	 * \param [in] timePoint is a pointer to the time point at which the wait will be terminated without acquiring the
+	 * block, nullptr to wait indefinitely, default - nullptr
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and acquired block (pointer to first byte and
+	 * size, bytes), the block is valid only when 0 is returned - in that case releaseWriteBlock() must be called;
+	 * error codes:
+	 * - EAGAIN - no free space can be acquired without blocking and non-blocking operation was requested (\a minSize
+	 * is 0);
+	 * - EBADF - the device is not opened;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - required amount of free space was not available before the specified timeout expired;
+	 * - error codes returned by UartLowLevel::startWrite();
+	 */
+
+	std::pair<int, std::pair<uint8_t*, size_t>> acquireWriteBlock(size_t minSize = 1,
+			const TickClock::time_point* timePoint = nullptr);
+
 	/**
 	 * \brief Closes SerialPort.
 	 *
@@ -400,6 +471,45 @@ public:
 	std::pair<int, size_t> read(void* buffer, size_t size, size_t minSize = 1,
 			const TickClock::time_point* timePoint = nullptr);
 
+	/**
+	 * \brief Releases block acquired with acquireReadBlock().
+	 *
+	 * First \a size bytes of the block are consumed and the space they occupied is given back to reception. The device
+	 * is unlocked for reading even if an error other than EPERM is returned (in that case no data is consumed).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] size is the number of bytes which were consumed, must not be greater than the size of acquired block,
+	 * must be even if selected character length is greater than 8 bits
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a size is invalid;
+	 * - EPERM - current thread did not acquire the block;
+	 * - error codes returned by UartLowLevel::startRead();
+	 */
+
+	int releaseReadBlock(size_t size);
+
+	/**
+	 * \brief Releases block acquired with acquireWriteBlock().
+	 *
+	 * First \a size bytes of the block are committed for transmission, which is started if it is not already in
+	 * progress. The device is unlocked for writing even if an error other than EPERM is returned (in that case no data
+	 * is committed).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] size is the number of bytes which were written to the block, must not be greater than the size of
+	 * acquired block, must be even if selected character length is greater than 8 bits
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a size is invalid;
+	 * - EPERM - current thread did not acquire the block;
+	 * - error codes returned by UartLowLevel::startWrite();
+	 */
+
+	int releaseWriteBlock(size_t size);
+
 	/**
 	 * \brief Wrapper for read() with relative timeout
 	 *
@@ -741,6 +851,15 @@ protected:
 
 private:
 
+	/**
+	 * \return true if internal read buffer is not empty, false otherwise
+	 */
+
+	bool isReadable() const
+	{
+		return readBuffer_.isEmpty() == false;
+	}
+
 	/**
 	 * \brief Reads data from circular buffer and calls startReadWrapper().
 	 *
@@ -768,6 +887,23 @@ private:
 
 	int readImplementation(CircularBuffer& buffer, size_t minSize, const TickClock::time_point* timePoint);
 
+	/**
+	 * \brief Starts notification about data available in internal read buffer.
+	 *
+	 * Locks the mutex used for reads - without blocking - and keeps it locked until stopReadNotification() is called,
+	 * so no other thread can read from the serial port in the meantime. If internal read buffer is empty, \a semaphore
+	 * will be posted as soon as first character is received.
+	 *
+	 * \param [in] semaphore is a reference to semaphore which will be posted when first character is received
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - the device is not opened;
+	 * - EBUSY - the serial port is currently being read by another thread;
+	 * - error codes returned by UartLowLevel::startRead();
+	 */
+
+	int startReadNotification(Semaphore& semaphore);
+
 	/**
 	 * \brief Wrapper for UartLowLevel::startRead()
 	 *
@@ -796,6 +932,12 @@ private:
 
 	int startWriteWrapper();
 
+	/**
+	 * \brief Stops notification started with startReadNotification() and unlocks the mutex used for reads.
+	 */
+
+	void stopReadNotification();
+
 	/**
 	 * \brief Wrapper for UartLowLevel::stopRead()
 	 *
@@ -818,6 +960,36 @@ private:
 
 	size_t stopWriteWrapper();
 
+	/**
+	 * \brief Waits until internal read buffer contains at least \a minSize bytes.
+	 *
+	 * \param [in] minSize is the minimum number of bytes available in internal read buffer, bytes
+	 * \param [in] timePoint is a pointer to the time point at which the wait will be terminated, nullptr to wait
+	 * indefinitely
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - required amount of data was not received before the specified timeout expired;
+	 * - error codes returned by UartLowLevel::startRead();
+	 */
+
+	int waitForReadBlock(size_t minSize, const TickClock::time_point* timePoint);
+
+	/**
+	 * \brief Waits until internal write buffer has at least \a minSize bytes of free space.
+	 *
+	 * \param [in] minSize is the minimum number of bytes free in internal write buffer, bytes
+	 * \param [in] timePoint is a pointer to the time point at which the wait will be terminated, nullptr to wait
+	 * indefinitely
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - required amount of free space was not available before the specified timeout expired;
+	 * - error codes returned by UartLowLevel::startWrite();
+	 */
+
+	int waitForWriteBlock(size_t minSize, const TickClock::time_point* timePoint);
+
 	/**
 	 * \brief Implementation of basic write() functionality
 	 *
@@ -851,6 +1023,12 @@ private:
 	/// mutex used to serialize access to write(), close() and open()
 	Mutex writeMutex_;
 
+	/// thread which acquired block with acquireReadBlock(), nullptr if no block is acquired
+	const Thread* volatile readBlockOwner_;
+
+	/// thread which acquired block with acquireWriteBlock(), nullptr if no block is acquired
+	const Thread* volatile writeBlockOwner_;
+
 	/// internal instance of circular buffer for read operations
 	CircularBuffer readBuffer_;
 
@@ -2,7 +2,7 @@
  * \file
  * \brief SpiMasterErrorSet class header
  *
- * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -26,7 +26,7 @@ namespace devices
  * \ingroup devices
  */
 
-class SpiMasterErrorSet : public std::bitset<3>
+class SpiMasterErrorSet : public std::bitset<4>
 {
 public:
 
@@ -35,6 +35,8 @@ public:
 	{
 		/// CRC error
 		crcError,
+		/// DMA transfer error
+		dmaError,
 		/// master mode fault
 		masterModeFault,
 		/// overrun error
@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief getSystemWorkQueue() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_GETSYSTEMWORKQUEUE_HPP_
+#define INCLUDE_DISTORTOS_GETSYSTEMWORKQUEUE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_SYSTEM_WORK_QUEUE_ENABLE
+
+namespace distortos
+{
+
+class WorkQueue;
+
+/**
+ * \brief Gets system work queue.
+ *
+ * System work queue is processed by CONFIG_SYSTEM_WORK_QUEUE_THREADS worker threads with priority
+ * CONFIG_SYSTEM_WORK_QUEUE_THREAD_PRIORITY, which are started during low-level initialization.
+ *
+ * \return reference to system work queue
+ *
+ * \ingroup synchronization
+ */
+
+WorkQueue& getSystemWorkQueue();
+
+}	// namespace distortos
+
+#endif	// def CONFIG_SYSTEM_WORK_QUEUE_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_GETSYSTEMWORKQUEUE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief Header for newlib locking
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,8 +14,12 @@
 
 #include "distortos/Mutex.hpp"
 
+#ifdef _NEWLIB_VERSION
+
 #include <sys/lock.h>
 
+#endif	// def _NEWLIB_VERSION
+
 #if defined(_RETARGETABLE_LOCKING)
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -0,0 +1,192 @@
+/**
+ * \file
+ * \brief CpuBudgetControlBlock class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_CPUBUDGETCONTROLBLOCK_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_CPUBUDGETCONTROLBLOCK_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#include "distortos/internal/scheduler/ThreadListNode.hpp"
+
+#include "distortos/SoftwareTimerCommon.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadControlBlock;
+
+/**
+ * \brief CpuBudgetControlBlock class is a control block for CpuBudget
+ *
+ * Each tick during which one of the threads of this object is running is charged to the budget. When the budget is
+ * exhausted, all threads of this object are throttled until the budget is replenished at the beginning of next period.
+ */
+
+class CpuBudgetControlBlock
+{
+public:
+
+	/**
+	 * \brief CpuBudgetControlBlock's constructor
+	 *
+	 * Starts periodic replenishment of the budget.
+	 *
+	 * \param [in] budget is the amount of CPU time available to all threads of this object in each period, > 0
+	 * \param [in] period is the replenishment period, > 0
+	 */
+
+	CpuBudgetControlBlock(TickClock::duration budget, TickClock::duration period);
+
+	/**
+	 * \brief CpuBudgetControlBlock's destructor
+	 *
+	 * All threads are removed from this object.
+	 */
+
+	~CpuBudgetControlBlock();
+
+	/**
+	 * \brief Adds new ThreadControlBlock to internal list of this object.
+	 *
+	 * The thread is throttled if the budget is currently exhausted.
+	 *
+	 * \attention This function should be called only by ThreadControlBlock, with interrupt masking enabled.
+	 *
+	 * \param [in] threadControlBlock is a reference to added ThreadControlBlock object
+	 */
+
+	void add(ThreadControlBlock& threadControlBlock);
+
+	/**
+	 * \return remaining amount of CPU time in current period
+	 */
+
+	TickClock::duration getRemainingBudget() const
+	{
+		return remainingBudget_;
+	}
+
+	/**
+	 * \return true if the budget is exhausted and threads of this object are throttled, false otherwise
+	 */
+
+	bool isThrottled() const
+	{
+		return throttled_;
+	}
+
+	/**
+	 * \brief Removes ThreadControlBlock from internal list of this object.
+	 *
+	 * The thread is no longer throttled.
+	 *
+	 * \attention This function should be called only by ThreadControlBlock, with interrupt masking enabled.
+	 *
+	 * \param [in] threadControlBlock is a reference to removed ThreadControlBlock object
+	 */
+
+	void remove(ThreadControlBlock& threadControlBlock);
+
+	/**
+	 * \brief Handler of "tick" interrupt.
+	 *
+	 * Charges one tick to the budget. If the budget gets exhausted, all threads of this object are throttled.
+	 *
+	 * \attention This function should be called only by Scheduler::tickInterruptHandler(), when one of the threads of
+	 * this object is running.
+	 */
+
+	void tickInterruptHandler();
+
+	CpuBudgetControlBlock(const CpuBudgetControlBlock&) = delete;
+	CpuBudgetControlBlock(CpuBudgetControlBlock&&) = delete;
+	const CpuBudgetControlBlock& operator=(const CpuBudgetControlBlock&) = delete;
+	CpuBudgetControlBlock& operator=(CpuBudgetControlBlock&&) = delete;
+
+private:
+
+	/// ReplenishmentTimer class is a periodic software timer which replenishes the budget
+	class ReplenishmentTimer : public SoftwareTimerCommon
+	{
+	public:
+
+		/**
+		 * \brief ReplenishmentTimer's constructor
+		 *
+		 * \param [in] owner is a reference to CpuBudgetControlBlock object that owns this ReplenishmentTimer
+		 */
+
+		constexpr explicit ReplenishmentTimer(CpuBudgetControlBlock& owner) :
+				SoftwareTimerCommon{},
+				owner_{owner}
+		{
+
+		}
+
+	private:
+
+		/**
+		 * \brief "Run" function of software timer
+		 *
+		 * Replenishes the budget of owner.
+		 */
+
+		void run() override;
+
+		/// reference to CpuBudgetControlBlock object that owns this ReplenishmentTimer
+		CpuBudgetControlBlock& owner_;
+	};
+
+	/// intrusive list of threads (thread control blocks)
+	using List = estd::IntrusiveList<ThreadListNode, &ThreadListNode::cpuBudgetNode, ThreadControlBlock>;
+
+	/**
+	 * \brief Restores the full budget and ends throttling of threads of this object.
+	 */
+
+	void replenish();
+
+	/**
+	 * \brief Changes "throttled" state of this object and all its threads.
+	 *
+	 * \param [in] throttled selects whether the threads are throttled (true) or not (false)
+	 */
+
+	void setThrottled(bool throttled);
+
+	/// list of threads (thread control blocks) of this object
+	List threadList_;
+
+	/// periodic software timer which replenishes the budget
+	ReplenishmentTimer replenishmentTimer_;
+
+	/// amount of CPU time available to all threads of this object in each period
+	TickClock::duration budget_;
+
+	/// remaining amount of CPU time in current period
+	TickClock::duration remainingBudget_;
+
+	/// true if the budget is exhausted and threads of this object are throttled, false otherwise
+	bool throttled_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_CPUBUDGETCONTROLBLOCK_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThreadBase class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,7 @@
 
 #include "distortos/DynamicSignalsReceiver.hpp"
 #include "distortos/DynamicThreadParameters.hpp"
+#include "distortos/assert.h"
 
 #include "distortos/internal/memory/storageDeleter.hpp"
 
@@ -115,7 +116,8 @@ public:
 					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
 					std::forward<Function>(function), std::forward<Args>(args)...}
 	{
-
+		const auto ret = setRoundRobinQuantum(parameters.roundRobinQuantum);
+		assert(ret == 0 && "Invalid round-robin quantum!");
 	}
 
 #endif	// CONFIG_THREAD_DETACH_ENABLE != 1
@@ -197,7 +199,7 @@ private:
 	/**
 	 * \brief Helper function to make stack with size adjusted to alignment requirements
 	 *
-	 * Size of "stack guard" is added to function argument.
+	 * Size of "stack guard" and architecture-specific stack overhead are added to function argument.
 	 *
 	 * \param [in] stackSize is the size of stack, bytes
 	 *
@@ -209,8 +211,9 @@ private:
 		static_assert(alignof(max_align_t) >= CONFIG_ARCHITECTURE_STACK_ALIGNMENT,
 				"Alignment of dynamically allocated memory is too low!");
 
-		const auto adjustedStackSize = (stackSize + CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) /
-				CONFIG_ARCHITECTURE_STACK_ALIGNMENT * CONFIG_ARCHITECTURE_STACK_ALIGNMENT;
+		const auto adjustedStackSize = (stackSize + CONFIG_ARCHITECTURE_STACK_OVERHEAD +
+				CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) / CONFIG_ARCHITECTURE_STACK_ALIGNMENT *
+				CONFIG_ARCHITECTURE_STACK_ALIGNMENT;
 		return {{new uint8_t[adjustedStackSize + stackGuardSize], storageDeleter<uint8_t>},
 				adjustedStackSize + stackGuardSize};
 	}
@@ -2,7 +2,7 @@
  * \file
  * \brief RoundRobinQuantum class header
  *
- * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,8 @@
 
 #include "distortos/TickClock.hpp"
 
+#include <limits>
+
 namespace distortos
 {
 
@@ -26,13 +28,14 @@ class RoundRobinQuantum
 public:
 
 	/// type of quantum counter
-	using Representation = uint8_t;
+	using Representation = uint16_t;
 
 	/// duration type used for quantum
 	using Duration = std::chrono::duration<Representation, TickClock::period>;
 
 	/**
-	 * \return initial value for round-robin quantum
+	 * \return default length of round-robin quantum, calculated from CONFIG_TICK_FREQUENCY and
+	 * CONFIG_ROUND_ROBIN_FREQUENCY
 	 */
 
 	constexpr static Duration getInitial()
@@ -43,11 +46,14 @@ public:
 	/**
 	 * \brief RoundRobinQuantum's constructor
 	 *
-	 * Initializes quantum value to initial value - just like after call to reset().
+	 * Initializes quantum value to its length - just like after call to reset().
+	 *
+	 * \param [in] length is the length of round-robin quantum, default - getInitial()
 	 */
 
-	constexpr RoundRobinQuantum() :
-			quantum_{getInitial()}
+	constexpr explicit RoundRobinQuantum(const Duration length = getInitial()) :
+			length_{length},
+			quantum_{length}
 	{
 
 	}
@@ -78,6 +84,15 @@ public:
 		return quantum_;
 	}
 
+	/**
+	 * \return length of round-robin quantum
+	 */
+
+	Duration getLength() const
+	{
+		return length_;
+	}
+
 	/**
 	 * \brief Convenience function to test whether the quantum is already at 0.
 	 *
@@ -97,7 +112,19 @@ public:
 
 	void reset()
 	{
-		quantum_ = getInitial();
+		quantum_ = length_;
+	}
+
+	/**
+	 * \brief Changes length of round-robin quantum and resets its value.
+	 *
+	 * \param [in] length is the new length of round-robin quantum, must be greater than 0
+	 */
+
+	void setLength(const Duration length)
+	{
+		length_ = length;
+		reset();
 	}
 
 private:
@@ -109,9 +136,12 @@ private:
 	constexpr static auto quantumRawInitializer_ = (CONFIG_TICK_FREQUENCY + CONFIG_ROUND_ROBIN_FREQUENCY / 2) /
 			CONFIG_ROUND_ROBIN_FREQUENCY;
 
-	static_assert(quantumRawInitializer_ > 0 || quantumRawInitializer_ <= UINT8_MAX,
+	static_assert(quantumRawInitializer_ > 0 && quantumRawInitializer_ <= std::numeric_limits<Representation>::max(),
 			"CONFIG_TICK_FREQUENCY and CONFIG_ROUND_ROBIN_FREQUENCY values produce invalid round-robin quantum!");
 
+	/// length of round-robin quantum
+	Duration length_;
+
 	/// round-robin quantum
 	Duration quantum_;
 };
@@ -0,0 +1,197 @@
+/**
+ * \file
+ * \brief RunnableThreadList class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+#include <array>
+
+#endif	// CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+namespace distortos
+{
+
+namespace internal
+{
+
+#if CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+/**
+ * \brief RunnableThreadList class is a ThreadList used by scheduler for threads in "runnable" state
+ *
+ * All threads are still linked in a single intrusive list sorted by effective priority in descending order, so the
+ * first element is always the highest-priority thread and elements with equal priority form a FIFO. Instead of linear
+ * search, insert position is found with the help of a bitmap of non-empty priority levels and an array with first
+ * element of each level, so all operations take constant time, regardless of the number of threads. The only exception
+ * are threads with SchedulingPolicy::earliestDeadlineFirst - elements with equal effective priority are sorted by
+ * deadline, so position of such thread is found with linear search in the group of elements with the same effective
+ * priority.
+ *
+ * \attention Elements on this list must be modified only with member functions of RunnableThreadList, as internal
+ * bookkeeping would get corrupted by functions inherited from ThreadList or by splicing elements of this list directly
+ * to another list.
+ */
+
+class RunnableThreadList : public ThreadList
+{
+public:
+
+	/**
+	 * \brief RunnableThreadList's constructor
+	 */
+
+	constexpr RunnableThreadList() :
+			ThreadList{},
+			levelHeads_{},
+			levelBitmap_{},
+			levelBitmapSummary_{}
+	{
+
+	}
+
+	/**
+	 * \brief Links the element in the list, keeping it sorted.
+	 *
+	 * The element is linked at the end of the group of elements with the same effective priority (and deadline).
+	 *
+	 * \param [in] newElement is a reference to the element that will be linked in the list
+	 *
+	 * \return iterator of \a newElement
+	 */
+
+	iterator insert(reference newElement);
+
+	/**
+	 * \brief Repositions the element on this list after change of its effective priority (or deadline).
+	 *
+	 * \param [in] element is an iterator of the element that will be repositioned
+	 * \param [in] oldPriority is the effective priority of the element before the change
+	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
+	 * priority is raised!):
+	 * - true - the element is moved to the head of the group of elements with the same effective priority (and
+	 * deadline),
+	 * - false - the element is moved to the tail of the group of elements with the same effective priority (and
+	 * deadline).
+	 */
+
+	void reposition(iterator element, uint8_t oldPriority, bool loweringBefore);
+
+	/**
+	 * \brief Transfers the element from another list (or from this list) to this one, keeping it sorted.
+	 *
+	 * The element is linked at the end of the group of elements with the same effective priority (and deadline).
+	 *
+	 * \param [in] splicedElement is an iterator of the element that will be spliced to this list
+	 */
+
+	void splice(iterator splicedElement);
+
+	/**
+	 * \brief Transfers the element from this list to another one.
+	 *
+	 * \param [in] container is a reference to destination list to which the element will be transferred
+	 * \param [in] splicedElement is an iterator of the element that will be spliced from this list to \a container
+	 */
+
+	void spliceTo(ThreadList& container, iterator splicedElement);
+
+private:
+
+	/// number of priority levels
+	constexpr static size_t levels_ {UINT8_MAX + 1};
+
+	/// number of bits in single word of levelBitmap_
+	constexpr static size_t bitsPerWord_ {32};
+
+	/**
+	 * \brief Finds position before which element should be linked.
+	 *
+	 * \param [in] element is a reference to linked element, it is ignored if it's already on the list
+	 * \param [in] front selects whether the element will be linked at the head (true) or at the tail (false) of the
+	 * group of elements with the same effective priority (and deadline)
+	 *
+	 * \return iterator of the element before which new element should be linked
+	 */
+
+	iterator findInsertPosition(const_reference element, bool front);
+
+	/**
+	 * \brief Finds highest non-empty priority level which is lower than given priority.
+	 *
+	 * \param [in] priority is the effective priority which is the upper bound of the search (exclusive)
+	 *
+	 * \return highest non-empty priority level lower than \a priority, -1 if there is no such level
+	 */
+
+	int findLowerLevel(uint8_t priority) const;
+
+	/**
+	 * \brief Registers the element which was just linked in the list in internal bookkeeping.
+	 *
+	 * \param [in] element is an iterator of the element that was linked
+	 * \param [in] priority is the effective priority of the element
+	 */
+
+	void registerElement(iterator element, uint8_t priority);
+
+	/**
+	 * \brief Unregisters the element which is about to be unlinked from the list from internal bookkeeping.
+	 *
+	 * \param [in] element is an iterator of the element that will be unlinked
+	 * \param [in] priority is the effective priority with which the element was registered
+	 */
+
+	void unregisterElement(iterator element, uint8_t priority);
+
+	/// array with first element of each priority level, valid only if given level is marked in levelBitmap_
+	std::array<iterator, levels_> levelHeads_;
+
+	/// bitmap of non-empty priority levels
+	std::array<uint32_t, levels_ / bitsPerWord_> levelBitmap_;
+
+	/// bitmap of non-zero words in levelBitmap_
+	uint32_t levelBitmapSummary_;
+};
+
+#else	// CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE != 1
+
+/// RunnableThreadList class is a ThreadList used by scheduler for threads in "runnable" state
+class RunnableThreadList : public ThreadList
+{
+public:
+
+	/**
+	 * \brief Transfers the element from this list to another one.
+	 *
+	 * \param [in] container is a reference to destination list to which the element will be transferred
+	 * \param [in] splicedElement is an iterator of the element that will be spliced from this list to \a container
+	 */
+
+	static void spliceTo(ThreadList& container, const iterator splicedElement)
+	{
+		container.splice(splicedElement);
+	}
+};
+
+#endif	// CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE != 1
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
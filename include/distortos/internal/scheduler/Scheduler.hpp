@@ -12,8 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SCHEDULER_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SCHEDULER_HPP_
 
+#include "distortos/internal/scheduler/RunnableThreadList.hpp"
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
-#include "distortos/internal/scheduler/ThreadList.hpp"
 #include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
 namespace distortos
@@ -37,6 +37,10 @@ public:
 			suspendedList_{},
 			softwareTimerSupervisor_{},
 			contextSwitchCount_{},
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+			totalRunTime_{},
+			runTimeCounter_{},
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
 			tickCount_{}
 	{
 
@@ -146,12 +150,56 @@ public:
 		return softwareTimerSupervisor_;
 	}
 
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	/**
+	 * \brief Advances tick count by the number of ticks which elapsed while "tick" interrupt was suppressed.
+	 *
+	 * \note this must not be called by user code
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 *
+	 * \param [in] ticks is the number of ticks which elapsed while "tick" interrupt was suppressed, excluding the tick
+	 * which will be handled by pending "tick" interrupt (if any)
+	 */
+
+	void advanceTickCount(const uint64_t ticks)
+	{
+		tickCount_ += ticks;
+	}
+
+	/**
+	 * \brief Gets the duration for which "tick" interrupt may be suppressed.
+	 *
+	 * \note this must not be called by user code
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 *
+	 * \return duration until the earliest active software timer expires (TickClock::duration::max() if there are no
+	 * active software timers), zero if "tick" interrupt must not be suppressed because idle thread is not the only
+	 * runnable thread
+	 */
+
+	TickClock::duration getTicklessIdleDuration() const;
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 	/**
 	 * \return current value of tick count
 	 */
 
 	uint64_t getTickCount() const;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \return total run time of all threads, in units of run time counter
+	 */
+
+	uint64_t getTotalRunTime() const;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \brief Scheduler's initialization
 	 *
@@ -191,6 +239,21 @@ public:
 
 	int remove();
 
+	/**
+	 * \brief Moves blocked thread to another container of blocked threads.
+	 *
+	 * Thread stays blocked - its UnblockFunctor and timeout (if any) are preserved.
+	 *
+	 * \param [in] container is a reference to destination container to which the thread will be transferred
+	 * \param [in] iterator is the iterator to the thread that will be moved
+	 * \param [in] state is the new state of thread
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - provided thread is not blocked;
+	 */
+
+	int requeue(ThreadList& container, ThreadList::iterator iterator, ThreadState state);
+
 	/**
 	 * \brief Resumes suspended thread.
 	 *
@@ -332,11 +395,23 @@ private:
 
 	void unblockInternal(ThreadList::iterator iterator, UnblockReason unblockReason);
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \brief Charges the time which elapsed since previous call to current thread.
+	 *
+	 * Run time counter is either the counter of core clock cycles (if architecture has it) or tick count.
+	 */
+
+	void updateRunTime();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/// iterator to the currently active ThreadControlBlock
 	ThreadList::iterator currentThreadControlBlock_;
 
 	/// list of ThreadControlBlock elements in "runnable" state, sorted by priority in descending order
-	ThreadList runnableList_;
+	RunnableThreadList runnableList_;
 
 	/// list of ThreadControlBlock elements in "suspended" state, sorted by priority in descending order
 	ThreadList suspendedList_;
@@ -347,6 +422,16 @@ private:
 	/// number of context switches
 	uint64_t contextSwitchCount_;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/// total run time of all threads, in units of run time counter
+	uint64_t totalRunTime_;
+
+	/// value of run time counter during previous call to updateRunTime()
+	uint32_t runTimeCounter_;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/// tick count
 	uint64_t tickCount_;
 };
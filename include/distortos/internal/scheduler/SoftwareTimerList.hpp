@@ -55,6 +55,10 @@ struct SoftwareTimerAscendingTimePoint
 using SoftwareTimerList = estd::SortedIntrusiveList<SoftwareTimerAscendingTimePoint, SoftwareTimerListNode,
 		&SoftwareTimerListNode::node, SoftwareTimerControlBlock>;
 
+/// unsorted intrusive list of software timers (software timer control blocks)
+using SoftwareTimerUnsortedList = estd::IntrusiveList<SoftwareTimerListNode, &SoftwareTimerListNode::node,
+		SoftwareTimerControlBlock>;
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -14,6 +14,14 @@
 
 #include "distortos/internal/scheduler/SoftwareTimerList.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+#include <array>
+
+#endif	// def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
 namespace distortos
 {
 
@@ -30,7 +38,13 @@ public:
 	 */
 
 	constexpr SoftwareTimerSupervisor() :
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+			buckets_(),
+			bucketsBitmap_{},
+			lastTimePoint_{}
+#else	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
 			activeList_{}
+#endif	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
 	{
 
 	}
@@ -43,6 +57,19 @@ public:
 
 	void add(SoftwareTimerControlBlock& softwareTimerControlBlock);
 
+	/**
+	 * \brief Finds time point of the earliest active software timer.
+	 *
+	 * With timer wheel the returned value is only the time point at which the first bucket with software timers is
+	 * checked. It is never later than the time point of the earliest active software timer, but it may be earlier -
+	 * if software timers from this bucket expire in one of next rounds of the wheel or if they were stopped.
+	 *
+	 * \return time point of the earliest active software timer, TickClock::time_point::max() if there are no active
+	 * software timers
+	 */
+
+	TickClock::time_point getNextTimePoint() const;
+
 	/**
 	 * \brief Handler of "tick" interrupt.
 	 *
@@ -55,8 +82,60 @@ public:
 
 private:
 
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+	/// number of buckets in timer wheel
+	constexpr static size_t bucketsCount_ {CONFIG_SOFTWARE_TIMER_WHEEL_SIZE};
+
+	static_assert(bucketsCount_ > 1 && (bucketsCount_ & (bucketsCount_ - 1)) == 0,
+			"Number of buckets in timer wheel must be a power of 2!");
+
+	static_assert(bucketsCount_ <= 256, "Number of buckets in timer wheel must not exceed 256!");
+
+	/// number of bits in single word of bucketsBitmap_
+	constexpr static size_t bitsPerWord_ {32};
+
+	/**
+	 * \brief Finds first bucket marked in bucketsBitmap_ in given range.
+	 *
+	 * \param [in] begin is the index of first bucket which will be checked
+	 * \param [in] end is the index one past the last bucket which will be checked
+	 *
+	 * \return index of first marked bucket in range [\a begin; \a end), bucketsCount_ if no bucket in this range is
+	 * marked
+	 */
+
+	size_t findMarkedBucket(size_t begin, size_t end) const;
+
+	/**
+	 * \param [in] timePoint is the time point at which the bucket is checked
+	 *
+	 * \return index of bucket of timer wheel which is checked at \a timePoint
+	 */
+
+	static size_t getBucketIndex(const TickClock::time_point timePoint)
+	{
+		return static_cast<uint64_t>(timePoint.time_since_epoch().count()) % bucketsCount_;
+	}
+
+	/// buckets of timer wheel, each one with unsorted list of active software timers with the same expiration time
+	/// point modulo bucketsCount_
+	std::array<SoftwareTimerUnsortedList, bucketsCount_> buckets_;
+
+	/// bitmap of buckets which may contain software timers - bit is set when software timer is added to the bucket and
+	/// cleared when tickInterruptHandler() leaves the bucket empty, so software timers stopped in the meantime may
+	/// leave the bit of empty bucket set
+	std::array<uint32_t, (bucketsCount_ + bitsPerWord_ - 1) / bitsPerWord_> bucketsBitmap_;
+
+	/// time point passed to last call of tickInterruptHandler()
+	TickClock::time_point lastTimePoint_;
+
+#else	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
 	/// list of active software timers (waiting for execution)
 	SoftwareTimerList activeList_;
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
 };
 
 }	// namespace internal
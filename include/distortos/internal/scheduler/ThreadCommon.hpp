@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadCommon class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -75,6 +75,16 @@ public:
 
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \return number of periods in which the thread missed its deadline
+	 */
+
+	uint32_t getDeadlineMissCount() const override;
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -112,6 +122,23 @@ public:
 
 	uint8_t getPriority() const override;
 
+	/**
+	 * \return length of round-robin quantum of thread
+	 */
+
+	TickClock::duration getRoundRobinQuantum() const override;
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \return run time of thread, in units of run time counter (core clock cycles if architecture has cycle counter,
+	 * ticks otherwise)
+	 */
+
+	uint64_t getRunTime() const override;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -156,6 +183,25 @@ public:
 
 	int join() override;
 
+	/**
+	 * \brief Notifies the thread.
+	 *
+	 * Notification value of the thread is modified according to \a action and notification is marked as pending. If
+	 * the thread is waiting for notification, it is unblocked.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] value is the value used by \a action
+	 * \param [in] action is the action performed on notification value of the thread
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by ThreadControlBlock::notify();
+	 *
+	 * \ingroup synchronization
+	 */
+
+	int notify(uint32_t value, NotificationAction action) override;
+
 #if CONFIG_SIGNALS_ENABLE == 1
 
 	/**
@@ -193,6 +239,21 @@ public:
 
 	void setPriority(uint8_t priority, bool alwaysBehind = {}) override;
 
+	/**
+	 * \brief Changes length of round-robin quantum of thread.
+	 *
+	 * The new length is used starting with the current quantum of thread. It has effect only when thread uses
+	 * SchedulingPolicy::roundRobin, but it is preserved when scheduling policy is changed.
+	 *
+	 * \param [in] length is the new length of round-robin quantum, [0; 65535] ticks, 0 restores the default length
+	 * (derived from CONFIG_TICK_FREQUENCY and CONFIG_ROUND_ROBIN_FREQUENCY)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a length is invalid;
+	 */
+
+	int setRoundRobinQuantum(TickClock::duration length) override;
+
 	/**
 	 * param [in] schedulingPolicy is the new scheduling policy of the thread
 	 */
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadControlBlock class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -19,18 +19,33 @@
 
 #include "distortos/internal/synchronization/MutexList.hpp"
 
+#include "distortos/NotificationAction.hpp"
 #include "distortos/SchedulingPolicy.hpp"
 #include "distortos/ThreadState.hpp"
 
 namespace distortos
 {
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+class CpuBudget;
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
 class SignalsReceiver;
 
 namespace internal
 {
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+class CpuBudgetControlBlock;
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+class MutexControlBlock;
 class RunnableThread;
+class SharedMutexControlBlock;
 class SignalsReceiverControlBlock;
 class ThreadList;
 class ThreadGroupControlBlock;
@@ -66,7 +81,8 @@ public:
 	 * \brief Hook function executed when thread is added to scheduler.
 	 *
 	 * If threadGroupControlBlock_ is nullptr, it is inherited from currently running thread. Then this object is added
-	 * to the thread group (if it is valid).
+	 * to the thread group (if it is valid). Thread which inherits thread group also inherits CPU budget (if any) of
+	 * currently running thread.
 	 *
 	 * \attention This function should be called only by Scheduler::addInternal().
 	 *
@@ -76,6 +92,23 @@ public:
 
 	int addHook();
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \brief Adds time to run time of thread.
+	 *
+	 * \attention This function should be called only by Scheduler.
+	 *
+	 * \param [in] time is the time that will be added, in units of run time counter
+	 */
+
+	void addRunTime(const uint32_t time)
+	{
+		runTime_ += time;
+	}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \brief Block hook function of thread
 	 *
@@ -91,6 +124,61 @@ public:
 		unblockFunctor_ = unblockFunctor;
 	}
 
+	/**
+	 * \return pointer to MutexControlBlock used by the thread blocked on ConditionVariable, nullptr if the wait of the
+	 * thread must not be moved to that mutex
+	 */
+
+	MutexControlBlock* getConditionVariableMutexControlBlock() const
+	{
+		return conditionVariableMutexControlBlock_;
+	}
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+	/**
+	 * \return pointer to CpuBudgetControlBlock with which this object is associated, nullptr if none
+	 */
+
+	CpuBudgetControlBlock* getCpuBudgetControlBlock() const
+	{
+		return cpuBudgetControlBlock_;
+	}
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \return number of periods in which the thread missed its deadline
+	 */
+
+	uint32_t getDeadlineMissCount() const
+	{
+		return deadlineMissCount_;
+	}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \return event bits of EventGroup awaited by the thread blocked on that event group, replaced with event bits
+	 * which satisfied the wait when the thread is unblocked
+	 */
+
+	uint32_t getEventGroupBits() const
+	{
+		return eventGroupBits_;
+	}
+
+	/**
+	 * \return flags describing the wait of the thread blocked on EventGroup
+	 */
+
+	uint8_t getEventGroupWaitFlags() const
+	{
+		return eventGroupWaitFlags_;
+	}
+
 	/**
 	 * \return pointer to list that has this object
 	 */
@@ -100,6 +188,15 @@ public:
 		return list_;
 	}
 
+	/**
+	 * \return notification value of the thread
+	 */
+
+	uint32_t getNotificationValue() const
+	{
+		return notificationValue_;
+	}
+
 	/**
 	 * \return reference to list of mutexes (mutex control blocks) with enabled priority protocol owned by this thread
 	 */
@@ -127,6 +224,28 @@ public:
 		return roundRobinQuantum_;
 	}
 
+	/**
+	 * \return const reference to internal RoundRobinQuantum object
+	 */
+
+	const RoundRobinQuantum& getRoundRobinQuantum() const
+	{
+		return roundRobinQuantum_;
+	}
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \return run time of thread, in units of run time counter
+	 */
+
+	uint64_t getRunTime() const
+	{
+		return runTime_;
+	}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -136,6 +255,15 @@ public:
 		return schedulingPolicy_;
 	}
 
+	/**
+	 * \return number of units of Semaphore requested by the thread when it was blocked on that semaphore
+	 */
+
+	unsigned int getSemaphoreRequestedValue() const
+	{
+		return semaphoreRequestedValue_;
+	}
+
 	/**
 	 * \return sequence number, one half of thread identifier
 	 */
@@ -186,6 +314,99 @@ public:
 		return state_;
 	}
 
+	/**
+	 * \return pointer to ThreadGroupControlBlock with which this object is associated
+	 */
+
+	ThreadGroupControlBlock* getThreadGroupControlBlock() const
+	{
+		return threadGroupControlBlock_;
+	}
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \brief Increments the number of periods in which the thread missed its deadline.
+	 */
+
+	void incrementDeadlineMissCount()
+	{
+		++deadlineMissCount_;
+	}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \return true if notification of the thread is pending (it was not yet received by the thread), false otherwise
+	 */
+
+	bool isNotificationPending() const
+	{
+		return notificationPending_;
+	}
+
+	/**
+	 * \brief Notifies the thread.
+	 *
+	 * Notification value is modified according to \a action and notification is marked as pending. If the thread is
+	 * waiting for notification, it is unblocked.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] value is the value used by \a action
+	 * \param [in] action is the action performed on notification value
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - \a action is NotificationAction::tryOverwrite and notification is already pending;
+	 * - EINVAL - \a action is invalid;
+	 * - EOVERFLOW - \a action is NotificationAction::increment and notification value would overflow;
+	 */
+
+	int notify(uint32_t value, NotificationAction action);
+
+	/**
+	 * \param [in] conditionVariableMutexControlBlock is a pointer to MutexControlBlock used by the thread which is
+	 * about to be blocked on ConditionVariable, nullptr if the wait of the thread must not be moved to that mutex
+	 */
+
+	void setConditionVariableMutexControlBlock(MutexControlBlock* const conditionVariableMutexControlBlock)
+	{
+		conditionVariableMutexControlBlock_ = conditionVariableMutexControlBlock;
+	}
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+	/**
+	 * \brief Changes CPU budget of thread.
+	 *
+	 * The thread is removed from its previous CPU budget (if any) and added to the new one (if any). Its effective
+	 * priority is adjusted to the state of the new CPU budget.
+	 *
+	 * \param [in] cpuBudget is a pointer to CpuBudget to which the thread will be added, nullptr to remove the thread
+	 * from its CPU budget
+	 */
+
+	void setCpuBudget(CpuBudget* cpuBudget);
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \brief Changes absolute deadline of thread.
+	 *
+	 * If the deadline really changes, the position in the thread list is adjusted and context switch may be requested.
+	 *
+	 * \param [in] deadline is the new absolute deadline of thread
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - thread doesn't use SchedulingPolicy::earliestDeadlineFirst;
+	 */
+
+	int setDeadline(TickClock::time_point deadline);
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 	/**
 	 * \brief Sets the list that has this object.
 	 *
@@ -197,6 +418,44 @@ public:
 		list_ = list;
 	}
 
+	/**
+	 * \param [in] eventGroupBits is the value of event bits of EventGroup - awaited by the thread which is about to be
+	 * blocked on that event group or the ones which satisfied the wait of the thread which is about to be unblocked
+	 */
+
+	void setEventGroupBits(const uint32_t eventGroupBits)
+	{
+		eventGroupBits_ = eventGroupBits;
+	}
+
+	/**
+	 * \param [in] eventGroupWaitFlags are the flags describing the wait of the thread which is about to be blocked on
+	 * EventGroup
+	 */
+
+	void setEventGroupWaitFlags(const uint8_t eventGroupWaitFlags)
+	{
+		eventGroupWaitFlags_ = eventGroupWaitFlags;
+	}
+
+	/**
+	 * \param [in] notificationPending selects whether notification of the thread is pending
+	 */
+
+	void setNotificationPending(const bool notificationPending)
+	{
+		notificationPending_ = notificationPending;
+	}
+
+	/**
+	 * \param [in] notificationValue is the new notification value of the thread
+	 */
+
+	void setNotificationValue(const uint32_t notificationValue)
+	{
+		notificationValue_ = notificationValue;
+	}
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
@@ -215,17 +474,52 @@ public:
 	 * protocol) that blocks this thread
 	 */
 
-	void setPriorityInheritanceMutexControlBlock(const MutexControlBlock* const priorityInheritanceMutexControlBlock)
+	void setPriorityInheritanceMutexControlBlock(MutexControlBlock* const priorityInheritanceMutexControlBlock)
 	{
 		priorityInheritanceMutexControlBlock_ = priorityInheritanceMutexControlBlock;
 	}
 
+	/**
+	 * \param [in] priorityInheritanceSharedMutexControlBlock is a pointer to SharedMutexControlBlock that blocks this
+	 * thread
+	 */
+
+	void setPriorityInheritanceSharedMutexControlBlock(
+			SharedMutexControlBlock* const priorityInheritanceSharedMutexControlBlock)
+	{
+		priorityInheritanceSharedMutexControlBlock_ = priorityInheritanceSharedMutexControlBlock;
+	}
+
+	/**
+	 * \brief Changes length of round-robin quantum of thread.
+	 *
+	 * The new length is used starting with the current quantum of thread.
+	 *
+	 * \param [in] length is the new length of round-robin quantum, RoundRobinQuantum::Duration{} to restore the default
+	 * length (RoundRobinQuantum::getInitial())
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a length is negative or cannot be represented by RoundRobinQuantum;
+	 */
+
+	int setRoundRobinQuantum(TickClock::duration length);
+
 	/**
 	 * param [in] schedulingPolicy is the new scheduling policy of the thread
 	 */
 
 	void setSchedulingPolicy(SchedulingPolicy schedulingPolicy);
 
+	/**
+	 * \param [in] semaphoreRequestedValue is the number of units of Semaphore requested by the thread which is about
+	 * to be blocked on that semaphore
+	 */
+
+	void setSemaphoreRequestedValue(const unsigned int semaphoreRequestedValue)
+	{
+		semaphoreRequestedValue_ = semaphoreRequestedValue;
+	}
+
 	/**
 	 * \param [in] state is the new state of object
 	 */
@@ -235,17 +529,39 @@ public:
 		state_ = state;
 	}
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+	/**
+	 * \brief Changes "throttled" state of thread.
+	 *
+	 * Throttled thread runs only with priority boosted by mutexes. If the effective priority really changes, the
+	 * position in the thread list is adjusted and context switch may be requested.
+	 *
+	 * \attention This function should be called only by CpuBudgetControlBlock.
+	 *
+	 * \param [in] throttled selects whether the thread is throttled (true) or not (false)
+	 */
+
+	void setThrottled(bool throttled);
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
 	/**
 	 * \brief Hook function called when context is switched to this thread.
 	 *
-	 * Sets global _impure_ptr (from newlib) to thread's \a reent_ member variable.
+	 * Sets global _impure_ptr (from newlib) to thread's \a reent_ member variable. Does nothing if the C library is not
+	 * newlib.
 	 *
 	 * \attention This function should be called only by Scheduler::switchContext().
 	 */
 
 	void switchedToHook()
 	{
+#ifdef _NEWLIB_VERSION
+
 		_impure_ptr = &reent_;
+
+#endif	// def _NEWLIB_VERSION
 	}
 
 	/**
@@ -266,11 +582,14 @@ public:
 	 * This function should be called after all operations involving this thread and a mutex with enabled priority
 	 * protocol.
 	 *
-	 * \param [in] boostedPriority is the initial boosted priority, this should be effective priority of the thread that
-	 * is about to be blocked on a mutex owned by this thread, default - 0
+	 * Boosted priority of the thread is the "boosted priority" of the first mutex on the sorted list of owned mutexes,
+	 * so it doesn't depend on the number of owned mutexes. If effective priority of the thread changes while it is
+	 * blocked on a mutex with priorityInheritance protocol, the change is propagated iteratively to the owner(s) of
+	 * that mutex, stopping at the first mutex or thread which is not affected by the change. Threads which need an
+	 * update are kept on an intrusive list, so stack usage is constant.
 	 */
 
-	void updateBoostedPriority(uint8_t boostedPriority = {});
+	void updateBoostedPriority();
 
 	ThreadControlBlock(const ThreadControlBlock&) = delete;
 	ThreadControlBlock(ThreadControlBlock&&) = default;
@@ -279,6 +598,40 @@ public:
 
 private:
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \brief Changes absolute deadline of thread without checking its scheduling policy.
+	 *
+	 * \param [in] deadline is the new absolute deadline of thread
+	 */
+
+	void changeDeadline(TickClock::time_point deadline);
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \brief Updates "boosted priority" of the mutex with priorityInheritance protocol that blocks this thread.
+	 *
+	 * This function should be called after effective priority of the thread changes. If the thread is blocked on a
+	 * shared mutex, all of its owners are updated directly.
+	 *
+	 * \return pointer to owner of the mutex if its boosted priority must be updated, nullptr otherwise
+	 */
+
+	ThreadControlBlock* propagateEffectivePriority() const;
+
+	/**
+	 * \brief Recalculates boosted priority of the thread from the list of owned mutexes.
+	 *
+	 * If effective priority of the thread changes, the thread is repositioned and the change is propagated to the mutex
+	 * that blocks this thread.
+	 *
+	 * \return pointer to thread which must be updated next, nullptr otherwise
+	 */
+
+	ThreadControlBlock* recalculateBoostedPriority();
+
 	/**
 	 * \brief Repositions the thread on the list it's currently on.
 	 *
@@ -286,21 +639,32 @@ private:
 	 *
 	 * \attention list_ must not be nullptr
 	 *
+	 * \param [in] oldEffectivePriority is the effective priority of the thread before the change
 	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
 	 * priority is raised!):
-	 * - true - the thread is moved to the head of the group of threads with the new priority, this is accomplished by
-	 * temporarily boosting effective priority by 1,
+	 * - true - the thread is moved to the head of the group of threads with the new priority,
 	 * - false - the thread is moved to the tail of the group of threads with the new priority.
 	 */
 
-	void reposition(bool loweringBefore);
+	void reposition(uint8_t oldEffectivePriority, bool loweringBefore);
 
 	/// list of mutexes (mutex control blocks) with enabled priority protocol owned by this thread
 	MutexList ownedProtocolMutexList_;
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+	/// pointer to CpuBudgetControlBlock with which this object is associated, nullptr if none
+	CpuBudgetControlBlock* cpuBudgetControlBlock_;
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#ifdef _NEWLIB_VERSION
+
 	/// newlib's _reent structure with thread-specific data
 	_reent reent_;
 
+#endif	// def _NEWLIB_VERSION
+
 	/// internal stack object
 	Stack stack_;
 
@@ -311,11 +675,32 @@ private:
 	RunnableThread& owner_;
 
 	/// pointer to MutexControlBlock (with priorityInheritance protocol) that blocks this thread
-	const MutexControlBlock* priorityInheritanceMutexControlBlock_;
+	MutexControlBlock* priorityInheritanceMutexControlBlock_;
+
+	/// pointer to SharedMutexControlBlock that blocks this thread
+	SharedMutexControlBlock* priorityInheritanceSharedMutexControlBlock_;
+
+	/// pointer to MutexControlBlock used by the thread blocked on ConditionVariable, nullptr if the wait of the thread
+	/// must not be moved to that mutex
+	MutexControlBlock* conditionVariableMutexControlBlock_;
+
+	/// next thread on the list of threads waiting for update of boosted priority, pointer to this object if it is the
+	/// last one on the list, nullptr if this thread is not on the list
+	ThreadControlBlock* nextBoostedPriorityUpdate_;
 
 	/// sequence number, one half of thread identifier
 	uintptr_t sequenceNumber_;
 
+	/// number of units of Semaphore requested by the thread blocked on that semaphore (same type as Semaphore::Value)
+	unsigned int semaphoreRequestedValue_;
+
+	/// event bits of EventGroup awaited by the thread blocked on that event group, replaced with event bits which
+	/// satisfied the wait when the thread is unblocked (same type as EventGroup::Bits)
+	uint32_t eventGroupBits_;
+
+	/// notification value of the thread
+	uint32_t notificationValue_;
+
 #if CONFIG_SIGNALS_ENABLE == 1
 
 	/// pointer to SignalsReceiverControlBlock object for this thread, nullptr if this thread cannot receive signals
@@ -332,6 +717,26 @@ private:
 	/// round-robin quantum
 	RoundRobinQuantum roundRobinQuantum_;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/// run time of thread, in units of run time counter
+	uint64_t runTime_;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/// number of periods in which the thread missed its deadline
+	uint32_t deadlineMissCount_;
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/// flags describing the wait of the thread blocked on EventGroup
+	uint8_t eventGroupWaitFlags_;
+
+	/// true if notification of the thread is pending (it was not yet received by the thread), false otherwise
+	bool notificationPending_;
+
 	/// scheduling policy of the thread
 	SchedulingPolicy schedulingPolicy_;
 
@@ -45,6 +45,24 @@ public:
 
 	void add(ThreadControlBlock& threadControlBlock);
 
+	/**
+	 * \brief Executes provided functor for each thread in this group.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 *
+	 * \tparam Functor is the type of functor, it will be called with const reference to ThreadControlBlock as the only
+	 * argument
+	 *
+	 * \param [in] functor is the functor which will be executed for each thread in this group
+	 */
+
+	template<typename Functor>
+	void forEach(Functor&& functor) const
+	{
+		for (auto& threadControlBlock : threadList_)
+			functor(threadControlBlock);
+	}
+
 private:
 
 	/// intrusive list of threads (thread control blocks)
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadList class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -24,7 +24,13 @@ namespace internal
 
 class ThreadControlBlock;
 
-/// functor which gives descending effective priority order of elements on the list
+/**
+ * \brief Functor which gives descending effective priority order of elements on the list.
+ *
+ * If SchedulingPolicy::earliestDeadlineFirst is enabled, elements with equal effective priority are additionally
+ * ordered by ascending deadline.
+ */
+
 struct ThreadDescendingEffectivePriority
 {
 	/**
@@ -42,12 +48,25 @@ struct ThreadDescendingEffectivePriority
 	 * \param [in] left is the object on the left-hand side of comparison
 	 * \param [in] right is the object on the right-hand side of comparison
 	 *
-	 * \return true if left's effective priority is less than right's effective priority
+	 * \return true if left's effective priority is less than right's effective priority (or - if
+	 * SchedulingPolicy::earliestDeadlineFirst is enabled - if effective priorities are equal and left's deadline is
+	 * later than right's deadline)
 	 */
 
 	bool operator()(const ThreadListNode& left, const ThreadListNode& right) const
 	{
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+		const auto leftPriority = left.getEffectivePriority();
+		const auto rightPriority = right.getEffectivePriority();
+		return leftPriority < rightPriority ||
+				(leftPriority == rightPriority && left.getDeadline() > right.getDeadline());
+
+#else	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE != 1
+
 		return left.getEffectivePriority() < right.getEffectivePriority();
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE != 1
 	}
 };
 
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadListNode class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,14 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADLISTNODE_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADLISTNODE_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+#include "distortos/TickClock.hpp"
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 #include "estd/IntrusiveList.hpp"
 
 namespace distortos
@@ -40,18 +48,49 @@ public:
 	constexpr explicit ThreadListNode(const uint8_t priority) :
 			threadListNode{},
 			threadGroupNode{},
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+			cpuBudgetNode{},
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+			deadline_{TickClock::time_point::max()},
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+			throttled_{},
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
 			priority_{priority},
 			boostedPriority_{}
 	{
 
 	}
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/**
+	 * \return absolute deadline of thread, TickClock::time_point::max() if thread doesn't use
+	 * SchedulingPolicy::earliestDeadlineFirst or if its deadline was not set
+	 */
+
+	TickClock::time_point getDeadline() const
+	{
+		return deadline_;
+	}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 	/**
 	 * \return effective priority of thread
 	 */
 
 	uint8_t getEffectivePriority() const
 	{
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+		// throttled thread runs only with priority boosted by mutexes, so it can release them
+		if (throttled_ == true)
+			return boostedPriority_;
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
 		return std::max(priority_, boostedPriority_);
 	}
 
@@ -70,8 +109,29 @@ public:
 	/// node for intrusive list in thread group
 	estd::IntrusiveListNode threadGroupNode;
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+	/// node for intrusive list in CPU budget
+	estd::IntrusiveListNode cpuBudgetNode;
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
 protected:
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	/// thread's absolute deadline, TickClock::time_point::max() if not set
+	TickClock::time_point deadline_;
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+	/// true if thread's CPU budget is exhausted, false otherwise
+	bool throttled_;
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
 	/// thread's priority, 0 - lowest, UINT8_MAX - highest
 	uint8_t priority_;
 
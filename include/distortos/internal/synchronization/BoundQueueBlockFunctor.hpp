@@ -0,0 +1,89 @@
+/**
+ * \file
+ * \brief BoundQueueBlockFunctor class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_BOUNDQUEUEBLOCKFUNCTOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_BOUNDQUEUEBLOCKFUNCTOR_HPP_
+
+#include "distortos/internal/synchronization/QueueBlockFunctor.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief BoundQueueBlockFunctor is a type-erased QueueBlockFunctor which calls its bound functor to execute actions on
+ * contiguous block of elements in queue's storage
+ *
+ * \tparam F is the type of bound functor, it will be called with <em>void*</em> and <em>size_t</em> as arguments
+ */
+
+template<typename F>
+class BoundQueueBlockFunctor : public QueueBlockFunctor
+{
+public:
+
+	/**
+	 * \brief BoundQueueBlockFunctor's constructor
+	 *
+	 * \param [in] boundFunctor is a rvalue reference to bound functor which will be used to move-construct internal
+	 * bound functor
+	 */
+
+	constexpr explicit BoundQueueBlockFunctor(F&& boundFunctor) :
+			boundFunctor_{std::move(boundFunctor)}
+	{
+
+	}
+
+	/**
+	 * \brief Calls the bound functor which will execute some action on contiguous block of elements in queue's storage
+	 * (like copying, copy-constructing, swapping, ...)
+	 *
+	 * \param [in,out] storage is a pointer to storage with/for first element of the block
+	 * \param [in] count is the number of elements in the block
+	 */
+
+	void operator()(void* const storage, const size_t count) const override
+	{
+		boundFunctor_(storage, count);
+	}
+
+private:
+
+	/// bound functor
+	F boundFunctor_;
+};
+
+/**
+ * \brief Helper factory function to make BoundQueueBlockFunctor object with deduced template arguments
+ *
+ * \tparam F is the type of bound functor, it will be called with <em>void*</em> and <em>size_t</em> as arguments
+ *
+ * \param [in] boundFunctor is a rvalue reference to bound functor which will be used to move-construct returned object
+ *
+ * \return BoundQueueBlockFunctor object with deduced template arguments
+ */
+
+template<typename F>
+constexpr BoundQueueBlockFunctor<F> makeBoundQueueBlockFunctor(F&& boundFunctor)
+{
+	return BoundQueueBlockFunctor<F>{std::move(boundFunctor)};
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_BOUNDQUEUEBLOCKFUNCTOR_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,7 @@
 
 #include "distortos/Semaphore.hpp"
 
+#include "distortos/internal/synchronization/QueueBlockFunctor.hpp"
 #include "distortos/internal/synchronization/QueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
 
@@ -59,6 +60,26 @@ public:
 		return elementSize_;
 	}
 
+	/**
+	 * \return reference to semaphore guarding access to "pop" functions, its value is equal to the number of elements
+	 * in the queue
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return popSemaphore_;
+	}
+
+	/**
+	 * \return reference to semaphore guarding access to "push" functions, its value is equal to the number of free
+	 * slots in the queue
+	 */
+
+	Semaphore& getPushSemaphore()
+	{
+		return pushSemaphore_;
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -76,6 +97,28 @@ public:
 		return popPush(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_);
 	}
 
+	/**
+	 * \brief Implementation of popN() using type-erased functor
+	 *
+	 * After waiting for the first element with \a waitSemaphoreFunctor, as many of remaining elements as are available
+	 * (but no more than \a count) are popped under the same critical section.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [in] functor is a reference to QueueBlockFunctor which will execute actions related to popping - it will
+	 * be called at most twice with contiguous blocks of elements starting at readPosition_
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueBlockFunctor& functor,
+			const size_t count)
+	{
+		return popPushN(waitSemaphoreFunctor, functor, count, popSemaphore_, pushSemaphore_, readPosition_);
+	}
+
 	/**
 	 * \brief Implementation of push() using type-erased functor
 	 *
@@ -93,6 +136,28 @@ public:
 		return popPush(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_);
 	}
 
+	/**
+	 * \brief Implementation of pushN() using type-erased functor
+	 *
+	 * After waiting for the first free slot with \a waitSemaphoreFunctor, as many of remaining elements as there are
+	 * free slots (but no more than \a count) are pushed under the same critical section.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] functor is a reference to QueueBlockFunctor which will execute actions related to pushing - it will
+	 * be called at most twice with contiguous blocks of free slots starting at writePosition_
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueBlockFunctor& functor,
+			const size_t count)
+	{
+		return popPushN(waitSemaphoreFunctor, functor, count, pushSemaphore_, popSemaphore_, writePosition_);
+	}
+
 private:
 
 	/**
@@ -116,6 +181,29 @@ private:
 	int popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor, Semaphore& waitSemaphore,
 			Semaphore& postSemaphore, void*& storage);
 
+	/**
+	 * \brief Implementation of popN() and pushN() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
+	 * \param [in] functor is a reference to QueueBlockFunctor which will execute actions related to popping/pushing -
+	 * it will be called at most twice with contiguous blocks starting at \a storage
+	 * \param [in] count is the maximum number of elements which will be popped/pushed
+	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for popN(), \a
+	 * pushSemaphore_ for pushN()
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted after the operation, \a pushSemaphore_
+	 * for popN(), \a popSemaphore_ for pushN()
+	 * \param [in] storage is a reference to appropriate pointer to storage, which will be passed to \a functor, \a
+	 * readPosition_ for popN(), \a writePosition_ for pushN()
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped/pushed elements; error
+	 * codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popPushN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueBlockFunctor& functor,
+			size_t count, Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage);
+
 	/// semaphore guarding access to "pop" functions - its value is equal to the number of available elements
 	Semaphore popSemaphore_;
 
@@ -144,6 +144,26 @@ public:
 
 	~MessageQueueBase();
 
+	/**
+	 * \return reference to semaphore guarding access to "pop" functions, its value is equal to the number of elements
+	 * in the queue
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return popSemaphore_;
+	}
+
+	/**
+	 * \return reference to semaphore guarding access to "push" functions, its value is equal to the number of free
+	 * slots in the queue
+	 */
+
+	Semaphore& getPushSemaphore()
+	{
+		return pushSemaphore_;
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
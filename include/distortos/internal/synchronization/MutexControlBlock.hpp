@@ -13,9 +13,11 @@
 #define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MUTEXCONTROLBLOCK_HPP_
 
 #include "distortos/internal/scheduler/ThreadList.hpp"
+#include "distortos/internal/scheduler/UnblockReason.hpp"
 
 #include "distortos/internal/synchronization/MutexListNode.hpp"
 
+#include "distortos/MutexMode.hpp"
 #include "distortos/MutexProtocol.hpp"
 #include "distortos/MutexType.hpp"
 #include "distortos/TickClock.hpp"
@@ -33,6 +35,9 @@ class MutexControlBlock : public MutexListNode
 {
 public:
 
+	/// mode in which mutex is passed to waiting threads
+	using Mode = MutexMode;
+
 	/// mutex protocols
 	using Protocol = MutexProtocol;
 
@@ -43,36 +48,73 @@ public:
 	using Type = MutexType;
 
 	/**
-	 * \brief Gets "boosted priority" of the mutex.
+	 * \return owner of the mutex, nullptr if mutex is currently unlocked
+	 */
+
+	ThreadControlBlock* getOwner() const
+	{
+		return owner_;
+	}
+
+	/**
+	 * \brief Moves thread blocked on ConditionVariable to the mutex.
+	 *
+	 * If the mutex is locked, the thread is transferred to blockedList_ without being unblocked, so that it is woken
+	 * only when the lock is handed over to it. If the mutex is unlocked, the lock is given to the thread directly and it
+	 * must be unblocked by the caller. Threads are never moved to mutexes with priorityProtect protocol.
+	 *
+	 * \attention thread must have released this mutex before blocking on ConditionVariable
 	 *
-	 * "Boosted priority" of the mutex depends on the selected priority protocol:
-	 * - none - 0,
-	 * - priorityInheritance - effective priority of the highest priority thread blocked on this mutex or 0 if no
-	 * threads are blocked,
-	 * - priorityProtect - priority ceiling.
+	 * \param [in] iterator is the iterator which points to ThreadControlBlock of thread blocked on ConditionVariable
 	 *
-	 * \return "boosted priority" of the mutex
+	 * \return true if the thread was transferred to blockedList_, false if it must be unblocked by the caller (mutex was
+	 * locked for the thread or its protocol is priorityProtect)
 	 */
 
-	uint8_t getBoostedPriority() const;
+	bool requeue(ThreadList::iterator iterator);
 
 	/**
-	 * \return owner of the mutex, nullptr if mutex is currently unlocked
+	 * \brief Unblock hook of thread that is blocked on the mutex.
+	 *
+	 * In case of priorityInheritance protocol, pointer to MutexControlBlock which caused the thread to block is reset to
+	 * nullptr. If the wait for mutex was interrupted, boosted priority of the mutex and - if it changed - of current
+	 * owner of the mutex is updated. In all other cases this function does nothing.
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock that is being unblocked
+	 * \param [in] unblockReason is the reason of thread unblocking
 	 */
 
-	ThreadControlBlock* getOwner() const
-	{
-		return owner_;
-	}
+	void unblockHook(ThreadControlBlock& threadControlBlock, UnblockReason unblockReason);
+
+	/**
+	 * \brief Updates "boosted priority" of the mutex.
+	 *
+	 * "Boosted priority" of the mutex with priorityInheritance protocol is the effective priority of the highest
+	 * priority thread blocked on this mutex. If it changes, the mutex is repositioned on the sorted list of mutexes
+	 * owned by its owner. For other protocols this function does nothing, as their "boosted priority" is constant.
+	 *
+	 * \param [in] boostedPriority is the minimal "boosted priority", this should be effective priority of the thread
+	 * that is about to be blocked on this mutex, default - 0
+	 *
+	 * \return true if "boosted priority" of the mutex was changed, false otherwise
+	 */
+
+	bool updateBoostedPriority(uint8_t boostedPriority = {});
 
 	/// shift of "type" subfield, bits
 	constexpr static uint8_t typeShift {0};
 
 	/// width of "type" subfield, bits
-	constexpr static uint8_t typeWidth {CHAR_BIT / 2};
+	constexpr static uint8_t typeWidth {CHAR_BIT / 2 - 1};
+
+	/// shift of "mode" subfield, bits
+	constexpr static uint8_t modeShift {typeShift + typeWidth};
+
+	/// width of "mode" subfield, bits
+	constexpr static uint8_t modeWidth {1};
 
 	/// shift of "protocol" subfield, bits
-	constexpr static uint8_t protocolShift {typeShift + typeWidth};
+	constexpr static uint8_t protocolShift {modeShift + modeWidth};
 
 	/// width of "protocol" subfield, bits
 	constexpr static uint8_t protocolWidth {CHAR_BIT / 2};
@@ -85,16 +127,17 @@ protected:
 	 * \param [in] type is the type of mutex
 	 * \param [in] protocol is the mutex protocol
 	 * \param [in] priorityCeiling is the priority ceiling of mutex, ignored when protocol != Protocol::priorityProtect
+	 * \param [in] mode is the mode in which mutex is passed to waiting threads
 	 */
 
-	constexpr MutexControlBlock(const Type type, const Protocol protocol, const uint8_t priorityCeiling) :
-			MutexListNode{},
-			blockedList_{},
-			owner_{},
-			recursiveLocksCount_{},
-			priorityCeiling_{priorityCeiling},
+	constexpr MutexControlBlock(const Type type, const Protocol protocol, const uint8_t priorityCeiling,
+			const Mode mode) :
+			MutexListNode{protocol == Protocol::priorityProtect ? priorityCeiling : uint8_t{}},
 			typeProtocol_{static_cast<uint8_t>(static_cast<uint8_t>(type) << typeShift |
-					static_cast<uint8_t>(protocol) << protocolShift)}
+					static_cast<uint8_t>(mode) << modeShift | static_cast<uint8_t>(protocol) << protocolShift)},
+			recursiveLocksCount_{},
+			blockedList_{},
+			owner_{}
 	{
 
 	}
@@ -130,20 +173,56 @@ protected:
 	/**
 	 * \brief Performs unlocking or transfer of lock from current owner to next thread on the list.
 	 *
-	 * Mutex is unlocked if blockedList_ is empty, otherwise the ownership is transfered to the next thread.
+	 * Mutex is unlocked if blockedList_ is empty, otherwise the ownership is transfered to the next thread. In
+	 * Mode::competitive the mutex is always unlocked and the next thread is just unblocked.
 	 *
 	 * \attention mutex must be locked
 	 */
 
 	void doUnlockOrTransferLock();
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	/**
+	 * \brief Tries to lock unlocked mutex with Protocol::none without masking interrupts.
+	 *
+	 * Owner of the mutex is changed from nullptr to current thread with exclusive access.
+	 *
+	 * \return true if mutex was locked, false if it must be locked with interrupts masked (mutex is locked or its
+	 * protocol is not Protocol::none)
+	 */
+
+	bool tryLockExclusive();
+
+	/**
+	 * \brief Tries to unlock mutex with Protocol::none without masking interrupts.
+	 *
+	 * Owner of the mutex is changed from current thread to nullptr with exclusive access, but only if no threads are
+	 * waiting for the mutex and it is not locked recursively.
+	 *
+	 * \return true if mutex was unlocked, false if it must be unlocked with interrupts masked
+	 */
+
+	bool tryUnlockExclusive();
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	/**
+	 * \return mode in which mutex is passed to waiting threads
+	 */
+
+	Mode getMode() const
+	{
+		return static_cast<Mode>((typeProtocol_ >> modeShift) & ((1 << modeWidth) - 1));
+	}
+
 	/**
 	 * \return priority ceiling of mutex, valid only when protocol_ == Protocol::priorityProtect
 	 */
 
 	uint8_t getPriorityCeiling() const
 	{
-		return priorityCeiling_;
+		return getBoostedPriority();
 	}
 
 	/**
@@ -184,7 +263,7 @@ private:
 	 * \attention must be called in block() and blockUntil() before actually blocking of the calling thread.
 	 */
 
-	void beforeBlock() const;
+	void beforeBlock();
 
 	/**
 	 * \brief Performs transfer of lock from current owner to next thread on the list.
@@ -202,20 +281,29 @@ private:
 
 	void doUnlock();
 
-	/// ThreadControlBlock objects blocked on mutex
-	ThreadList blockedList_;
+	/**
+	 * \brief Performs actual unlocking of previously locked mutex and unblocks next thread on the list.
+	 *
+	 * Unblocked thread is not the owner of the mutex - it must try to lock it again.
+	 *
+	 * \attention mutex must be locked and blockedList_ must not be empty
+	 */
 
-	/// owner of the mutex
-	ThreadControlBlock* owner_;
+	void doUnlockAndUnblock();
+
+	// small members are placed first, so that they fill the padding after MutexListNode::boostedPriority_
+
+	/// type of mutex, its mode and its protocol
+	uint8_t typeProtocol_;
 
 	/// number of recursive locks, used when mutex type is recursive
 	RecursiveLocksCount recursiveLocksCount_;
 
-	/// priority ceiling of mutex, valid only when protocol_ == Protocol::priorityProtect
-	uint8_t priorityCeiling_;
+	/// ThreadControlBlock objects blocked on mutex
+	ThreadList blockedList_;
 
-	/// type of mutex and its protocol
-	uint8_t typeProtocol_;
+	/// owner of the mutex
+	ThreadControlBlock* owner_;
 };
 
 }	// namespace internal
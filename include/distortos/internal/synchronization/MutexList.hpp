@@ -14,6 +14,8 @@
 
 #include "distortos/internal/synchronization/MutexListNode.hpp"
 
+#include "estd/SortedIntrusiveList.hpp"
+
 namespace distortos
 {
 
@@ -22,8 +24,35 @@ namespace internal
 
 class MutexControlBlock;
 
-/// intrusive list of mutexes (mutex control blocks)
-using MutexList = estd::IntrusiveList<MutexListNode, &MutexListNode::node, MutexControlBlock>;
+/// functor which gives descending "boosted priority" order of elements on the list
+struct MutexDescendingBoostedPriority
+{
+	/**
+	 * \brief MutexDescendingBoostedPriority's constructor
+	 */
+
+	constexpr MutexDescendingBoostedPriority()
+	{
+
+	}
+
+	/**
+	 * \brief MutexDescendingBoostedPriority's function call operator
+	 *
+	 * \param [in] left is the object on the left-hand side of comparison
+	 * \param [in] right is the object on the right-hand side of comparison
+	 *
+	 * \return true if left's "boosted priority" is less than right's "boosted priority"
+	 */
+
+	bool operator()(const MutexListNode& left, const MutexListNode& right) const
+	{
+		return left.getBoostedPriority() < right.getBoostedPriority();
+	}
+};
+
+/// sorted intrusive list of mutexes (mutex control blocks and owner slots of shared mutex control blocks)
+using MutexList = estd::SortedIntrusiveList<MutexDescendingBoostedPriority, MutexListNode, &MutexListNode::node>;
 
 }	// namespace internal
 
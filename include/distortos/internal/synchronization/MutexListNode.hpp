@@ -14,6 +14,8 @@
 
 #include "estd/IntrusiveList.hpp"
 
+#include <cstdint>
+
 namespace distortos
 {
 
@@ -34,16 +36,41 @@ public:
 
 	/**
 	 * \brief MutexListNode's constructor
+	 *
+	 * \param [in] boostedPriority is the initial "boosted priority" of the mutex
 	 */
 
-	constexpr MutexListNode() :
-			node{}
+	constexpr explicit MutexListNode(const uint8_t boostedPriority) :
+			node{},
+			boostedPriority_{boostedPriority}
 	{
 
 	}
 
+	/**
+	 * \brief Gets "boosted priority" of the mutex.
+	 *
+	 * "Boosted priority" of the mutex depends on the selected priority protocol:
+	 * - none - 0,
+	 * - priorityInheritance - effective priority of the highest priority thread blocked on this mutex or 0 if no
+	 * threads are blocked,
+	 * - priorityProtect - priority ceiling.
+	 *
+	 * \return "boosted priority" of the mutex
+	 */
+
+	uint8_t getBoostedPriority() const
+	{
+		return boostedPriority_;
+	}
+
 	/// node for intrusive list
 	estd::IntrusiveListNode node;
+
+protected:
+
+	/// "boosted priority" of the mutex, kept up-to-date by MutexControlBlock
+	uint8_t boostedPriority_;
 };
 
 }	// namespace internal
@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \brief QueueBlockFunctor class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_QUEUEBLOCKFUNCTOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_QUEUEBLOCKFUNCTOR_HPP_
+
+#include "estd/TypeErasedFunctor.hpp"
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief QueueBlockFunctor is a type-erased interface for functors which execute some action on contiguous block of
+ * elements in queue's storage (like copying, copy-constructing, swapping, ...).
+ *
+ * The functor will be called by queue internals with two arguments - \a storage - which is a pointer to storage
+ * with/for first element of the block, and \a count - which is the number of elements in the block. During one
+ * operation the functor is called at most twice (before and after wrap-around of queue's storage), the second block
+ * always continues where the first one ended.
+ */
+
+class QueueBlockFunctor : public estd::TypeErasedFunctor<void(void*, size_t)>
+{
+
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_QUEUEBLOCKFUNCTOR_HPP_
@@ -0,0 +1,271 @@
+/**
+ * \file
+ * \brief SharedMutexControlBlock class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SHAREDMUTEXCONTROLBLOCK_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SHAREDMUTEXCONTROLBLOCK_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+#include "distortos/internal/scheduler/UnblockReason.hpp"
+
+#include "distortos/internal/synchronization/MutexListNode.hpp"
+
+#include "distortos/TickClock.hpp"
+
+#include <memory>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief SharedMutexControlBlock class is a control block for SharedMutex
+ *
+ * Each owner of the shared mutex - single writer or one of the readers - occupies one slot. Slots are linked into the
+ * lists of mutexes owned by their threads, so threads blocked on the shared mutex boost the priority of all current
+ * owners, the same way as Mutex with priorityInheritance protocol boosts its single owner.
+ */
+
+class SharedMutexControlBlock
+{
+public:
+
+	/// Owner class is a slot for single owner of the shared mutex
+	class Owner : public MutexListNode
+	{
+	public:
+
+		/**
+		 * \brief Owner's constructor
+		 */
+
+		constexpr Owner() :
+				MutexListNode{{}},
+				threadControlBlock_{}
+		{
+
+		}
+
+		/**
+		 * \return pointer to ThreadControlBlock of thread which occupies this slot, nullptr if the slot is free
+		 */
+
+		ThreadControlBlock* getThreadControlBlock() const
+		{
+			return threadControlBlock_;
+		}
+
+		/**
+		 * \param [in] boostedPriority is the new "boosted priority" of the slot
+		 */
+
+		void setBoostedPriority(const uint8_t boostedPriority)
+		{
+			boostedPriority_ = boostedPriority;
+		}
+
+		/**
+		 * \param [in] threadControlBlock is a pointer to ThreadControlBlock of thread which occupies this slot, nullptr
+		 * to free the slot
+		 */
+
+		void setThreadControlBlock(ThreadControlBlock* const threadControlBlock)
+		{
+			threadControlBlock_ = threadControlBlock;
+		}
+
+	private:
+
+		/// pointer to ThreadControlBlock of thread which occupies this slot, nullptr if the slot is free
+		ThreadControlBlock* threadControlBlock_;
+	};
+
+	/// type of uninitialized storage for Owner objects
+	using Storage = std::aligned_storage<sizeof(Owner), alignof(Owner)>::type;
+
+	/// unique_ptr (with deleter) to Storage[]
+	using StorageUniquePointer = std::unique_ptr<Storage[], void(&)(Storage*)>;
+
+	/**
+	 * \brief SharedMutexControlBlock's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for Owner objects
+	 * (sufficiently large for \a storageSize elements) and appropriate deleter
+	 * \param [in] storageSize is the number of elements in \a storage array, this is the maximum number of readers which
+	 * may hold the lock at the same time, must be greater than 0
+	 */
+
+	SharedMutexControlBlock(StorageUniquePointer&& storageUniquePointer, size_t storageSize);
+
+	/**
+	 * \brief SharedMutexControlBlock's destructor
+	 */
+
+	~SharedMutexControlBlock();
+
+	/**
+	 * \brief Unblock hook of thread that is blocked on the shared mutex.
+	 *
+	 * Pointer to SharedMutexControlBlock which caused the thread to block is reset to nullptr. If the wait for the
+	 * shared mutex was interrupted, "boosted priority" of the shared mutex - and of all its current owners - is updated.
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock that is being unblocked
+	 * \param [in] unblockReason is the reason of thread unblocking
+	 */
+
+	void unblockHook(ThreadControlBlock& threadControlBlock, UnblockReason unblockReason);
+
+	/**
+	 * \brief Updates "boosted priority" of the shared mutex.
+	 *
+	 * "Boosted priority" of the shared mutex is the effective priority of the highest priority thread blocked on it -
+	 * either as a reader or as a writer. If it changes, new value is applied to all occupied slots, which are
+	 * repositioned on the sorted lists of mutexes owned by their threads, and effective priorities of these threads are
+	 * updated.
+	 *
+	 * \param [in] boostedPriority is the minimal "boosted priority", this should be effective priority of the thread
+	 * that is about to be blocked on this shared mutex, default - 0
+	 *
+	 * \return true if "boosted priority" of the shared mutex was changed, false otherwise
+	 */
+
+	bool updateBoostedPriority(uint8_t boostedPriority = {});
+
+protected:
+
+	/**
+	 * \brief Implementation of all lock functions of SharedMutex.
+	 *
+	 * Shared lock is acquired immediately only if the shared mutex is not locked exclusively, no writer is waiting and
+	 * there is a free slot. Exclusive lock is acquired immediately only if the shared mutex is not locked at all.
+	 *
+	 * \attention interrupts must be masked
+	 *
+	 * \param [in] shared selects whether shared (true) or exclusive (false) lock is acquired
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode (true)
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, used only if blocking mode is
+	 * selected, nullptr to block without timeout
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EBUSY - the shared mutex could not be locked without blocking (or the current thread already owns it) and
+	 * non-blocking mode was selected;
+	 * - EDEADLK - the current thread already owns the shared mutex (shared or exclusively) and blocking mode was
+	 * selected;
+	 * - ETIMEDOUT - the shared mutex could not be locked before the specified timeout expired;
+	 */
+
+	int lockImplementation(bool shared, bool nonBlocking, const TickClock::time_point* timePoint);
+
+	/**
+	 * \brief Implementation of all unlock functions of SharedMutex.
+	 *
+	 * If any writer is waiting, the lock is handed over to the highest priority writer as soon as the last owner
+	 * releases the shared mutex. Otherwise free slots are handed over to waiting readers, in priority order.
+	 *
+	 * \attention interrupts must be masked
+	 *
+	 * \param [in] shared selects whether shared (true) or exclusive (false) lock is released
+	 *
+	 * \return 0 if the caller successfully unlocked the shared mutex, error code otherwise:
+	 * - EPERM - the current thread does not own the shared mutex in selected mode;
+	 */
+
+	int unlockImplementation(bool shared);
+
+private:
+
+	/**
+	 * \brief Occupies free slot with given thread.
+	 *
+	 * \param [in] owner is a reference to free slot
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock of new owner of the shared mutex
+	 */
+
+	void acquire(Owner& owner, ThreadControlBlock& threadControlBlock);
+
+	/**
+	 * \brief Finds slot occupied by given thread.
+	 *
+	 * \param [in] threadControlBlock is a pointer to ThreadControlBlock of thread which is searched for, nullptr to find
+	 * free slot
+	 *
+	 * \return pointer to found slot, nullptr if no slot is occupied by \a threadControlBlock
+	 */
+
+	Owner* findOwner(const ThreadControlBlock* threadControlBlock) const;
+
+	/**
+	 * \return pointer to first element of range of Owner objects
+	 */
+
+	Owner* getOwnersBegin() const
+	{
+		return reinterpret_cast<Owner*>(storageUniquePointer_.get());
+	}
+
+	/**
+	 * \brief Frees occupied slot.
+	 *
+	 * \param [in] owner is a reference to occupied slot
+	 */
+
+	void release(Owner& owner);
+
+	/**
+	 * \brief Tries to lock the shared mutex without blocking.
+	 *
+	 * \param [in] shared selects whether shared (true) or exclusive (false) lock is acquired
+	 *
+	 * \return 0 if the caller successfully locked the shared mutex, error code otherwise:
+	 * - EBUSY - the shared mutex could not be locked without blocking;
+	 * - EDEADLK - the current thread already owns the shared mutex (shared or exclusively);
+	 */
+
+	int tryLockInternal(bool shared);
+
+	/**
+	 * \brief Hands the shared mutex over to waiting threads.
+	 *
+	 * Does nothing if the shared mutex is locked exclusively. If any writer is waiting, exclusive lock is handed over to
+	 * the first of them, but only if the shared mutex is not locked at all. Otherwise free slots are handed over to
+	 * waiting readers.
+	 */
+
+	void transferLocks();
+
+	/// storage for Owner objects
+	StorageUniquePointer storageUniquePointer_;
+
+	/// ThreadControlBlock objects of readers blocked on shared mutex
+	ThreadList readersBlockedList_;
+
+	/// ThreadControlBlock objects of writers blocked on shared mutex
+	ThreadList writersBlockedList_;
+
+	/// pointer to "one past the last" element of range of Owner objects
+	Owner* ownersEnd_;
+
+	/// number of occupied slots
+	size_t ownersCount_;
+
+	/// "boosted priority" of the shared mutex, applied to all occupied slots
+	uint8_t boostedPriority_;
+
+	/// true if the shared mutex is locked exclusively, false otherwise
+	bool writeLocked_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SHAREDMUTEXCONTROLBLOCK_HPP_
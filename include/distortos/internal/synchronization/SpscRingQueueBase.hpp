@@ -0,0 +1,271 @@
+/**
+ * \file
+ * \brief SpscRingQueueBase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SPSCRINGQUEUEBASE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SPSCRINGQUEUEBASE_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief SpscRingQueueBase class implements basic functionality of SpscRingQueue template class
+ *
+ * Read and write positions are atomic variables, each modified by only one side - the write position by the producer,
+ * the read position by the consumer - so no locking is required. The MSB of each position is flipped on every
+ * wrap-around, which allows to distinguish full and empty queue without sacrificing one element of storage.
+ *
+ * Consumer blocks on a semaphore only when the queue is empty. Producer posts this semaphore only when the consumer
+ * announced that it is going to block, so in the common case the producer side doesn't mask interrupts at all.
+ */
+
+class SpscRingQueueBase
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/**
+	 * \brief SpscRingQueueBase's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for queue elements
+	 * (sufficiently large for \a maxElements, each \a elementSize bytes long) and appropriate deleter
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] maxElements is the number of elements in storage
+	 */
+
+	SpscRingQueueBase(StorageUniquePointer&& storageUniquePointer, size_t elementSize, size_t maxElements);
+
+	/**
+	 * \brief SpscRingQueueBase's destructor
+	 */
+
+	~SpscRingQueueBase();
+
+	/**
+	 * \return maximum number of elements in the queue
+	 */
+
+	size_t getCapacity() const
+	{
+		return capacity_;
+	}
+
+	/**
+	 * \return size of single queue element, bytes
+	 */
+
+	size_t getElementSize() const
+	{
+		return elementSize_;
+	}
+
+	/**
+	 * \brief Gets first contiguous block of elements available for reading.
+	 *
+	 * \warning This function may be called only by the consumer!
+	 *
+	 * \return first contiguous block (as a pair with pointer and number of elements) available for reading
+	 */
+
+	std::pair<const void*, size_t> getReadBlock() const;
+
+	/**
+	 * \brief Gets number of elements in the queue.
+	 *
+	 * \note Value returned by this function is only a snapshot - it may already be outdated when this function
+	 * returns.
+	 *
+	 * \return number of elements in the queue
+	 */
+
+	size_t getSize() const;
+
+	/**
+	 * \brief Gets first contiguous block of free slots available for writing.
+	 *
+	 * \warning This function may be called only by the producer!
+	 *
+	 * \return first contiguous block (as a pair with pointer and number of elements) available for writing
+	 */
+
+	std::pair<void*, size_t> getWriteBlock() const;
+
+	/**
+	 * \brief Increases read position, releasing elements read from block returned by getReadBlock().
+	 *
+	 * \warning This function may be called only by the consumer!
+	 *
+	 * \param [in] value is the number of elements which will be released, must not be greater than the size of block
+	 * returned by previous call to getReadBlock()
+	 */
+
+	void increaseReadPosition(size_t value);
+
+	/**
+	 * \brief Increases write position, publishing elements written to block returned by getWriteBlock().
+	 *
+	 * If the consumer is blocked waiting for data, it is unblocked.
+	 *
+	 * \warning This function may be called only by the producer!
+	 *
+	 * \param [in] value is the number of elements which will be published, must not be greater than the size of block
+	 * returned by previous call to getWriteBlock()
+	 */
+
+	void increaseWritePosition(size_t value);
+
+	/**
+	 * \brief Pops up to \a count elements from the queue.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks.
+	 *
+	 * \warning This function may be called only by the consumer!
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] count is the maximum number of elements which will be popped
+	 *
+	 * \return number of popped elements, 0 if queue is empty
+	 */
+
+	size_t pop(void* buffer, size_t count);
+
+	/**
+	 * \brief Pushes up to \a count elements to the queue.
+	 *
+	 * Elements are copied with memcpy() in at most two chunks.
+	 *
+	 * \warning This function may be called only by the producer!
+	 *
+	 * \param [in] data is a pointer to elements which will be pushed
+	 * \param [in] count is the maximum number of elements which will be pushed
+	 *
+	 * \return number of pushed elements, 0 if queue is full
+	 */
+
+	size_t push(const void* data, size_t count);
+
+	/**
+	 * \brief Waits until the queue is not empty.
+	 *
+	 * \warning This function may be called only by the consumer and it must not be called from interrupt context!
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a
+	 * notificationSemaphore_ when the queue is empty
+	 *
+	 * \return 0 if the queue is not empty, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int wait(const SemaphoreFunctor& waitSemaphoreFunctor);
+
+private:
+
+	/**
+	 * \brief Gets first contiguous block between \a begin and \a end.
+	 *
+	 * This function does not treat empty or full queue in any special way.
+	 *
+	 * \param [in] begin is the beginning position
+	 * \param [in] end is the ending position
+	 *
+	 * \return first contiguous block (as a pair with pointer and number of elements) starting at \a begin and not
+	 * crossing \a end or end of storage
+	 */
+
+	std::pair<uint8_t*, size_t> getBlock(size_t begin, size_t end) const;
+
+	/**
+	 * \brief Increases given position by given value.
+	 *
+	 * \param [in] position is the position that will be incremented
+	 * \param [in] value is the value which will be added to \a position, must not cross the end of storage
+	 *
+	 * \return \a position incremented by \a value
+	 */
+
+	size_t increasePosition(size_t position, size_t value) const;
+
+	/**
+	 * \brief Tests for empty queue.
+	 *
+	 * The queue is empty if read and write positions are equal, including their MSBs.
+	 *
+	 * \param [in] readPosition is the value of \a readPosition_
+	 * \param [in] writePosition is the value of \a writePosition_
+	 *
+	 * \return true if queue is empty, false otherwise
+	 */
+
+	constexpr static bool isEmpty(const size_t readPosition, const size_t writePosition)
+	{
+		return readPosition == writePosition;
+	}
+
+	/**
+	 * \brief Tests for full queue.
+	 *
+	 * The queue is full if masked read and write positions are equal, but their MSBs are different.
+	 *
+	 * \param [in] readPosition is the value of \a readPosition_
+	 * \param [in] writePosition is the value of \a writePosition_
+	 *
+	 * \return true if queue is full, false otherwise
+	 */
+
+	constexpr static bool isFull(const size_t readPosition, const size_t writePosition)
+	{
+		return (readPosition ^ writePosition) == msbMask_;
+	}
+
+	/// bitmask used to extract position from \a readPosition_ or \a writePosition_
+	constexpr static size_t positionMask_ {SIZE_MAX >> 1};
+
+	/// bitmask used to extract MSB from \a readPosition_ or \a writePosition_
+	constexpr static size_t msbMask_ {~positionMask_};
+
+	/// semaphore used to unblock the consumer waiting for data
+	Semaphore notificationSemaphore_;
+
+	/// storage for queue elements
+	const StorageUniquePointer storageUniquePointer_;
+
+	/// maximum number of elements in the queue
+	const size_t capacity_;
+
+	/// size of single queue element, bytes
+	const size_t elementSize_;
+
+	/// position of first element available for reading, modified only by the consumer
+	std::atomic<size_t> readPosition_;
+
+	/// position of first free slot available for writing, modified only by the producer
+	std::atomic<size_t> writePosition_;
+
+	/// true if the consumer is going to block on \a notificationSemaphore_, false otherwise
+	std::atomic<bool> consumerWaiting_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SPSCRINGQUEUEBASE_HPP_
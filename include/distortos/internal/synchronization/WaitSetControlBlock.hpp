@@ -0,0 +1,80 @@
+/**
+ * \file
+ * \brief WaitSetControlBlock class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_WAITSETCONTROLBLOCK_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_WAITSETCONTROLBLOCK_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief WaitSetControlBlock class is a control block for WaitSet
+ *
+ * Objects waited for by WaitSet keep a pointer to its control block and call notify() whenever they may have become
+ * ready. The waiting thread rescans all objects after each notification, so notifications don't carry any data and
+ * spurious notifications are harmless.
+ */
+
+class WaitSetControlBlock
+{
+public:
+
+	/**
+	 * \brief WaitSetControlBlock's constructor
+	 */
+
+	constexpr WaitSetControlBlock() :
+			blockedList_{}
+	{
+
+	}
+
+	/**
+	 * \brief Blocks current thread until notify() is called.
+	 *
+	 * \attention interrupts must be masked
+	 *
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, nullptr to block without
+	 * timeout
+	 *
+	 * \return 0 if current thread was unblocked by notify(), error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - notify() was not called before the specified timeout expired;
+	 */
+
+	int block(const TickClock::time_point* timePoint);
+
+	/**
+	 * \brief Unblocks thread waiting on the wait set, if any.
+	 *
+	 * \attention interrupts must be masked
+	 */
+
+	void notify();
+
+private:
+
+	/// ThreadControlBlock objects blocked on wait set
+	ThreadList blockedList_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_WAITSETCONTROLBLOCK_HPP_
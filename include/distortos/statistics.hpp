@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,23 +12,137 @@
 #ifndef INCLUDE_DISTORTOS_STATISTICS_HPP_
 #define INCLUDE_DISTORTOS_STATISTICS_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+#include "estd/TypeErasedFunctor.hpp"
+
+#include <type_traits>
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 #include <cstdint>
 
 namespace distortos
 {
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+class Thread;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 namespace statistics
 {
 
 /// \addtogroup statistics
 /// \{
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+/// ThreadFunctor is a type-erased interface for functors executed by forEachThread()
+using ThreadFunctor = estd::TypeErasedFunctor<void(const Thread&)>;
+
+/**
+ * \brief Executes provided functor for each thread in the system.
+ *
+ * \warning The functor is executed with interrupt masking enabled, so it must be short and it must not block!
+ *
+ * \param [in] functor is a reference to ThreadFunctor which will be executed for each thread, including idle thread
+ */
+
+void forEachThread(const ThreadFunctor& functor);
+
+/**
+ * \brief Executes provided functor for each thread in the system.
+ *
+ * \warning The functor is executed with interrupt masking enabled, so it must be short and it must not block!
+ *
+ * \tparam Functor is the type of functor, it will be called with const reference to Thread as the only argument
+ *
+ * \param [in] functor is the functor which will be executed for each thread, including idle thread
+ */
+
+template<typename Functor>
+void forEachThread(Functor&& functor)
+{
+	/// BoundThreadFunctor class is a ThreadFunctor which calls bound functor
+	class BoundThreadFunctor : public ThreadFunctor
+	{
+	public:
+
+		/**
+		 * \brief BoundThreadFunctor's constructor
+		 *
+		 * \param [in] boundFunctor is a reference to bound functor
+		 */
+
+		constexpr explicit BoundThreadFunctor(typename std::remove_reference<Functor>::type& boundFunctor) :
+				boundFunctor_{boundFunctor}
+		{
+
+		}
+
+		/**
+		 * \brief BoundThreadFunctor's function call operator
+		 *
+		 * \param [in] thread is a const reference to Thread for which the functor is executed
+		 */
+
+		void operator()(const Thread& thread) const override
+		{
+			boundFunctor_(thread);
+		}
+
+	private:
+
+		/// reference to bound functor
+		typename std::remove_reference<Functor>::type& boundFunctor_;
+	};
+
+	const BoundThreadFunctor boundThreadFunctor {functor};
+	forEachThread(static_cast<const ThreadFunctor&>(boundThreadFunctor));
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 /**
  * \return number of context switches
  */
 
 uint64_t getContextSwitchCount();
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+/**
+ * \brief Gets CPU load since the start of scheduling.
+ *
+ * CPU load is the share of total run time which was not used by idle thread. To get CPU load in a specific period of
+ * time, use the difference of values returned by getIdleRunTime() and getTotalRunTime() at the beginning and at the
+ * end of this period.
+ *
+ * \return CPU load since the start of scheduling, 0.1 %, [0; 1000]
+ */
+
+uint16_t getCpuLoad();
+
+/**
+ * \return run time of idle thread, in units of run time counter (core clock cycles if architecture has cycle counter,
+ * ticks otherwise)
+ */
+
+uint64_t getIdleRunTime();
+
+/**
+ * \return total run time of all threads (including idle thread), in units of run time counter (core clock cycles if
+ * architecture has cycle counter, ticks otherwise)
+ */
+
+uint64_t getTotalRunTime();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 /// \}
 
 }	// namespace statistics
@@ -0,0 +1 @@
+CONFIG_SELECTED_CONFIGURATION="configurations/host/test/distortosConfiguration.mk"
@@ -12,6 +12,7 @@
 #include "distortos/chip/CMSIS-proxy.h"
 
 #include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/distortosConfiguration.h"
 
 namespace distortos
 {
@@ -40,6 +41,11 @@ void architectureLowLevelInitializer()
 #if __FPU_PRESENT == 1 && __FPU_USED == 1
 	SCB->CPACR |= 3 << 10 * 2 | 3 << 11 * 2;	// full access to CP10 and CP11
 #endif	// __FPU_PRESENT == 1 && __FPU_USED == 1
+#if defined(CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER) && defined(CONFIG_RUN_TIME_STATISTICS_ENABLE)
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif	// defined(CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER) && defined(CONFIG_RUN_TIME_STATISTICS_ENABLE)
 }
 
 BIND_LOW_LEVEL_INITIALIZER(30, architectureLowLevelInitializer);
@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief getCycleCounter() implementation for ARMv7-M
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getCycleCounter.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t getCycleCounter()
+{
+	return DWT->CYCCNT;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER
@@ -0,0 +1,125 @@
+/**
+ * \file
+ * \brief ticklessIdle() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/ticklessIdle.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ticklessIdle()
+{
+	// PRIMASK is used instead of regular interrupt masking, because pending interrupt wakes the core from WFI even if
+	// it is masked with PRIMASK, which is not the case for BASEPRI
+	__disable_irq();
+
+	auto& scheduler = internal::getScheduler();
+	const auto duration = scheduler.getTicklessIdleDuration();
+	if (duration == TickClock::duration{})	// idle thread is not the only runnable thread
+	{
+		__enable_irq();
+		return;
+	}
+
+	// SysTick is reconfigured only during tickless idle, so reload value always matches period of regular tick here
+	const uint32_t period {SysTick->LOAD + 1};
+	const uint32_t maxTicks = (SysTick_LOAD_RELOAD_Msk + 1) / period;
+	const uint32_t ticks = std::min<TickClock::rep>(duration.count(), maxTicks);
+	if (ticks < 2)	// reprogramming SysTick makes no sense, just wait for next "tick" interrupt
+	{
+		__DSB();
+		__WFI();
+		__enable_irq();
+		return;
+	}
+
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;	// reading CTRL also clears COUNTFLAG
+
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)	// "tick" interrupt is already pending?
+	{
+		SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+		__enable_irq();
+		return;
+	}
+
+	// number of cycles until the end of current tick
+	const uint32_t currentValue {SysTick->VAL};
+	const uint32_t value {currentValue != 0 ? currentValue : period};
+	const uint32_t reload {value + (ticks - 1) * period};
+	SysTick->LOAD = reload - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+	__DSB();
+	__WFI();
+	__ISB();
+
+	const uint32_t control {SysTick->CTRL};	// reading CTRL also clears COUNTFLAG
+	SysTick->CTRL = control & ~SysTick_CTRL_ENABLE_Msk;
+	const uint32_t remaining {SysTick->VAL};
+
+	uint32_t elapsedTicks;
+	uint32_t nextReload;
+	if ((control & SysTick_CTRL_COUNTFLAG_Msk) != 0)	// whole period elapsed, "tick" interrupt is pending
+	{
+		// counter was already reloaded, last of the suppressed ticks will be handled by pending "tick" interrupt
+		const uint32_t counted {reload - 1 - remaining};
+		elapsedTicks = ticks - 1 + counted / period;
+		nextReload = period - counted % period;
+	}
+	else	// woken up by other interrupt
+	{
+		// boundaries of ticks are at value, value + period, value + 2 * period, ...
+		const uint32_t counted {reload - remaining};
+		elapsedTicks = counted < value ? 0 : (counted - value) / period + 1;
+		nextReload = value + elapsedTicks * period - counted;
+	}
+
+	if (nextReload < 2)	// too close to the boundary of tick, skip to the next one
+	{
+		nextReload += period;
+		++elapsedTicks;
+	}
+
+	SysTick->LOAD = nextReload - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+	// this also gives SysTick enough time to load the value of shortened period before regular one is restored
+	scheduler.advanceTickCount(elapsedTicks);
+
+	SysTick->LOAD = period - 1;
+
+	__enable_irq();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
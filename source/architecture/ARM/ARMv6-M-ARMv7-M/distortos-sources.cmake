@@ -14,6 +14,7 @@ if(CONFIG_ARCHITECTURE_ARMV6_M OR CONFIG_ARCHITECTURE_ARMV7_M)
 			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-coreVectors.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-disableInterruptMasking.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-enableInterruptMasking.cpp
+			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-getCycleCounter.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-getMainStack.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-initializeStack.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-isInInterruptContext.cpp
@@ -25,7 +26,8 @@ if(CONFIG_ARCHITECTURE_ARMV6_M OR CONFIG_ARCHITECTURE_ARMV7_M)
 			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-startScheduling.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-supervisorCall.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-SVC_Handler.cpp
-			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-SysTick_Handler.cpp)
+			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-SysTick_Handler.cpp
+			${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ticklessIdle.cpp)
 
 	doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR}
 			INCLUDE_PATH ${CMAKE_CURRENT_LIST_DIR}/include ${CMAKE_CURRENT_LIST_DIR}/external/CMSIS
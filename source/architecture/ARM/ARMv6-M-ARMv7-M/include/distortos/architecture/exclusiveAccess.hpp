@@ -0,0 +1,103 @@
+/**
+ * \file
+ * \brief loadExclusive(), storeExclusive() and clearExclusive() declarations for ARMv7-M
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_EXCLUSIVEACCESS_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_EXCLUSIVEACCESS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include <atomic>
+
+#include <cstring>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Clears the local exclusive monitor, abandoning the sequence started with loadExclusive().
+ */
+
+inline void clearExclusive()
+{
+	__CLREX();
+}
+
+/**
+ * \brief Loads a word from memory and marks its address for exclusive access.
+ *
+ * Exception entry and exception return clear the local exclusive monitor, so a sequence of loadExclusive() and
+ * storeExclusive() is atomic with regard to interrupts and context switches - the store fails if the sequence was
+ * interrupted.
+ *
+ * \note __LDREXW() from CMSIS is not a compiler barrier, so it is surrounded by std::atomic_signal_fence().
+ *
+ * \tparam T is the type of loaded object, its size must be equal to the size of word
+ *
+ * \param [in] object is a reference to object which will be loaded
+ *
+ * \return value of \a object
+ */
+
+template<typename T>
+inline T loadExclusive(T& object)
+{
+	static_assert(sizeof(T) == sizeof(uint32_t), "Only word-sized objects can be loaded with loadExclusive()!");
+
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	const auto word = __LDREXW(reinterpret_cast<volatile uint32_t*>(&object));
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	T value;
+	memcpy(&value, &word, sizeof(value));
+	return value;
+}
+
+/**
+ * \brief Stores a word to memory if the exclusive access started with loadExclusive() was not interrupted.
+ *
+ * \note __STREXW() from CMSIS is not a compiler barrier, so it is surrounded by std::atomic_signal_fence().
+ *
+ * \tparam T is the type of stored object, its size must be equal to the size of word
+ *
+ * \param [out] object is a reference to object which will be written, must be the same object as the one used in
+ * preceding call to loadExclusive()
+ * \param [in] value is the value which will be written to \a object
+ *
+ * \return true if \a value was written to \a object, false if the exclusive access was lost and the whole sequence
+ * must be retried
+ */
+
+template<typename T>
+inline bool storeExclusive(T& object, const T value)
+{
+	static_assert(sizeof(T) == sizeof(uint32_t), "Only word-sized objects can be stored with storeExclusive()!");
+
+	uint32_t word;
+	memcpy(&word, &value, sizeof(word));
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	const auto result = __STREXW(word, reinterpret_cast<volatile uint32_t*>(&object));
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	return result == 0;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_EXCLUSIVEACCESS_HPP_
@@ -8,3 +8,4 @@
 #
 
 include(${CMAKE_CURRENT_LIST_DIR}/ARM/distortos-sources.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/host/distortos-sources.cmake)
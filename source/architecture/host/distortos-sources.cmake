@@ -0,0 +1,30 @@
+#
+# file: distortos-sources.cmake
+#
+# author: Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+if(CONFIG_ARCHITECTURE_HOST)
+
+	target_sources(distortos PRIVATE
+			${CMAKE_CURRENT_LIST_DIR}/host-contextSwitchHandler.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-disableInterruptMasking.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-enableInterruptMasking.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-getInterruptSignalSet.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-getMainStack.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-initializeStack.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-isInInterruptContext.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-mallocLocking.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-requestContextSwitch.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-requestFunctionExecution.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-restoreInterruptMasking.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-startScheduling.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-startup.cpp
+			${CMAKE_CURRENT_LIST_DIR}/host-tickHandler.cpp)
+
+	doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR} INCLUDE_PATH ${CMAKE_CURRENT_LIST_DIR}/include)
+
+endif()
@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief StackFrame structure for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_HOST_HOST_STACKFRAME_HPP_
+#define SOURCE_ARCHITECTURE_HOST_HOST_STACKFRAME_HPP_
+
+#include <ucontext.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Stack frame of suspended thread for host
+ *
+ * Stack frame is placed on the stack of thread which is not running - either by initializeStack() or by context switch
+ * handler - and its address is used as thread's stack pointer.
+ */
+
+struct StackFrame
+{
+	/// saved context of thread
+	ucontext_t context;
+
+	/// function which should be executed in thread when it is resumed, nullptr if none
+	void (* function)();
+};
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_HOST_HOST_STACKFRAME_HPP_
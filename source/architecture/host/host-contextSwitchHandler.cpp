@@ -0,0 +1,74 @@
+/**
+ * \file
+ * \brief contextSwitchHandler() and executeRequestedFunction() implementation for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "host-interrupts.hpp"
+
+#include "host-StackFrame.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#ifdef CONFIG_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE
+
+#include "distortos/FATAL_ERROR.h"
+
+#endif	// def CONFIG_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void contextSwitchHandler(int)
+{
+	interruptContext = true;
+
+	StackFrame stackFrame;
+	stackFrame.function = {};
+
+	auto& scheduler = internal::getScheduler();
+
+#ifdef CONFIG_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE
+
+	if (scheduler.getCurrentThreadControlBlock().getStack().checkStackPointer(&stackFrame) == false)
+		FATAL_ERROR("Stack overflow detected!");
+
+#endif	// def CONFIG_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE
+
+	const auto newStackFrame = static_cast<StackFrame*>(scheduler.switchContext(&stackFrame));
+	// execution of this thread continues after swapcontext() when it is selected by the scheduler again
+	if (newStackFrame != &stackFrame)
+		swapcontext(&stackFrame.context, &newStackFrame->context);
+
+	executeRequestedFunction(stackFrame.function);
+}
+
+void executeRequestedFunction(void (* const function)())
+{
+	interruptContext = false;
+
+	if (function == nullptr)
+		return;
+
+	const auto interruptSignalSet = getInterruptSignalSet();
+	sigprocmask(SIG_UNBLOCK, &interruptSignalSet, nullptr);
+	function();
+	sigprocmask(SIG_BLOCK, &interruptSignalSet, nullptr);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
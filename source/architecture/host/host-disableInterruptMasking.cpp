@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief disableInterruptMasking() implementation for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/disableInterruptMasking.hpp"
+
+#include "host-interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+InterruptMask disableInterruptMasking()
+{
+	const auto interruptSignalSet = getInterruptSignalSet();
+	sigset_t previousSignalSet;
+	sigprocmask(SIG_UNBLOCK, &interruptSignalSet, &previousSignalSet);
+	return sigismember(&previousSignalSet, tickSignal) == 1;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief getInterruptSignalSet() implementation for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "host-interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+sigset_t getInterruptSignalSet()
+{
+	sigset_t interruptSignalSet;
+	sigemptyset(&interruptSignalSet);
+	sigaddset(&interruptSignalSet, tickSignal);
+	sigaddset(&interruptSignalSet, contextSwitchSignal);
+	return interruptSignalSet;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,46 @@
+/**
+ * \file
+ * \brief getMainStack() implementation for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getMainStack.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <pthread.h>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<void*, size_t> getMainStack()
+{
+	// main thread uses the top part of process stack, which is grown by the kernel on demand
+	pthread_attr_t attributes;
+	pthread_getattr_np(pthread_self(), &attributes);
+	void* stackAddress;
+	size_t stackSize;
+	pthread_attr_getstack(&attributes, &stackAddress, &stackSize);
+	pthread_attr_destroy(&attributes);
+
+	constexpr size_t size {CONFIG_MAIN_THREAD_STACK_SIZE + CONFIG_ARCHITECTURE_STACK_OVERHEAD};
+	return {static_cast<uint8_t*>(stackAddress) + stackSize - size, size};
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,119 @@
+/**
+ * \file
+ * \brief initializeStack() implementation for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/initializeStack.hpp"
+
+#include "host-interrupts.hpp"
+#include "host-StackFrame.hpp"
+
+#include "distortos/internal/scheduler/threadRunner.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cerrno>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Wrapper for getcontext().
+ *
+ * Saved context is used only as a template for makecontext(), so getcontext() never returns twice. Separate function
+ * prevents the compiler from treating local variables of the caller as possibly clobbered.
+ *
+ * \param [out] context is a reference to context which will be initialized
+ *
+ * \return 0 on success, error code otherwise:
+ * - error codes returned by getcontext();
+ */
+
+int getContext(ucontext_t& context)
+{
+	return getcontext(&context) == 0 ? 0 : errno;
+}
+
+/**
+ * \brief Trampoline used as the entry point of new thread.
+ *
+ * New thread is entered from context switch handler, so this function finishes the work of the handler and then runs
+ * internal::threadRunner(). Pointers are split into halves, as makecontext() officially supports only arguments of int
+ * type.
+ *
+ * \param [in] stackFrameHigh is the high half of pointer to StackFrame of new thread
+ * \param [in] stackFrameLow is the low half of pointer to StackFrame of new thread
+ * \param [in] runnableThreadHigh is the high half of pointer to internal::RunnableThread object that is being run
+ * \param [in] runnableThreadLow is the low half of pointer to internal::RunnableThread object that is being run
+ */
+
+void threadTrampoline(const unsigned int stackFrameHigh, const unsigned int stackFrameLow,
+		const unsigned int runnableThreadHigh, const unsigned int runnableThreadLow)
+{
+	auto& stackFrame = *reinterpret_cast<StackFrame*>(static_cast<uintptr_t>(stackFrameHigh) << 32 | stackFrameLow);
+	auto& runnableThread = *reinterpret_cast<internal::RunnableThread*>(
+			static_cast<uintptr_t>(runnableThreadHigh) << 32 | runnableThreadLow);
+
+	executeRequestedFunction(stackFrame.function);
+
+	const auto interruptSignalSet = getInterruptSignalSet();
+	sigprocmask(SIG_UNBLOCK, &interruptSignalSet, nullptr);
+	internal::threadRunner(runnableThread);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, void*> initializeStack(void* const buffer, const size_t size, internal::RunnableThread& runnableThread)
+{
+	static_assert(sizeof(uintptr_t) == 2 * sizeof(unsigned int), "Only 64-bit hosts are supported!");
+
+	// stack overhead is reserved for the context, signal handlers and C library, so the part of stack requested by the
+	// user must not be empty
+	const auto stackFrame = reinterpret_cast<StackFrame*>(static_cast<uint8_t*>(buffer) + size) - 1;
+	if (size <= CONFIG_ARCHITECTURE_STACK_OVERHEAD || stackFrame < buffer)
+		return {ENOSPC, {}};
+
+	const auto ret = getContext(stackFrame->context);
+	if (ret != 0)
+		return {ret, {}};
+
+	stackFrame->context.uc_stack.ss_sp = buffer;
+	stackFrame->context.uc_stack.ss_size = reinterpret_cast<uint8_t*>(stackFrame) - static_cast<uint8_t*>(buffer);
+	stackFrame->context.uc_link = {};
+	// new thread is entered from context switch handler, so all "interrupts" are blocked
+	stackFrame->context.uc_sigmask = getInterruptSignalSet();
+	stackFrame->function = {};
+
+	const auto stackFrameValue = reinterpret_cast<uintptr_t>(stackFrame);
+	const auto runnableThreadValue = reinterpret_cast<uintptr_t>(&runnableThread);
+	makecontext(&stackFrame->context, reinterpret_cast<void(*)()>(threadTrampoline), 4,
+			static_cast<unsigned int>(stackFrameValue >> 32), static_cast<unsigned int>(stackFrameValue),
+			static_cast<unsigned int>(runnableThreadValue >> 32), static_cast<unsigned int>(runnableThreadValue));
+
+	return {{}, stackFrame};
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
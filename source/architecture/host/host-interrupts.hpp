@@ -0,0 +1,80 @@
+/**
+ * \file
+ * \brief Header with "interrupts" emulated with signals for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_HOST_HOST_INTERRUPTS_HPP_
+#define SOURCE_ARCHITECTURE_HOST_HOST_INTERRUPTS_HPP_
+
+#include <csignal>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// signal used as "tick" interrupt - generated by timer which measures CPU time used by the process, so the tick doesn't
+/// advance when the process is preempted by host's scheduler and timing of threads is deterministic
+constexpr int tickSignal {SIGPROF};
+
+/// signal used as "context switch" interrupt, equivalent of PendSV in ARMv6-M and ARMv7-M
+constexpr int contextSwitchSignal {SIGUSR1};
+
+/// function which should be executed in current thread on exit from "tick" interrupt handler, nullptr if none
+extern void (* volatile currentThreadFunction)();
+
+/// true if code is executed from one of "interrupt" handlers, false otherwise
+extern volatile bool interruptContext;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief "Context switch" interrupt handler for host
+ *
+ * Saves context of current thread on its stack, calls internal::getScheduler().switchContext() and restores context of
+ * new thread.
+ */
+
+void contextSwitchHandler(int);
+
+/**
+ * \brief Leaves "interrupt" context and executes function requested with requestFunctionExecution().
+ *
+ * Function is executed with signals used as "interrupts" unblocked, just like regular thread's code. This should be
+ * called as the last step of exit from "interrupt" handler.
+ *
+ * \param [in] function is a pointer to function which will be executed, nullptr if none
+ */
+
+void executeRequestedFunction(void (* function)());
+
+/**
+ * \return set with all signals used as "interrupts"
+ */
+
+sigset_t getInterruptSignalSet();
+
+/**
+ * \brief "Tick" interrupt handler for host
+ */
+
+void tickHandler(int);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_HOST_HOST_INTERRUPTS_HPP_
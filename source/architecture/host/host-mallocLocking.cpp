@@ -0,0 +1,236 @@
+/**
+ * \file
+ * \brief Locking of C library's dynamic memory allocation for host
+ *
+ * glibc's allocator uses its own locks only after the process creates a POSIX thread, so with all distortos threads
+ * running in a single POSIX thread allocator's state could be corrupted by preemption. All allocation functions are
+ * therefore interposed and glibc's implementations are executed with "interrupts" masked.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/newlib/locking.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <malloc.h>
+
+#include <cerrno>
+#include <cstdlib>
+
+extern "C"
+{
+
+void* __libc_calloc(size_t numberOfElements, size_t elementSize);
+void __libc_free(void* memory);
+struct mallinfo __libc_mallinfo();
+void* __libc_malloc(size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void* __libc_pvalloc(size_t size);
+void* __libc_realloc(void* memory, size_t size);
+void* __libc_valloc(size_t size);
+
+}	// extern "C"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of Mutex used for malloc() and free() locking
+Mutex mallocMutexInstance {Mutex::Type::recursive, Mutex::Protocol::priorityInheritance};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// total usable size of all allocated blocks, bytes
+size_t allocatedMemory;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Accounts for allocated block.
+ *
+ * \param [in] memory is a pointer to allocated block, may be nullptr
+ *
+ * \return \a memory
+ */
+
+void* accountAllocation(void* const memory)
+{
+	allocatedMemory += malloc_usable_size(memory);
+	return memory;
+}
+
+/**
+ * \brief Accounts for block which is going to be deallocated.
+ *
+ * \param [in] memory is a pointer to block which is going to be deallocated, may be nullptr
+ */
+
+void accountDeallocation(void* const memory)
+{
+	allocatedMemory -= malloc_usable_size(memory);
+}
+
+}	// namespace
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Wrapper for aligned_alloc() which masks "interrupts" for the duration of the call.
+ */
+
+void* aligned_alloc(const size_t alignment, const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return accountAllocation(__libc_memalign(alignment, size));
+}
+
+/**
+ * \brief Wrapper for calloc() which masks "interrupts" for the duration of the call.
+ */
+
+void* calloc(const size_t numberOfElements, const size_t elementSize)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return accountAllocation(__libc_calloc(numberOfElements, elementSize));
+}
+
+/**
+ * \brief Wrapper for free() which masks "interrupts" for the duration of the call.
+ */
+
+void free(void* const memory)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	accountDeallocation(memory);
+	__libc_free(memory);
+}
+
+/**
+ * \brief Implementation of mallinfo2() which masks "interrupts" for the duration of the call.
+ *
+ * glibc keeps some of deallocated blocks in per-thread cache and reports them as used, so value of
+ * mallinfo2::uordblks is taken from interposed allocation functions. This way it changes only when blocks are allocated
+ * or deallocated - just like mallinfo::uordblks with newlib - and can be used to detect memory leaks.
+ */
+
+struct mallinfo2 mallinfo2()
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	const auto information = __libc_mallinfo();
+	struct mallinfo2 information2 {};
+	information2.arena = static_cast<unsigned int>(information.arena);
+	information2.ordblks = static_cast<unsigned int>(information.ordblks);
+	information2.smblks = static_cast<unsigned int>(information.smblks);
+	information2.hblks = static_cast<unsigned int>(information.hblks);
+	information2.hblkhd = static_cast<unsigned int>(information.hblkhd);
+	information2.usmblks = static_cast<unsigned int>(information.usmblks);
+	information2.fsmblks = static_cast<unsigned int>(information.fsmblks);
+	information2.uordblks = allocatedMemory;
+	information2.fordblks = static_cast<unsigned int>(information.fordblks) +
+			static_cast<unsigned int>(information.uordblks) - allocatedMemory;
+	information2.keepcost = static_cast<unsigned int>(information.keepcost);
+	return information2;
+}
+
+/**
+ * \brief Wrapper for malloc() which masks "interrupts" for the duration of the call.
+ */
+
+void* malloc(const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return accountAllocation(__libc_malloc(size));
+}
+
+/**
+ * \brief Wrapper for memalign() which masks "interrupts" for the duration of the call.
+ */
+
+void* memalign(const size_t alignment, const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return accountAllocation(__libc_memalign(alignment, size));
+}
+
+/**
+ * \brief Wrapper for posix_memalign() which masks "interrupts" for the duration of the call.
+ */
+
+int posix_memalign(void** const memory, const size_t alignment, const size_t size)
+{
+	if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0 || alignment == 0)
+		return EINVAL;
+
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	const auto alignedMemory = __libc_memalign(alignment, size);
+	if (alignedMemory == nullptr)
+		return ENOMEM;
+
+	*memory = accountAllocation(alignedMemory);
+	return 0;
+}
+
+/**
+ * \brief Wrapper for pvalloc() which masks "interrupts" for the duration of the call.
+ */
+
+void* pvalloc(const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return accountAllocation(__libc_pvalloc(size));
+}
+
+/**
+ * \brief Wrapper for realloc() which masks "interrupts" for the duration of the call.
+ */
+
+void* realloc(void* const memory, const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	const auto previousSize = malloc_usable_size(memory);
+	const auto reallocatedMemory = __libc_realloc(memory, size);
+	if (reallocatedMemory == nullptr && size != 0)	// failed reallocation leaves original block untouched
+		return nullptr;
+
+	allocatedMemory -= previousSize;
+	return accountAllocation(reallocatedMemory);
+}
+
+/**
+ * \brief Wrapper for valloc() which masks "interrupts" for the duration of the call.
+ */
+
+void* valloc(const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return accountAllocation(__libc_valloc(size));
+}
+
+}	// extern "C"
@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \brief requestFunctionExecution() implementation for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/requestFunctionExecution.hpp"
+
+#include "host-interrupts.hpp"
+#include "host-StackFrame.hpp"
+
+#include "distortos/architecture/isInInterruptContext.hpp"
+
+#include "distortos/FATAL_ERROR.h"
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int requestFunctionExecution(internal::ThreadControlBlock& threadControlBlock, void (& function)())
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	// request for current thread may be sent only by "tick" interrupt, function is executed on exit from its handler
+	if (&internal::getScheduler().getCurrentThreadControlBlock() == &threadControlBlock)
+	{
+		if (isInInterruptContext() == false)
+			FATAL_ERROR("Current thread of execution is sending the request to itself!");
+
+		currentThreadFunction = &function;
+		return 0;
+	}
+
+	// non-current thread is suspended in context switch handler or was not started yet, function will be executed on
+	// its stack below current stack frame, so there must be enough free space for at least one more stack frame
+	auto& stack = threadControlBlock.getStack();
+	const auto stackFrame = static_cast<StackFrame*>(stack.getStackPointer());
+	if (stack.checkStackPointer(stackFrame - 1) == false)
+		return ENOSPC;
+
+	stackFrame->function = &function;
+	return 0;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
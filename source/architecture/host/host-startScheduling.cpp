@@ -0,0 +1,67 @@
+/**
+ * \file
+ * \brief Low-level initializer which starts scheduling for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "host-interrupts.hpp"
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/distortosConfiguration.h"
+
+#include <sys/time.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Start of scheduling for host
+ *
+ * Installs handlers of signals used as "interrupts" and configures interval timer as the tick timer. The timer counts
+ * CPU time of the process, as idle thread never sleeps. This function is called before constructors for global and
+ * static objects via BIND_LOW_LEVEL_INITIALIZER().
+ */
+
+void startScheduling()
+{
+	// both handlers block all "interrupts", so they never preempt each other - just like SysTick and PendSV with the
+	// same priority
+	struct sigaction signalAction {};
+	signalAction.sa_mask = getInterruptSignalSet();
+	signalAction.sa_flags = SA_RESTART;
+
+	signalAction.sa_handler = contextSwitchHandler;
+	sigaction(contextSwitchSignal, &signalAction, nullptr);
+
+	signalAction.sa_handler = tickHandler;
+	sigaction(tickSignal, &signalAction, nullptr);
+
+	// configure CPU time interval timer as the tick timer
+	constexpr suseconds_t period {1000000 / CONFIG_TICK_FREQUENCY};
+	static_assert(period > 0, "Invalid tick timer configuration!");
+	const itimerval timer {{0, period}, {0, period}};
+	setitimer(ITIMER_PROF, &timer, nullptr);
+}
+
+BIND_LOW_LEVEL_INITIALIZER(70, startScheduling);
+
+}	// namespace
+
+}	// namespace architecture
+
+}	// namespace distortos
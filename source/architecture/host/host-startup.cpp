@@ -0,0 +1,100 @@
+/**
+ * \file
+ * \brief Startup code for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getMainStack.hpp"
+
+#include <algorithm>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of low-level (pre)initializer
+using LowLevelInitializer = void(*)();
+
+/// size of margin left below current frame when filling main stack with sentinel, bytes
+constexpr size_t mainStackFillMargin {4096};
+
+/// value used to fill main stack, must match the one used in internal::Stack
+constexpr uint32_t stackSentinel {0xed419f25};
+
+}	// namespace
+
+extern "C"
+{
+
+/// beginning of array with low-level preinitializers - imported from linker script
+extern const LowLevelInitializer __low_level_preinitializers_start[];
+
+/// end of array with low-level preinitializers - imported from linker script
+extern const LowLevelInitializer __low_level_preinitializers_end[];
+
+/// beginning of array with low-level initializers - imported from linker script
+extern const LowLevelInitializer __low_level_initializers_start[];
+
+/// end of array with low-level initializers - imported from linker script
+extern const LowLevelInitializer __low_level_initializers_end[];
+
+}
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Startup code for host, equivalent of Reset_Handler()
+ *
+ * Fills unused part of main stack with sentinel (to enable stack guard and stack usage checks for main thread) and
+ * executes low-level preinitializers and low-level initializers. This function is executed before constructors for
+ * global and static objects of the application, which are then executed by C library just like on target.
+ */
+
+__attribute__ ((constructor(101)))
+void startup()
+{
+	const auto mainStack = getMainStack();
+	const auto mainStackBegin = static_cast<uint32_t*>(mainStack.first);
+	const auto mainStackFillEnd = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(__builtin_frame_address(0)) -
+			mainStackFillMargin);
+	if (mainStackFillEnd > mainStackBegin)
+		std::fill(mainStackBegin, mainStackFillEnd, stackSentinel);
+
+	std::for_each(__low_level_preinitializers_start, __low_level_preinitializers_end,
+			[](const LowLevelInitializer lowLevelPreinitializer)
+			{
+				lowLevelPreinitializer();
+			});
+	std::for_each(__low_level_initializers_start, __low_level_initializers_end,
+			[](const LowLevelInitializer lowLevelInitializer)
+			{
+				lowLevelInitializer();
+			});
+}
+
+}	// namespace
+
+}	// namespace architecture
+
+}	// namespace distortos
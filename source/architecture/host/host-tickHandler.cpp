@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief tickHandler() implementation for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "host-interrupts.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/requestContextSwitch.hpp"
+
+#ifdef CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+#include "distortos/FATAL_ERROR.h"
+
+#endif	// def CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+void (* volatile currentThreadFunction)();
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void tickHandler(int)
+{
+	interruptContext = true;
+
+	auto& scheduler = internal::getScheduler();
+
+#ifdef CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+	// signal handler is executed on the stack of interrupted thread
+	const auto stackPointer = __builtin_frame_address(0);
+	if (scheduler.getCurrentThreadControlBlock().getStack().checkStackPointer(stackPointer) == false)
+		FATAL_ERROR("Stack overflow detected!");
+
+#endif	// def CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+	const auto contextSwitchRequired = scheduler.tickInterruptHandler();
+	if (contextSwitchRequired == true)
+		requestContextSwitch();
+
+	// request for current thread is executed on its stack, just like after return from this "interrupt"
+	const auto function = currentThreadFunction;
+	currentThreadFunction = {};
+	executeRequestedFunction(function);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,28 @@
+/**
+ * \file
+ * \brief InterruptMask type alias
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_HOST_INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASK_HPP_
+#define SOURCE_ARCHITECTURE_HOST_INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASK_HPP_
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// interrupt mask - true if signals used as "interrupts" are blocked, false otherwise
+using InterruptMask = bool;
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_HOST_INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASK_HPP_
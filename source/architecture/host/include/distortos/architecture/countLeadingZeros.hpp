@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief countLeadingZeros() definition for host
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_HOST_INCLUDE_DISTORTOS_ARCHITECTURE_COUNTLEADINGZEROS_HPP_
+#define SOURCE_ARCHITECTURE_HOST_INCLUDE_DISTORTOS_ARCHITECTURE_COUNTLEADINGZEROS_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Counts leading zero bits of a word.
+ *
+ * \param [in] value is the word which will be examined, must not be 0
+ *
+ * \return number of zero bits preceding the most significant one bit in \a value
+ */
+
+inline uint8_t countLeadingZeros(const uint32_t value)
+{
+	static_assert(sizeof(unsigned int) == sizeof(uint32_t), "__builtin_clz() requires 32-bit unsigned int!");
+	return __builtin_clz(value);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_HOST_INCLUDE_DISTORTOS_ARCHITECTURE_COUNTLEADINGZEROS_HPP_
@@ -0,0 +1,150 @@
+/**
+ * \file
+ * \brief DmaStream class implementation for DMAv2 in STM32
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/chip/DmaStream.hpp"
+
+#include "distortos/chip/DmaStreamFunctor.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace chip
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// "FIFO error" interrupt flag, shifted to bit position 0
+constexpr uint32_t feifFlag {DMA_LISR_FEIF0};
+
+/// "direct mode error" interrupt flag, shifted to bit position 0
+constexpr uint32_t dmeifFlag {DMA_LISR_DMEIF0};
+
+/// "transfer error" interrupt flag, shifted to bit position 0
+constexpr uint32_t teifFlag {DMA_LISR_TEIF0};
+
+/// "half transfer" interrupt flag, shifted to bit position 0
+constexpr uint32_t htifFlag {DMA_LISR_HTIF0};
+
+/// "transfer complete" interrupt flag, shifted to bit position 0
+constexpr uint32_t tcifFlag {DMA_LISR_TCIF0};
+
+/// all interrupt flags of single stream, shifted to bit position 0
+constexpr uint32_t allFlags {feifFlag | dmeifFlag | teifFlag | htifFlag | tcifFlag};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void DmaStream::interruptHandler()
+{
+	auto& stream = getStream();
+	const auto cr = stream.CR;
+	const auto flags = getInterruptFlags() & allFlags;
+	clearInterruptFlags(flags);
+
+	const auto functor = functor_;
+	if (functor == nullptr)
+		return;
+
+	if ((flags & teifFlag) != 0 && (cr & DMA_SxCR_TEIE) != 0)	// transfer error?
+	{
+		stream.CR = cr & ~(DMA_SxCR_TCIE | DMA_SxCR_TEIE | DMA_SxCR_EN);
+		functor->transferErrorEvent(stream.NDTR);
+	}
+	else if ((flags & tcifFlag) != 0 && (cr & DMA_SxCR_TCIE) != 0)	// transfer complete?
+		functor->transferCompleteEvent();
+}
+
+void DmaStream::release()
+{
+	functor_ = nullptr;
+}
+
+int DmaStream::reserve(const uint8_t channel, DmaStreamFunctor& functor)
+{
+	if (channel > maxChannel)
+		return EINVAL;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (functor_ != nullptr)
+		return EBUSY;
+
+	channel_ = channel;
+	functor_ = &functor;
+	return 0;
+}
+
+int DmaStream::startTransfer(const uintptr_t memoryAddress, const uintptr_t peripheralAddress,
+		const size_t transactions, const uint32_t flags)
+{
+	if (transactions == 0 || transactions > maxTransactions)
+		return EINVAL;
+
+	if (functor_ == nullptr)
+		return EBADF;
+
+	auto& stream = getStream();
+	if ((stream.CR & DMA_SxCR_EN) != 0)
+		return EBUSY;
+
+	clearInterruptFlags(allFlags);
+	stream.PAR = peripheralAddress;
+	stream.M0AR = memoryAddress;
+	stream.NDTR = transactions;
+	stream.FCR = 0;	// direct mode
+	stream.CR = channel_ << DMA_SxCR_CHSEL_Pos | (flags & (DMA_SxCR_PL | DMA_SxCR_MSIZE | DMA_SxCR_PSIZE |
+			DMA_SxCR_MINC | DMA_SxCR_DIR)) | DMA_SxCR_TCIE | DMA_SxCR_TEIE | DMA_SxCR_EN;
+	return 0;
+}
+
+size_t DmaStream::stopTransfer()
+{
+	auto& stream = getStream();
+	stream.CR &= ~(DMA_SxCR_TCIE | DMA_SxCR_TEIE | DMA_SxCR_EN);
+	// stream is disabled only after current transaction is finished
+	while ((stream.CR & DMA_SxCR_EN) != 0);
+	clearInterruptFlags(allFlags);
+	return stream.NDTR;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void DmaStream::clearInterruptFlags(const uint32_t flags) const
+{
+	auto& dma = getDma();
+	auto& ifcr = streamIndex_ < 4 ? dma.LIFCR : dma.HIFCR;
+	ifcr = flags << getInterruptFlagsShift();
+}
+
+uint32_t DmaStream::getInterruptFlags() const
+{
+	auto& dma = getDma();
+	const auto isr = streamIndex_ < 4 ? dma.LISR : dma.HISR;
+	return isr >> getInterruptFlagsShift();
+}
+
+}	// namespace chip
+
+}	// namespace distortos
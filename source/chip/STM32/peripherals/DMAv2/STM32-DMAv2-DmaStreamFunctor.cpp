@@ -0,0 +1,31 @@
+/**
+ * \file
+ * \brief DmaStreamFunctor class implementation for DMAv2 in STM32
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/chip/DmaStreamFunctor.hpp"
+
+namespace distortos
+{
+
+namespace chip
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+DmaStreamFunctor::~DmaStreamFunctor()
+{
+
+}
+
+}	// namespace chip
+
+}	// namespace distortos
@@ -0,0 +1,210 @@
+/**
+ * \file
+ * \brief Definitions of low-level DMA stream drivers for DMAv2 in STM32
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/chip/dmas.hpp"
+
+#include "distortos/chip/DmaStream.hpp"
+
+namespace distortos
+{
+
+namespace chip
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef CONFIG_CHIP_STM32_DMAV2_DMA1_ENABLE
+
+DmaStream dma1Stream0 {DMA1_BASE, 0};
+DmaStream dma1Stream1 {DMA1_BASE, 1};
+DmaStream dma1Stream2 {DMA1_BASE, 2};
+DmaStream dma1Stream3 {DMA1_BASE, 3};
+DmaStream dma1Stream4 {DMA1_BASE, 4};
+DmaStream dma1Stream5 {DMA1_BASE, 5};
+DmaStream dma1Stream6 {DMA1_BASE, 6};
+DmaStream dma1Stream7 {DMA1_BASE, 7};
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2_DMA1_ENABLE
+
+#ifdef CONFIG_CHIP_STM32_DMAV2_DMA2_ENABLE
+
+DmaStream dma2Stream0 {DMA2_BASE, 0};
+DmaStream dma2Stream1 {DMA2_BASE, 1};
+DmaStream dma2Stream2 {DMA2_BASE, 2};
+DmaStream dma2Stream3 {DMA2_BASE, 3};
+DmaStream dma2Stream4 {DMA2_BASE, 4};
+DmaStream dma2Stream5 {DMA2_BASE, 5};
+DmaStream dma2Stream6 {DMA2_BASE, 6};
+DmaStream dma2Stream7 {DMA2_BASE, 7};
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2_DMA2_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef CONFIG_CHIP_STM32_DMAV2_DMA1_ENABLE
+
+/**
+ * \brief DMA1 stream 0 interrupt handler
+ */
+
+extern "C" void DMA1_Stream0_IRQHandler()
+{
+	dma1Stream0.interruptHandler();
+}
+
+/**
+ * \brief DMA1 stream 1 interrupt handler
+ */
+
+extern "C" void DMA1_Stream1_IRQHandler()
+{
+	dma1Stream1.interruptHandler();
+}
+
+/**
+ * \brief DMA1 stream 2 interrupt handler
+ */
+
+extern "C" void DMA1_Stream2_IRQHandler()
+{
+	dma1Stream2.interruptHandler();
+}
+
+/**
+ * \brief DMA1 stream 3 interrupt handler
+ */
+
+extern "C" void DMA1_Stream3_IRQHandler()
+{
+	dma1Stream3.interruptHandler();
+}
+
+/**
+ * \brief DMA1 stream 4 interrupt handler
+ */
+
+extern "C" void DMA1_Stream4_IRQHandler()
+{
+	dma1Stream4.interruptHandler();
+}
+
+/**
+ * \brief DMA1 stream 5 interrupt handler
+ */
+
+extern "C" void DMA1_Stream5_IRQHandler()
+{
+	dma1Stream5.interruptHandler();
+}
+
+/**
+ * \brief DMA1 stream 6 interrupt handler
+ */
+
+extern "C" void DMA1_Stream6_IRQHandler()
+{
+	dma1Stream6.interruptHandler();
+}
+
+/**
+ * \brief DMA1 stream 7 interrupt handler
+ */
+
+extern "C" void DMA1_Stream7_IRQHandler()
+{
+	dma1Stream7.interruptHandler();
+}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2_DMA1_ENABLE
+
+#ifdef CONFIG_CHIP_STM32_DMAV2_DMA2_ENABLE
+
+/**
+ * \brief DMA2 stream 0 interrupt handler
+ */
+
+extern "C" void DMA2_Stream0_IRQHandler()
+{
+	dma2Stream0.interruptHandler();
+}
+
+/**
+ * \brief DMA2 stream 1 interrupt handler
+ */
+
+extern "C" void DMA2_Stream1_IRQHandler()
+{
+	dma2Stream1.interruptHandler();
+}
+
+/**
+ * \brief DMA2 stream 2 interrupt handler
+ */
+
+extern "C" void DMA2_Stream2_IRQHandler()
+{
+	dma2Stream2.interruptHandler();
+}
+
+/**
+ * \brief DMA2 stream 3 interrupt handler
+ */
+
+extern "C" void DMA2_Stream3_IRQHandler()
+{
+	dma2Stream3.interruptHandler();
+}
+
+/**
+ * \brief DMA2 stream 4 interrupt handler
+ */
+
+extern "C" void DMA2_Stream4_IRQHandler()
+{
+	dma2Stream4.interruptHandler();
+}
+
+/**
+ * \brief DMA2 stream 5 interrupt handler
+ */
+
+extern "C" void DMA2_Stream5_IRQHandler()
+{
+	dma2Stream5.interruptHandler();
+}
+
+/**
+ * \brief DMA2 stream 6 interrupt handler
+ */
+
+extern "C" void DMA2_Stream6_IRQHandler()
+{
+	dma2Stream6.interruptHandler();
+}
+
+/**
+ * \brief DMA2 stream 7 interrupt handler
+ */
+
+extern "C" void DMA2_Stream7_IRQHandler()
+{
+	dma2Stream7.interruptHandler();
+}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2_DMA2_ENABLE
+
+}	// namespace chip
+
+}	// namespace distortos
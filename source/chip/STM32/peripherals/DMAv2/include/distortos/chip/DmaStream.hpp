@@ -0,0 +1,227 @@
+/**
+ * \file
+ * \brief DmaStream class header for DMAv2 in STM32
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_CHIP_STM32_PERIPHERALS_DMAV2_INCLUDE_DISTORTOS_CHIP_DMASTREAM_HPP_
+#define SOURCE_CHIP_STM32_PERIPHERALS_DMAV2_INCLUDE_DISTORTOS_CHIP_DMASTREAM_HPP_
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace chip
+{
+
+class DmaStreamFunctor;
+
+/**
+ * DmaStream class is a low-level driver of single stream of DMAv2 in STM32
+ *
+ * The stream must be reserved with reserve() before it can be used. Transfers are always performed in direct mode
+ * (FIFO disabled), with "transfer complete" and "transfer error" interrupts enabled. Results of the transfer are
+ * reported to the DmaStreamFunctor object passed to reserve().
+ *
+ * \ingroup devices
+ */
+
+class DmaStream
+{
+public:
+
+	/// flags which can be used in startTransfer(), values combined with bitwise OR
+	enum Flags : uint32_t
+	{
+		/// transfer from peripheral to memory
+		peripheralToMemory = 0,
+		/// transfer from memory to peripheral
+		memoryToPeripheral = DMA_SxCR_DIR_0,
+
+		/// memory address is not incremented after each transaction
+		memoryFixed = 0,
+		/// memory address is incremented after each transaction
+		memoryIncrement = DMA_SxCR_MINC,
+
+		/// single transaction is 1 byte
+		dataSize1 = 0,
+		/// single transaction is 2 bytes
+		dataSize2 = DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0,
+		/// single transaction is 4 bytes
+		dataSize4 = DMA_SxCR_PSIZE_1 | DMA_SxCR_MSIZE_1,
+
+		/// low priority of the stream
+		lowPriority = 0,
+		/// medium priority of the stream
+		mediumPriority = DMA_SxCR_PL_0,
+		/// high priority of the stream
+		highPriority = DMA_SxCR_PL_1,
+		/// very high priority of the stream
+		veryHighPriority = DMA_SxCR_PL_1 | DMA_SxCR_PL_0,
+	};
+
+	/// maximum number of transactions in single transfer
+	constexpr static size_t maxTransactions {UINT16_MAX};
+
+	/// maximum value of channel (request) number
+	constexpr static uint8_t maxChannel {7};
+
+	/**
+	 * \brief DmaStream's constructor
+	 *
+	 * \param [in] dmaBase is a base address of DMA peripheral
+	 * \param [in] streamIndex is the index of stream in DMA peripheral, [0; 7]
+	 */
+
+	constexpr DmaStream(const uintptr_t dmaBase, const uint8_t streamIndex) :
+			functor_{},
+			dmaBase_{dmaBase},
+			streamIndex_{streamIndex},
+			channel_{}
+	{
+
+	}
+
+	/**
+	 * \return number of transactions left in current transfer
+	 */
+
+	size_t getTransactionsLeft() const
+	{
+		return getStream().NDTR;
+	}
+
+	/**
+	 * \brief Interrupt handler
+	 *
+	 * \note this must not be called by user code
+	 */
+
+	void interruptHandler();
+
+	/**
+	 * \brief Releases the stream reserved with reserve().
+	 *
+	 * \warning Transfer must not be in progress when this function is called!
+	 */
+
+	void release();
+
+	/**
+	 * \brief Reserves the stream for exclusive use.
+	 *
+	 * \param [in] channel is the channel (request) number which will be used for transfers, [0; 7] or
+	 * [0; DmaStream::maxChannel]
+	 * \param [in] functor is a reference to DmaStreamFunctor object which will be notified about finished transfers
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - the stream is already reserved;
+	 * - EINVAL - \a channel is invalid;
+	 */
+
+	int reserve(uint8_t channel, DmaStreamFunctor& functor);
+
+	/**
+	 * \brief Starts asynchronous transfer.
+	 *
+	 * This function returns immediately. When the transfer is finished (all transactions were performed or an error was
+	 * detected), DmaStreamFunctor::transferCompleteEvent() or DmaStreamFunctor::transferErrorEvent() will be executed.
+	 *
+	 * \param [in] memoryAddress is the address of memory buffer, must be aligned to size of single transaction
+	 * \param [in] peripheralAddress is the address of peripheral's data register
+	 * \param [in] transactions is the number of transactions, [1; 65535] or [1; DmaStream::maxTransactions]
+	 * \param [in] flags is a combination of DmaStream::Flags values
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBADF - the stream is not reserved;
+	 * - EBUSY - transfer is in progress;
+	 * - EINVAL - \a transactions is invalid;
+	 */
+
+	int startTransfer(uintptr_t memoryAddress, uintptr_t peripheralAddress, size_t transactions, uint32_t flags);
+
+	/**
+	 * \brief Stops transfer.
+	 *
+	 * Disables the stream, waits until it is actually disabled and clears all its interrupt flags. No
+	 * DmaStreamFunctor's function is executed after this call. Does nothing if the stream is not enabled.
+	 *
+	 * \return number of transactions left in stopped transfer
+	 */
+
+	size_t stopTransfer();
+
+private:
+
+	/**
+	 * \brief Clears selected interrupt flags of the stream.
+	 *
+	 * \param [in] flags are the flags which will be cleared, shifted to bit position 0
+	 */
+
+	void clearInterruptFlags(uint32_t flags) const;
+
+	/**
+	 * \return reference to DMA_TypeDef object
+	 */
+
+	DMA_TypeDef& getDma() const
+	{
+		return *reinterpret_cast<DMA_TypeDef*>(dmaBase_);
+	}
+
+	/**
+	 * \return current interrupt flags of the stream, shifted to bit position 0
+	 */
+
+	uint32_t getInterruptFlags() const;
+
+	/**
+	 * \return reference to DMA_Stream_TypeDef object
+	 */
+
+	DMA_Stream_TypeDef& getStream() const
+	{
+		return *reinterpret_cast<DMA_Stream_TypeDef*>(dmaBase_ + streamsOffset_ + streamIndex_ * streamSize_);
+	}
+
+	/**
+	 * \return shift of stream's interrupt flags in DMA_xISR and DMA_xIFCR registers, bits
+	 */
+
+	uint8_t getInterruptFlagsShift() const
+	{
+		const uint8_t index = streamIndex_ % 4;
+		return index * 6 + (index >= 2 ? 4 : 0);
+	}
+
+	/// offset of first stream's registers from the base address of DMA peripheral, bytes
+	constexpr static uintptr_t streamsOffset_ {0x10};
+
+	/// size of single stream's registers, bytes
+	constexpr static uintptr_t streamSize_ {0x18};
+
+	/// pointer to DmaStreamFunctor object associated with this one, nullptr if the stream is not reserved
+	DmaStreamFunctor* volatile functor_;
+
+	/// base address of DMA peripheral
+	uintptr_t dmaBase_;
+
+	/// index of stream in DMA peripheral
+	uint8_t streamIndex_;
+
+	/// channel (request) number used for transfers
+	uint8_t channel_;
+};
+
+}	// namespace chip
+
+}	// namespace distortos
+
+#endif	// SOURCE_CHIP_STM32_PERIPHERALS_DMAV2_INCLUDE_DISTORTOS_CHIP_DMASTREAM_HPP_
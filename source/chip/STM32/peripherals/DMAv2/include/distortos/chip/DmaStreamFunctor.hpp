@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \brief DmaStreamFunctor class header for DMAv2 in STM32
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_CHIP_STM32_PERIPHERALS_DMAV2_INCLUDE_DISTORTOS_CHIP_DMASTREAMFUNCTOR_HPP_
+#define SOURCE_CHIP_STM32_PERIPHERALS_DMAV2_INCLUDE_DISTORTOS_CHIP_DMASTREAMFUNCTOR_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace chip
+{
+
+/**
+ * DmaStreamFunctor class is an interface for functor executed by DmaStream from its interrupt handler when transfer
+ * is finished.
+ *
+ * \ingroup devices
+ */
+
+class DmaStreamFunctor
+{
+public:
+
+	/**
+	 * \brief DmaStreamFunctor's destructor
+	 */
+
+	virtual ~DmaStreamFunctor() = 0;
+
+	/**
+	 * \brief "Transfer complete" event
+	 *
+	 * Called by DmaStream from interrupt context when all transactions were performed.
+	 */
+
+	virtual void transferCompleteEvent() = 0;
+
+	/**
+	 * \brief "Transfer error" event
+	 *
+	 * Called by DmaStream from interrupt context when transfer error was detected. The stream is already disabled by
+	 * hardware at this point.
+	 *
+	 * \param [in] transactionsLeft is the number of transactions left
+	 */
+
+	virtual void transferErrorEvent(size_t transactionsLeft) = 0;
+};
+
+}	// namespace chip
+
+}	// namespace distortos
+
+#endif	// SOURCE_CHIP_STM32_PERIPHERALS_DMAV2_INCLUDE_DISTORTOS_CHIP_DMASTREAMFUNCTOR_HPP_
@@ -0,0 +1,117 @@
+/**
+ * \file
+ * \brief Declarations of low-level DMA stream drivers for DMAv2 in STM32
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_CHIP_STM32_PERIPHERALS_DMAV2_INCLUDE_DISTORTOS_CHIP_DMAS_HPP_
+#define SOURCE_CHIP_STM32_PERIPHERALS_DMAV2_INCLUDE_DISTORTOS_CHIP_DMAS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global defines
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief implementation of STM32_DMAV2_STREAM()
+ *
+ * \param [in] dmaId is the number of DMA peripheral, {1, 2}
+ * \param [in] streamId is the number of stream in DMA peripheral, [0; 7]
+ *
+ * \return global DmaStream object described by provided arguments
+ */
+
+#define STM32_DMAV2_STREAM_IMPLEMENTATION(dmaId, streamId)	distortos::chip::dma ## dmaId ## Stream ## streamId
+
+/**
+ * \brief global DmaStream object for selected DMA peripheral and stream
+ *
+ * Both arguments may be macros (e.g. numeric Kconfig options), as they are expanded before concatenation.
+ *
+ * \param [in] dmaId is the number of DMA peripheral, {1, 2}
+ * \param [in] streamId is the number of stream in DMA peripheral, [0; 7]
+ *
+ * \return global DmaStream object described by provided arguments
+ */
+
+#define STM32_DMAV2_STREAM(dmaId, streamId)	STM32_DMAV2_STREAM_IMPLEMENTATION(dmaId, streamId)
+
+namespace distortos
+{
+
+namespace chip
+{
+
+class DmaStream;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef CONFIG_CHIP_STM32_DMAV2_DMA1_ENABLE
+
+/// low-level driver for DMA1 stream 0
+extern DmaStream dma1Stream0;
+
+/// low-level driver for DMA1 stream 1
+extern DmaStream dma1Stream1;
+
+/// low-level driver for DMA1 stream 2
+extern DmaStream dma1Stream2;
+
+/// low-level driver for DMA1 stream 3
+extern DmaStream dma1Stream3;
+
+/// low-level driver for DMA1 stream 4
+extern DmaStream dma1Stream4;
+
+/// low-level driver for DMA1 stream 5
+extern DmaStream dma1Stream5;
+
+/// low-level driver for DMA1 stream 6
+extern DmaStream dma1Stream6;
+
+/// low-level driver for DMA1 stream 7
+extern DmaStream dma1Stream7;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2_DMA1_ENABLE
+
+#ifdef CONFIG_CHIP_STM32_DMAV2_DMA2_ENABLE
+
+/// low-level driver for DMA2 stream 0
+extern DmaStream dma2Stream0;
+
+/// low-level driver for DMA2 stream 1
+extern DmaStream dma2Stream1;
+
+/// low-level driver for DMA2 stream 2
+extern DmaStream dma2Stream2;
+
+/// low-level driver for DMA2 stream 3
+extern DmaStream dma2Stream3;
+
+/// low-level driver for DMA2 stream 4
+extern DmaStream dma2Stream4;
+
+/// low-level driver for DMA2 stream 5
+extern DmaStream dma2Stream5;
+
+/// low-level driver for DMA2 stream 6
+extern DmaStream dma2Stream6;
+
+/// low-level driver for DMA2 stream 7
+extern DmaStream dma2Stream7;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2_DMA2_ENABLE
+
+}	// namespace chip
+
+}	// namespace distortos
+
+#endif	// SOURCE_CHIP_STM32_PERIPHERALS_DMAV2_INCLUDE_DISTORTOS_CHIP_DMAS_HPP_
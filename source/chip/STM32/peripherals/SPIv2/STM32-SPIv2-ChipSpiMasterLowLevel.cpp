@@ -2,7 +2,7 @@
  * \file
  * \brief ChipSpiMasterLowLevel class implementation for SPIv2 in STM32
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,6 +16,12 @@
 
 #include "distortos/devices/communication/SpiMasterBase.hpp"
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+#include "distortos/chip/DmaStream.hpp"
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 #ifndef DISTORTOS_BITBANDING_SUPPORTED
 
 #include "distortos/InterruptMaskingLock.hpp"
@@ -30,6 +36,25 @@ namespace distortos
 namespace chip
 {
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// dummy word used as a source for DMA transfers without write buffer
+const uint16_t dummyWriteWord {0xffff};
+
+/// dummy word used as a destination for DMA transfers without read buffer
+uint16_t dummyReadWord;
+
+}	// namespace
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public types
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -56,6 +81,10 @@ public:
 			errieBbAddress_{STM32_BITBAND_IMPLEMENTATION(spiBase, SPI_TypeDef, CR2, SPI_CR2_ERRIE)},
 			rxneieBbAddress_{STM32_BITBAND_IMPLEMENTATION(spiBase, SPI_TypeDef, CR2, SPI_CR2_RXNEIE)},
 			txeieBbAddress_{STM32_BITBAND_IMPLEMENTATION(spiBase, SPI_TypeDef, CR2, SPI_CR2_TXEIE)},
+#ifdef CONFIG_CHIP_STM32_DMAV2
+			rxdmaenBbAddress_{STM32_BITBAND_IMPLEMENTATION(spiBase, SPI_TypeDef, CR2, SPI_CR2_RXDMAEN)},
+			txdmaenBbAddress_{STM32_BITBAND_IMPLEMENTATION(spiBase, SPI_TypeDef, CR2, SPI_CR2_TXDMAEN)},
+#endif	// def CONFIG_CHIP_STM32_DMAV2
 			rccEnBbAddress_{rccEnBbAddress},
 			rccRstBbAddress_{rccRstBbAddress}
 	{
@@ -139,6 +168,27 @@ public:
 #endif	// !def DISTORTOS_BITBANDING_SUPPORTED
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Enables or disables DMA request for reception in SPI.
+	 *
+	 * \param [in] enable selects whether the request will be enabled (true) or disabled (false)
+	 */
+
+	void enableRxDma(const bool enable) const
+	{
+#ifdef DISTORTOS_BITBANDING_SUPPORTED
+		*reinterpret_cast<volatile unsigned long*>(rxdmaenBbAddress_) = enable;
+#else	// !def DISTORTOS_BITBANDING_SUPPORTED
+		auto& spi = getSpi();
+		const InterruptMaskingLock interruptMaskingLock;
+		spi.CR2 = (spi.CR2 & ~SPI_CR2_RXDMAEN) | (enable == true ? SPI_CR2_RXDMAEN : 0);
+#endif	// !def DISTORTOS_BITBANDING_SUPPORTED
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief Enables or disables RXNE interrupt of SPI.
 	 *
@@ -156,6 +206,27 @@ public:
 #endif	// !def DISTORTOS_BITBANDING_SUPPORTED
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Enables or disables DMA request for transmission in SPI.
+	 *
+	 * \param [in] enable selects whether the request will be enabled (true) or disabled (false)
+	 */
+
+	void enableTxDma(const bool enable) const
+	{
+#ifdef DISTORTOS_BITBANDING_SUPPORTED
+		*reinterpret_cast<volatile unsigned long*>(txdmaenBbAddress_) = enable;
+#else	// !def DISTORTOS_BITBANDING_SUPPORTED
+		auto& spi = getSpi();
+		const InterruptMaskingLock interruptMaskingLock;
+		spi.CR2 = (spi.CR2 & ~SPI_CR2_TXDMAEN) | (enable == true ? SPI_CR2_TXDMAEN : 0);
+#endif	// !def DISTORTOS_BITBANDING_SUPPORTED
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief Enables or disables TXE interrupt of SPI.
 	 *
@@ -254,6 +325,16 @@ private:
 	/// address of bitband alias of TXEIE bit in SPI_CR2 register
 	uintptr_t txeieBbAddress_;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/// address of bitband alias of RXDMAEN bit in SPI_CR2 register
+	uintptr_t rxdmaenBbAddress_;
+
+	/// address of bitband alias of TXDMAEN bit in SPI_CR2 register
+	uintptr_t txdmaenBbAddress_;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/// address of bitband alias of appropriate SPIxEN bit in RCC register
 	uintptr_t rccEnBbAddress_;
 
@@ -341,6 +422,18 @@ ChipSpiMasterLowLevel::~ChipSpiMasterLowLevel()
 	if (isStarted() == false)
 		return;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true)
+	{
+		rxDmaStream_->stopTransfer();
+		txDmaStream_->stopTransfer();
+		rxDmaStream_->release();
+		txDmaStream_->release();
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.resetPeripheral();
 	parameters_.enablePeripheralClock(false);
 }
@@ -406,6 +499,14 @@ void ChipSpiMasterLowLevel::interruptHandler()
 
 		if ((sr & SPI_SR_BSY) == 0)
 			done = true;
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+		// DMA transfer cannot be continued after an error, as some received words may have been lost
+		if ((cr2 & SPI_CR2_RXDMAEN) != 0)
+			done = true;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
 	}
 	else if ((sr & SPI_SR_RXNE) != 0 && (cr2 & SPI_CR2_RXNEIE) != 0)	// read?
 	{
@@ -454,19 +555,15 @@ void ChipSpiMasterLowLevel::interruptHandler()
 
 	if (done == true)	// transfer finished of failed?
 	{
-		parameters_.enableTxeInterrupt(false);
-		parameters_.enableRxneInterrupt(false);
-		parameters_.enableErrInterrupt(false);
-		const auto errorSet = errorSet_;
-		errorSet_.reset();
-		writePosition_ = {};
-		const auto bytesTransfered = readPosition_;
-		readPosition_ = {};
-		size_ = {};
-		writeBuffer_ = {};
-		readBuffer_ = {};
-
-		spiMasterBase_->transferCompleteEvent(errorSet, bytesTransfered);
+#ifdef CONFIG_CHIP_STM32_DMAV2
+		if ((cr2 & SPI_CR2_RXDMAEN) != 0)
+		{
+			finishTransfer(stopDmaTransfer());
+			return;
+		}
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
+		finishTransfer(readPosition_);
 	}
 }
 
@@ -475,6 +572,27 @@ int ChipSpiMasterLowLevel::start(devices::SpiMasterBase& spiMasterBase)
 	if (isStarted() == true)
 		return EBADF;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true)
+	{
+		{
+			const auto ret = rxDmaStream_->reserve(rxDmaChannel_, rxDmaStreamFunctor_);
+			if (ret != 0)
+				return ret;
+		}
+		{
+			const auto ret = txDmaStream_->reserve(txDmaChannel_, txDmaStreamFunctor_);
+			if (ret != 0)
+			{
+				rxDmaStream_->release();
+				return ret;
+			}
+		}
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enablePeripheralClock(true);
 	parameters_.resetPeripheral();
 	spiMasterBase_ = &spiMasterBase;
@@ -496,7 +614,8 @@ int ChipSpiMasterLowLevel::startTransfer(const void* const writeBuffer, void* co
 	if (isTransferInProgress() == true)
 		return EBUSY;
 
-	if (size % ((parameters_.getWordLength() + 8 - 1) / 8) != 0)
+	const size_t wordSize = (parameters_.getWordLength() + 8 - 1) / 8;
+	if (size % wordSize != 0)
 		return EINVAL;
 
 	readBuffer_ = static_cast<uint8_t*>(readBuffer);
@@ -505,6 +624,18 @@ int ChipSpiMasterLowLevel::startTransfer(const void* const writeBuffer, void* co
 	readPosition_ = 0;
 	writePosition_ = 0;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true && size >= minDmaTransferSize && size / wordSize <= DmaStream::maxTransactions &&
+			reinterpret_cast<uintptr_t>(writeBuffer) % wordSize == 0 &&
+			reinterpret_cast<uintptr_t>(readBuffer) % wordSize == 0)
+	{
+		startDmaTransfer(wordSize);
+		return 0;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enableErrInterrupt(true);
 	parameters_.enableRxneInterrupt(true);
 	parameters_.enableTxeInterrupt(true);
@@ -519,12 +650,113 @@ int ChipSpiMasterLowLevel::stop()
 	if (isTransferInProgress() == true)
 		return EBUSY;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true)
+	{
+		rxDmaStream_->release();
+		txDmaStream_->release();
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.resetPeripheral();
 	parameters_.enablePeripheralClock(false);
 	spiMasterBase_ = nullptr;
 	return 0;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+void ChipSpiMasterLowLevel::RxDmaStreamFunctor::transferCompleteEvent()
+{
+	owner_.finishTransfer(owner_.stopDmaTransfer());
+}
+
+void ChipSpiMasterLowLevel::RxDmaStreamFunctor::transferErrorEvent(size_t)
+{
+	owner_.dmaTransferErrorEvent();
+}
+
+void ChipSpiMasterLowLevel::TxDmaStreamFunctor::transferCompleteEvent()
+{
+
+}
+
+void ChipSpiMasterLowLevel::TxDmaStreamFunctor::transferErrorEvent(size_t)
+{
+	owner_.dmaTransferErrorEvent();
+}
+
+void ChipSpiMasterLowLevel::dmaTransferErrorEvent()
+{
+	errorSet_[devices::SpiMasterErrorSet::dmaError] = true;
+	finishTransfer(stopDmaTransfer());
+}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
+void ChipSpiMasterLowLevel::finishTransfer(const size_t bytesTransfered)
+{
+	parameters_.enableTxeInterrupt(false);
+	parameters_.enableRxneInterrupt(false);
+	parameters_.enableErrInterrupt(false);
+	const auto errorSet = errorSet_;
+	errorSet_.reset();
+	writePosition_ = {};
+	readPosition_ = {};
+	size_ = {};
+	writeBuffer_ = {};
+	readBuffer_ = {};
+
+	spiMasterBase_->transferCompleteEvent(errorSet, bytesTransfered);
+}
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+void ChipSpiMasterLowLevel::startDmaTransfer(const size_t wordSize)
+{
+	const auto dataRegisterAddress = reinterpret_cast<uintptr_t>(&parameters_.getSpi().DR);
+	const auto transactions = size_ / wordSize;
+	const uint32_t dataSize = wordSize == 1 ? DmaStream::dataSize1 : DmaStream::dataSize2;
+
+	const auto readBuffer = readBuffer_;
+	const auto rxMemoryAddress = readBuffer != nullptr ? reinterpret_cast<uintptr_t>(readBuffer) :
+			reinterpret_cast<uintptr_t>(&dummyReadWord);
+	const uint32_t rxMemoryIncrement = readBuffer != nullptr ? DmaStream::memoryIncrement : DmaStream::memoryFixed;
+	// reception has higher priority to prevent overrun errors
+	rxDmaStream_->startTransfer(rxMemoryAddress, dataRegisterAddress, transactions,
+			DmaStream::peripheralToMemory | rxMemoryIncrement | dataSize | DmaStream::highPriority);
+
+	const auto writeBuffer = writeBuffer_;
+	const auto txMemoryAddress = writeBuffer != nullptr ? reinterpret_cast<uintptr_t>(writeBuffer) :
+			reinterpret_cast<uintptr_t>(&dummyWriteWord);
+	const uint32_t txMemoryIncrement = writeBuffer != nullptr ? DmaStream::memoryIncrement : DmaStream::memoryFixed;
+	txDmaStream_->startTransfer(txMemoryAddress, dataRegisterAddress, transactions,
+			DmaStream::memoryToPeripheral | txMemoryIncrement | dataSize | DmaStream::mediumPriority);
+
+	parameters_.enableErrInterrupt(true);
+	parameters_.enableRxDma(true);
+	parameters_.enableTxDma(true);	// starts the transfer
+}
+
+size_t ChipSpiMasterLowLevel::stopDmaTransfer()
+{
+	parameters_.enableTxDma(false);
+	parameters_.enableRxDma(false);
+	txDmaStream_->stopTransfer();
+	const auto rxTransactionsLeft = rxDmaStream_->stopTransfer();
+	const size_t wordSize = (parameters_.getWordLength() + 8 - 1) / 8;
+	const auto transactions = size_ / wordSize;
+	return (transactions - rxTransactionsLeft) * wordSize;
+}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 }	// namespace chip
 
 }	// namespace distortos
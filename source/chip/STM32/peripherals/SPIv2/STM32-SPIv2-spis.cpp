@@ -2,7 +2,7 @@
  * \file
  * \brief Definitions of low-level SPI master drivers for SPIv2 in STM32
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,12 @@
 
 #include "distortos/chip/ChipSpiMasterLowLevel.hpp"
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+#include "distortos/chip/dmas.hpp"
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 namespace distortos
 {
 
@@ -25,38 +31,110 @@ namespace chip
 
 #ifdef CONFIG_CHIP_STM32_SPIV2_SPI1_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_SPIV2_SPI1_DMA_BASED
+
+ChipSpiMasterLowLevel spi1 {ChipSpiMasterLowLevel::spi1Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI1_DMA, CONFIG_CHIP_STM32_SPIV2_SPI1_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI1_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI1_DMA, CONFIG_CHIP_STM32_SPIV2_SPI1_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI1_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_SPIV2_SPI1_DMA_BASED
+
 ChipSpiMasterLowLevel spi1 {ChipSpiMasterLowLevel::spi1Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_SPIV2_SPI1_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_SPIV2_SPI1_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_SPIV2_SPI2_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_SPIV2_SPI2_DMA_BASED
+
+ChipSpiMasterLowLevel spi2 {ChipSpiMasterLowLevel::spi2Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI2_DMA, CONFIG_CHIP_STM32_SPIV2_SPI2_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI2_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI2_DMA, CONFIG_CHIP_STM32_SPIV2_SPI2_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI2_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_SPIV2_SPI2_DMA_BASED
+
 ChipSpiMasterLowLevel spi2 {ChipSpiMasterLowLevel::spi2Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_SPIV2_SPI2_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_SPIV2_SPI2_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_SPIV2_SPI3_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_SPIV2_SPI3_DMA_BASED
+
+ChipSpiMasterLowLevel spi3 {ChipSpiMasterLowLevel::spi3Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI3_DMA, CONFIG_CHIP_STM32_SPIV2_SPI3_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI3_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI3_DMA, CONFIG_CHIP_STM32_SPIV2_SPI3_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI3_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_SPIV2_SPI3_DMA_BASED
+
 ChipSpiMasterLowLevel spi3 {ChipSpiMasterLowLevel::spi3Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_SPIV2_SPI3_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_SPIV2_SPI3_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_SPIV2_SPI4_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_SPIV2_SPI4_DMA_BASED
+
+ChipSpiMasterLowLevel spi4 {ChipSpiMasterLowLevel::spi4Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI4_DMA, CONFIG_CHIP_STM32_SPIV2_SPI4_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI4_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI4_DMA, CONFIG_CHIP_STM32_SPIV2_SPI4_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI4_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_SPIV2_SPI4_DMA_BASED
+
 ChipSpiMasterLowLevel spi4 {ChipSpiMasterLowLevel::spi4Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_SPIV2_SPI4_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_SPIV2_SPI4_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_SPIV2_SPI5_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_SPIV2_SPI5_DMA_BASED
+
+ChipSpiMasterLowLevel spi5 {ChipSpiMasterLowLevel::spi5Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI5_DMA, CONFIG_CHIP_STM32_SPIV2_SPI5_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI5_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI5_DMA, CONFIG_CHIP_STM32_SPIV2_SPI5_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI5_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_SPIV2_SPI5_DMA_BASED
+
 ChipSpiMasterLowLevel spi5 {ChipSpiMasterLowLevel::spi5Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_SPIV2_SPI5_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_SPIV2_SPI5_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_SPIV2_SPI6_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_SPIV2_SPI6_DMA_BASED
+
+ChipSpiMasterLowLevel spi6 {ChipSpiMasterLowLevel::spi6Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI6_DMA, CONFIG_CHIP_STM32_SPIV2_SPI6_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI6_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_SPIV2_SPI6_DMA, CONFIG_CHIP_STM32_SPIV2_SPI6_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_SPIV2_SPI6_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_SPIV2_SPI6_DMA_BASED
+
 ChipSpiMasterLowLevel spi6 {ChipSpiMasterLowLevel::spi6Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_SPIV2_SPI6_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_SPIV2_SPI6_ENABLE
 
 /*---------------------------------------------------------------------------------------------------------------------+
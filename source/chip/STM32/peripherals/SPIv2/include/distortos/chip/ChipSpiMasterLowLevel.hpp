@@ -2,7 +2,7 @@
  * \file
  * \brief ChipSpiMasterLowLevel class header for SPIv2 in STM32
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -17,15 +17,32 @@
 
 #include "distortos/distortosConfiguration.h"
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+#include "distortos/chip/DmaStreamFunctor.hpp"
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 namespace distortos
 {
 
 namespace chip
 {
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+class DmaStream;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 /**
  * ChipSpiMasterLowLevel class is a low-level SPI master driver for SPIv2 in STM32
  *
+ * If the driver is constructed with DMA streams, transfers are performed with DMA - one interrupt per transfer instead
+ * of one interrupt per word. Transfers shorter than ChipSpiMasterLowLevel::minDmaTransferSize, transfers with buffers
+ * which are not aligned to the size of word and transfers longer than DmaStream::maxTransactions words are still
+ * performed with interrupts.
+ *
  * \ingroup devices
  */
 
@@ -41,6 +58,13 @@ public:
 
 	class Parameters;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/// minimum size of transfer which is performed with DMA, bytes
+	constexpr static size_t minDmaTransferSize {8};
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 #ifdef CONFIG_CHIP_STM32_SPIV2_SPI1_ENABLE
 
 	/// parameters for construction of SPI master low-level driver for SPI1
@@ -91,6 +115,14 @@ public:
 
 	constexpr explicit ChipSpiMasterLowLevel(const Parameters& parameters) :
 			parameters_{parameters},
+#ifdef CONFIG_CHIP_STM32_DMAV2
+			rxDmaStreamFunctor_{*this},
+			txDmaStreamFunctor_{*this},
+			rxDmaStream_{},
+			txDmaStream_{},
+			rxDmaChannel_{},
+			txDmaChannel_{},
+#endif	// def CONFIG_CHIP_STM32_DMAV2
 			spiMasterBase_{},
 			readBuffer_{},
 			writeBuffer_{},
@@ -102,6 +134,40 @@ public:
 
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief ChipSpiMasterLowLevel's constructor for DMA-based driver
+	 *
+	 * \param [in] parameters is a reference to object with peripheral parameters
+	 * \param [in] rxDmaStream is a reference to DMA stream used for reception
+	 * \param [in] rxDmaChannel is the channel (request) number of \a rxDmaStream used for reception
+	 * \param [in] txDmaStream is a reference to DMA stream used for transmission
+	 * \param [in] txDmaChannel is the channel (request) number of \a txDmaStream used for transmission
+	 */
+
+	constexpr ChipSpiMasterLowLevel(const Parameters& parameters, DmaStream& rxDmaStream, const uint8_t rxDmaChannel,
+			DmaStream& txDmaStream, const uint8_t txDmaChannel) :
+					parameters_{parameters},
+					rxDmaStreamFunctor_{*this},
+					txDmaStreamFunctor_{*this},
+					rxDmaStream_{&rxDmaStream},
+					txDmaStream_{&txDmaStream},
+					rxDmaChannel_{rxDmaChannel},
+					txDmaChannel_{txDmaChannel},
+					spiMasterBase_{},
+					readBuffer_{},
+					writeBuffer_{},
+					size_{},
+					readPosition_{},
+					writePosition_{},
+					errorSet_{}
+	{
+
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief SpiMasterLowLevel's destructor
 	 *
@@ -152,6 +218,7 @@ public:
 	 *
 	 * \return 0 on success, error code otherwise:
 	 * - EBADF - the driver is not stopped;
+	 * - error codes returned by DmaStream::reserve();
 	 */
 
 	int start(devices::SpiMasterBase& spiMasterBase) override;
@@ -188,6 +255,119 @@ public:
 
 private:
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/// DmaStreamFunctor used for notifications from DMA stream used for reception
+	class RxDmaStreamFunctor : public DmaStreamFunctor
+	{
+	public:
+
+		/**
+		 * \brief RxDmaStreamFunctor's constructor
+		 *
+		 * \param [in] owner is a reference to ChipSpiMasterLowLevel object that owns this functor
+		 */
+
+		constexpr explicit RxDmaStreamFunctor(ChipSpiMasterLowLevel& owner) :
+				owner_{owner}
+		{
+
+		}
+
+		/**
+		 * \brief "Transfer complete" event
+		 *
+		 * Reception of last word means that the whole SPI transfer is finished.
+		 */
+
+		void transferCompleteEvent() override;
+
+		/**
+		 * \brief "Transfer error" event
+		 *
+		 * \param [in] transactionsLeft is the number of transactions left
+		 */
+
+		void transferErrorEvent(size_t transactionsLeft) override;
+
+	private:
+
+		/// reference to ChipSpiMasterLowLevel object that owns this functor
+		ChipSpiMasterLowLevel& owner_;
+	};
+
+	/// DmaStreamFunctor used for notifications from DMA stream used for transmission
+	class TxDmaStreamFunctor : public DmaStreamFunctor
+	{
+	public:
+
+		/**
+		 * \brief TxDmaStreamFunctor's constructor
+		 *
+		 * \param [in] owner is a reference to ChipSpiMasterLowLevel object that owns this functor
+		 */
+
+		constexpr explicit TxDmaStreamFunctor(ChipSpiMasterLowLevel& owner) :
+				owner_{owner}
+		{
+
+		}
+
+		/**
+		 * \brief "Transfer complete" event
+		 *
+		 * Does nothing - the transfer is finished when last word is received.
+		 */
+
+		void transferCompleteEvent() override;
+
+		/**
+		 * \brief "Transfer error" event
+		 *
+		 * \param [in] transactionsLeft is the number of transactions left
+		 */
+
+		void transferErrorEvent(size_t transactionsLeft) override;
+
+	private:
+
+		/// reference to ChipSpiMasterLowLevel object that owns this functor
+		ChipSpiMasterLowLevel& owner_;
+	};
+
+	/**
+	 * \brief Handles DMA transfer error.
+	 *
+	 * Stops the transfer and notifies associated SpiMasterBase object.
+	 */
+
+	void dmaTransferErrorEvent();
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Finishes the transfer.
+	 *
+	 * Disables all interrupts, resets the state of transfer and notifies associated SpiMasterBase object.
+	 *
+	 * \param [in] bytesTransfered is the number of bytes transfered
+	 */
+
+	void finishTransfer(size_t bytesTransfered);
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \return true if driver uses DMA for transfers, false otherwise
+	 */
+
+	bool isDmaBased() const
+	{
+		return rxDmaStream_ != nullptr;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \return true if driver is started, false otherwise
 	 */
@@ -206,9 +386,51 @@ private:
 		return size_ != 0;
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Starts DMA transfer of \a size_ bytes from \a writeBuffer_ to \a readBuffer_.
+	 *
+	 * \param [in] wordSize is the size of single word, bytes, {1, 2}
+	 */
+
+	void startDmaTransfer(size_t wordSize);
+
+	/**
+	 * \brief Stops DMA transfer.
+	 *
+	 * \return number of bytes transfered
+	 */
+
+	size_t stopDmaTransfer();
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/// reference to configuration parameters
 	const Parameters& parameters_;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/// functor used for notifications from \a rxDmaStream_
+	RxDmaStreamFunctor rxDmaStreamFunctor_;
+
+	/// functor used for notifications from \a txDmaStream_
+	TxDmaStreamFunctor txDmaStreamFunctor_;
+
+	/// pointer to DMA stream used for reception, nullptr if driver doesn't use DMA
+	DmaStream* rxDmaStream_;
+
+	/// pointer to DMA stream used for transmission, nullptr if driver doesn't use DMA
+	DmaStream* txDmaStream_;
+
+	/// channel (request) number of \a rxDmaStream_
+	uint8_t rxDmaChannel_;
+
+	/// channel (request) number of \a txDmaStream_
+	uint8_t txDmaChannel_;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/// pointer to SpiMasterBase object associated with this one
 	devices::SpiMasterBase* spiMasterBase_;
 
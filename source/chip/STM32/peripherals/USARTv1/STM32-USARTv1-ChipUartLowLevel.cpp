@@ -2,7 +2,7 @@
  * \file
  * \brief ChipUartLowLevel class implementation for USARTv1 in STM32
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,6 +16,12 @@
 
 #include "distortos/devices/communication/UartBase.hpp"
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+#include "distortos/chip/DmaStream.hpp"
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 #include <cerrno>
 
 namespace distortos
@@ -74,12 +80,46 @@ public:
 			rxneieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_RXNEIE)},
 			tcieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_TCIE)},
 			txeieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_TXEIE)},
+#ifdef CONFIG_CHIP_STM32_DMAV2
+			idleieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_IDLEIE)},
+			peieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_PEIE)},
+			eieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR3, USART_CR3_EIE)},
+			dmarBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR3, USART_CR3_DMAR)},
+			dmatBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR3, USART_CR3_DMAT)},
+#endif	// def CONFIG_CHIP_STM32_DMAV2
 			rccEnBbAddress_{rccEnBbAddress},
 			rccRstBbAddress_{rccRstBbAddress}
 	{
 
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Enables or disables error interrupts (framing, noise, overrun and parity) of UART.
+	 *
+	 * \param [in] enable selects whether the interrupts will be enabled (true) or disabled (false)
+	 */
+
+	void enableErrorInterrupts(const bool enable) const
+	{
+		*reinterpret_cast<volatile unsigned long*>(eieBbAddress_) = enable;
+		*reinterpret_cast<volatile unsigned long*>(peieBbAddress_) = enable;
+	}
+
+	/**
+	 * \brief Enables or disables IDLE interrupt of UART.
+	 *
+	 * \param [in] enable selects whether the interrupt will be enabled (true) or disabled (false)
+	 */
+
+	void enableIdleInterrupt(const bool enable) const
+	{
+		*reinterpret_cast<volatile unsigned long*>(idleieBbAddress_) = enable;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief Enables or disables peripheral clock in RCC.
 	 *
@@ -91,6 +131,21 @@ public:
 		*reinterpret_cast<volatile unsigned long*>(rccEnBbAddress_) = enable;
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Enables or disables DMA request for reception in UART.
+	 *
+	 * \param [in] enable selects whether the request will be enabled (true) or disabled (false)
+	 */
+
+	void enableRxDma(const bool enable) const
+	{
+		*reinterpret_cast<volatile unsigned long*>(dmarBbAddress_) = enable;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief Enables or disables RXNE interrupt of UART.
 	 *
@@ -113,6 +168,21 @@ public:
 		*reinterpret_cast<volatile unsigned long*>(tcieBbAddress_) = enable;
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Enables or disables DMA request for transmission in UART.
+	 *
+	 * \param [in] enable selects whether the request will be enabled (true) or disabled (false)
+	 */
+
+	void enableTxDma(const bool enable) const
+	{
+		*reinterpret_cast<volatile unsigned long*>(dmatBbAddress_) = enable;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief Enables or disables TXE interrupt of UART.
 	 *
@@ -183,6 +253,25 @@ private:
 	/// address of bitband alias of TXEIE bit in USART_CR1 register
 	uintptr_t txeieBbAddress_;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/// address of bitband alias of IDLEIE bit in USART_CR1 register
+	uintptr_t idleieBbAddress_;
+
+	/// address of bitband alias of PEIE bit in USART_CR1 register
+	uintptr_t peieBbAddress_;
+
+	/// address of bitband alias of EIE bit in USART_CR3 register
+	uintptr_t eieBbAddress_;
+
+	/// address of bitband alias of DMAR bit in USART_CR3 register
+	uintptr_t dmarBbAddress_;
+
+	/// address of bitband alias of DMAT bit in USART_CR3 register
+	uintptr_t dmatBbAddress_;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/// address of bitband alias of appropriate U[S]ARTxEN bit in RCC register
 	uintptr_t rccEnBbAddress_;
 
@@ -273,6 +362,18 @@ ChipUartLowLevel::~ChipUartLowLevel()
 	if (isStarted() == false)
 		return;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true)
+	{
+		rxDmaStream_->stopTransfer();
+		txDmaStream_->stopTransfer();
+		rxDmaStream_->release();
+		txDmaStream_->release();
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.resetPeripheral();
 	parameters_.enablePeripheralClock(false);
 }
@@ -281,10 +382,28 @@ void ChipUartLowLevel::interruptHandler()
 {
 	auto& uart = parameters_.getUart();
 	const auto characterLength = parameters_.getCharacterLength();
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if ((uart.CR3 & USART_CR3_EIE) != 0)	// receive errors during DMA-based read?
+	{
+		const auto sr = uart.SR;
+		if ((sr & (USART_SR_FE | USART_SR_NE | USART_SR_ORE | USART_SR_PE)) != 0)
+		{
+			// error flags are cleared only when DMA reads next character, so error interrupts are disabled until the
+			// end of read operation to report the errors only once
+			parameters_.enableErrorInterrupts(false);
+			uartBase_->receiveErrorEvent(decodeErrors(sr));
+		}
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	uint32_t sr;
 	uint32_t maskedSr;
 	// loop while there are enabled interrupt sources waiting to be served
-	while (sr = uart.SR, (maskedSr = sr & uart.CR1 & (USART_SR_RXNE | USART_SR_TXE | USART_SR_TC)) != 0)
+	while (sr = uart.SR, (maskedSr = sr & uart.CR1 &
+			(USART_SR_RXNE | USART_SR_TXE | USART_SR_TC | USART_SR_IDLE)) != 0)
 	{
 		if ((maskedSr & USART_SR_RXNE) != 0)		// read & receive errors
 		{
@@ -301,6 +420,18 @@ void ChipUartLowLevel::interruptHandler()
 			if (readPosition == readSize_)
 				uartBase_->readCompleteEvent(stopRead());
 		}
+#ifdef CONFIG_CHIP_STM32_DMAV2
+		else if ((maskedSr & USART_SR_IDLE) != 0)	// idle line during DMA-based read
+		{
+			// IDLE flag is cleared by reading DR after SR; if DR is not empty, it will be read by DMA - otherwise no
+			// character can be lost, as next one cannot be received earlier than one character time after idle line
+			if ((sr & USART_SR_RXNE) == 0)
+				uart.DR;	// clears IDLE flag
+			const size_t characterSize = characterLength > 8 ? 2 : 1;
+			if (rxDmaStream_->getTransactionsLeft() * characterSize != readSize_)	// any characters received?
+				uartBase_->readCompleteEvent(stopRead());
+		}
+#endif	// def CONFIG_CHIP_STM32_DMAV2
 		else if ((maskedSr & USART_SR_TXE) != 0)	// write
 		{
 			const auto writeBuffer = writeBuffer_;
@@ -343,6 +474,27 @@ std::pair<int, uint32_t> ChipUartLowLevel::start(devices::UartBase& uartBase, co
 	if (realCharacterLength < minCharacterLength + 1 || realCharacterLength > maxCharacterLength)
 		return {EINVAL, {}};
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true)
+	{
+		{
+			const auto ret = rxDmaStream_->reserve(rxDmaChannel_, rxDmaStreamFunctor_);
+			if (ret != 0)
+				return {ret, {}};
+		}
+		{
+			const auto ret = txDmaStream_->reserve(txDmaChannel_, txDmaStreamFunctor_);
+			if (ret != 0)
+			{
+				rxDmaStream_->release();
+				return {ret, {}};
+			}
+		}
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enablePeripheralClock(true);
 	parameters_.resetPeripheral();
 
@@ -371,12 +523,28 @@ int ChipUartLowLevel::startRead(void* const buffer, const size_t size)
 	if (isReadInProgress() == true)
 		return EBUSY;
 
-	if (parameters_.getCharacterLength() > 8 && size % 2 != 0)
+	const auto characterLength = parameters_.getCharacterLength();
+	if (characterLength > 8 && size % 2 != 0)
 		return EINVAL;
 
 	readBuffer_ = static_cast<uint8_t*>(buffer);
 	readSize_ = size;
 	readPosition_ = 0;
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	const size_t characterSize = characterLength > 8 ? 2 : 1;
+	// for characters shorter than 8 bits with parity control enabled the parity bit would be copied by DMA
+	if (isDmaBased() == true && size / characterSize <= DmaStream::maxTransactions &&
+			reinterpret_cast<uintptr_t>(buffer) % characterSize == 0 &&
+			(characterLength >= 8 || (parameters_.getUart().CR1 & USART_CR1_PCE) == 0))
+	{
+		startDmaRead(characterSize);
+		return 0;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enableRxneInterrupt(true);
 	return 0;
 }
@@ -392,7 +560,8 @@ int ChipUartLowLevel::startWrite(const void* const buffer, const size_t size)
 	if (isWriteInProgress() == true)
 		return EBUSY;
 
-	if (parameters_.getCharacterLength() > 8 && size % 2 != 0)
+	const auto characterLength = parameters_.getCharacterLength();
+	if (characterLength > 8 && size % 2 != 0)
 		return EINVAL;
 
 	writeBuffer_ = static_cast<const uint8_t*>(buffer);
@@ -403,6 +572,18 @@ int ChipUartLowLevel::startWrite(const void* const buffer, const size_t size)
 	if ((parameters_.getUart().SR & USART_SR_TC) != 0)
 		uartBase_->transmitStartEvent();
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	const size_t characterSize = characterLength > 8 ? 2 : 1;
+	if (isDmaBased() == true && size / characterSize <= DmaStream::maxTransactions &&
+			reinterpret_cast<uintptr_t>(buffer) % characterSize == 0)
+	{
+		startDmaWrite(characterSize);
+		return 0;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enableTxeInterrupt(true);
 	return 0;
 }
@@ -415,6 +596,16 @@ int ChipUartLowLevel::stop()
 	if (isReadInProgress() == true || isWriteInProgress() == true)
 		return EBUSY;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true)
+	{
+		rxDmaStream_->release();
+		txDmaStream_->release();
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.resetPeripheral();
 	parameters_.enablePeripheralClock(false);
 	uartBase_ = nullptr;
@@ -427,7 +618,15 @@ size_t ChipUartLowLevel::stopRead()
 		return 0;
 
 	parameters_.enableRxneInterrupt(false);
-	const auto bytesRead = readPosition_;
+	auto bytesRead = readPosition_;
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if ((parameters_.getUart().CR3 & USART_CR3_DMAR) != 0)	// DMA-based read?
+		bytesRead = stopDmaRead();
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	readPosition_ = {};
 	readSize_ = {};
 	readBuffer_ = {};
@@ -440,14 +639,94 @@ size_t ChipUartLowLevel::stopWrite()
 		return 0;
 
 	parameters_.enableTxeInterrupt(false);
+	auto bytesWritten = writePosition_;
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if ((parameters_.getUart().CR3 & USART_CR3_DMAT) != 0)	// DMA-based write?
+		bytesWritten = stopDmaWrite();
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enableTcInterrupt(true);
-	const auto bytesWritten = writePosition_;
 	writePosition_ = {};
 	writeSize_ = {};
 	writeBuffer_ = {};
 	return bytesWritten;
 }
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ChipUartLowLevel::RxDmaStreamFunctor::transferCompleteEvent()
+{
+	owner_.uartBase_->readCompleteEvent(owner_.stopRead());
+}
+
+void ChipUartLowLevel::RxDmaStreamFunctor::transferErrorEvent(size_t)
+{
+	owner_.uartBase_->readCompleteEvent(owner_.stopRead());
+}
+
+void ChipUartLowLevel::TxDmaStreamFunctor::transferCompleteEvent()
+{
+	owner_.uartBase_->writeCompleteEvent(owner_.stopWrite());
+}
+
+void ChipUartLowLevel::TxDmaStreamFunctor::transferErrorEvent(size_t)
+{
+	owner_.uartBase_->writeCompleteEvent(owner_.stopWrite());
+}
+
+void ChipUartLowLevel::startDmaRead(const size_t characterSize)
+{
+	const uint32_t dataSize = characterSize == 1 ? DmaStream::dataSize1 : DmaStream::dataSize2;
+	// reception has higher priority to prevent overrun errors
+	rxDmaStream_->startTransfer(reinterpret_cast<uintptr_t>(readBuffer_),
+			reinterpret_cast<uintptr_t>(&parameters_.getUart().DR), readSize_ / characterSize,
+			DmaStream::peripheralToMemory | DmaStream::memoryIncrement | dataSize | DmaStream::highPriority);
+	parameters_.enableRxDma(true);
+	parameters_.enableIdleInterrupt(true);
+	parameters_.enableErrorInterrupts(true);
+}
+
+void ChipUartLowLevel::startDmaWrite(const size_t characterSize)
+{
+	auto& uart = parameters_.getUart();
+	// TC flag is cleared explicitly, as writes of DR performed by DMA are not preceded by reads of SR
+	uart.SR = ~USART_SR_TC;
+
+	const uint32_t dataSize = characterSize == 1 ? DmaStream::dataSize1 : DmaStream::dataSize2;
+	txDmaStream_->startTransfer(reinterpret_cast<uintptr_t>(writeBuffer_), reinterpret_cast<uintptr_t>(&uart.DR),
+			writeSize_ / characterSize,
+			DmaStream::memoryToPeripheral | DmaStream::memoryIncrement | dataSize | DmaStream::mediumPriority);
+	parameters_.enableTxDma(true);
+}
+
+size_t ChipUartLowLevel::stopDmaRead()
+{
+	parameters_.enableErrorInterrupts(false);
+	parameters_.enableIdleInterrupt(false);
+	const auto transactionsLeft = rxDmaStream_->stopTransfer();
+	// character which is not read by DMA is left in DR until next read is started
+	parameters_.enableRxDma(false);
+	const size_t characterSize = parameters_.getCharacterLength() > 8 ? 2 : 1;
+	return readSize_ - transactionsLeft * characterSize;
+}
+
+size_t ChipUartLowLevel::stopDmaWrite()
+{
+	const auto transactionsLeft = txDmaStream_->stopTransfer();
+	parameters_.enableTxDma(false);
+	const size_t characterSize = parameters_.getCharacterLength() > 8 ? 2 : 1;
+	return writeSize_ - transactionsLeft * characterSize;
+}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 }	// namespace chip
 
 }	// namespace distortos
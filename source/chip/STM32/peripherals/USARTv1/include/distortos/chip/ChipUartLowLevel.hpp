@@ -2,7 +2,7 @@
  * \file
  * \brief ChipUartLowLevel class header for USARTv1 in STM32
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,15 +16,33 @@
 
 #include "distortos/distortosConfiguration.h"
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+#include "distortos/chip/DmaStreamFunctor.hpp"
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 namespace distortos
 {
 
 namespace chip
 {
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+class DmaStream;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 /**
  * ChipUartLowLevel class is a low-level UART driver for USARTv1 in STM32
  *
+ * If the driver is constructed with DMA streams, reads and writes are performed with DMA - one interrupt per operation
+ * instead of one interrupt per character. DMA-based read is also finished when idle line is detected after at least
+ * one character was received. Operations longer than DmaStream::maxTransactions characters, operations with buffers
+ * which are not aligned to the size of character and reads of characters shorter than 8 bits with parity control
+ * enabled are still performed with interrupts.
+ *
  * \ingroup devices
  */
 
@@ -118,6 +136,14 @@ public:
 
 	constexpr explicit ChipUartLowLevel(const Parameters& parameters) :
 			parameters_{parameters},
+#ifdef CONFIG_CHIP_STM32_DMAV2
+			rxDmaStreamFunctor_{*this},
+			txDmaStreamFunctor_{*this},
+			rxDmaStream_{},
+			txDmaStream_{},
+			rxDmaChannel_{},
+			txDmaChannel_{},
+#endif	// def CONFIG_CHIP_STM32_DMAV2
 			uartBase_{},
 			readBuffer_{},
 			readSize_{},
@@ -129,6 +155,40 @@ public:
 
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief ChipUartLowLevel's constructor for DMA-based driver
+	 *
+	 * \param [in] parameters is a reference to object with peripheral parameters
+	 * \param [in] rxDmaStream is a reference to DMA stream used for reception
+	 * \param [in] rxDmaChannel is the channel (request) number of \a rxDmaStream used for reception
+	 * \param [in] txDmaStream is a reference to DMA stream used for transmission
+	 * \param [in] txDmaChannel is the channel (request) number of \a txDmaStream used for transmission
+	 */
+
+	constexpr ChipUartLowLevel(const Parameters& parameters, DmaStream& rxDmaStream, const uint8_t rxDmaChannel,
+			DmaStream& txDmaStream, const uint8_t txDmaChannel) :
+					parameters_{parameters},
+					rxDmaStreamFunctor_{*this},
+					txDmaStreamFunctor_{*this},
+					rxDmaStream_{&rxDmaStream},
+					txDmaStream_{&txDmaStream},
+					rxDmaChannel_{rxDmaChannel},
+					txDmaChannel_{txDmaChannel},
+					uartBase_{},
+					readBuffer_{},
+					readSize_{},
+					readPosition_{},
+					writeBuffer_{},
+					writeSize_{},
+					writePosition_{}
+	{
+
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief ChipUartLowLevel's destructor
 	 *
@@ -161,6 +221,7 @@ public:
 	 * \return pair with return code (0 on success, error code otherwise) and real baud rate; error codes:
 	 * - EBADF - the driver is not stopped;
 	 * - EINVAL - selected baud rate and/or format are invalid;
+	 * - error codes returned by DmaStream::reserve();
 	 */
 
 	std::pair<int, uint32_t> start(devices::UartBase& uartBase, uint32_t baudRate, uint8_t characterLength,
@@ -174,6 +235,9 @@ public:
 	 * UartBase::receiveErrorEvent() will be executed. Note that overrun error may be reported even if it happened when
 	 * no read operation was in progress.
 	 *
+	 * If the read is performed with DMA, it is also finished when idle line is detected after at least one character
+	 * was received - UartBase::readCompleteEvent() is executed with the number of bytes read so far.
+	 *
 	 * \param [out] buffer is the buffer to which the data will be written
 	 * \param [in] size is the size of \a buffer, bytes, must be even if selected character length is greater than 8
 	 * bits
@@ -238,6 +302,101 @@ public:
 
 private:
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/// DmaStreamFunctor used for notifications from DMA stream used for reception
+	class RxDmaStreamFunctor : public DmaStreamFunctor
+	{
+	public:
+
+		/**
+		 * \brief RxDmaStreamFunctor's constructor
+		 *
+		 * \param [in] owner is a reference to ChipUartLowLevel object that owns this functor
+		 */
+
+		constexpr explicit RxDmaStreamFunctor(ChipUartLowLevel& owner) :
+				owner_{owner}
+		{
+
+		}
+
+		/**
+		 * \brief "Transfer complete" event
+		 *
+		 * Finishes the read operation.
+		 */
+
+		void transferCompleteEvent() override;
+
+		/**
+		 * \brief "Transfer error" event
+		 *
+		 * Finishes the read operation with the number of bytes read before the error.
+		 *
+		 * \param [in] transactionsLeft is the number of transactions left
+		 */
+
+		void transferErrorEvent(size_t transactionsLeft) override;
+
+	private:
+
+		/// reference to ChipUartLowLevel object that owns this functor
+		ChipUartLowLevel& owner_;
+	};
+
+	/// DmaStreamFunctor used for notifications from DMA stream used for transmission
+	class TxDmaStreamFunctor : public DmaStreamFunctor
+	{
+	public:
+
+		/**
+		 * \brief TxDmaStreamFunctor's constructor
+		 *
+		 * \param [in] owner is a reference to ChipUartLowLevel object that owns this functor
+		 */
+
+		constexpr explicit TxDmaStreamFunctor(ChipUartLowLevel& owner) :
+				owner_{owner}
+		{
+
+		}
+
+		/**
+		 * \brief "Transfer complete" event
+		 *
+		 * Finishes the write operation.
+		 */
+
+		void transferCompleteEvent() override;
+
+		/**
+		 * \brief "Transfer error" event
+		 *
+		 * Finishes the write operation with the number of bytes written before the error.
+		 *
+		 * \param [in] transactionsLeft is the number of transactions left
+		 */
+
+		void transferErrorEvent(size_t transactionsLeft) override;
+
+	private:
+
+		/// reference to ChipUartLowLevel object that owns this functor
+		ChipUartLowLevel& owner_;
+	};
+
+	/**
+	 * \return true if driver uses DMA for reads and writes, false otherwise
+	 */
+
+	bool isDmaBased() const
+	{
+		return rxDmaStream_ != nullptr;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \return true if driver is started, false otherwise
 	 */
@@ -265,9 +424,67 @@ private:
 		return writeBuffer_ != nullptr;
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Starts DMA-based read of \a readSize_ bytes to \a readBuffer_.
+	 *
+	 * \param [in] characterSize is the size of single character in memory, bytes, {1, 2}
+	 */
+
+	void startDmaRead(size_t characterSize);
+
+	/**
+	 * \brief Starts DMA-based write of \a writeSize_ bytes from \a writeBuffer_.
+	 *
+	 * \param [in] characterSize is the size of single character in memory, bytes, {1, 2}
+	 */
+
+	void startDmaWrite(size_t characterSize);
+
+	/**
+	 * \brief Stops DMA-based read.
+	 *
+	 * \return number of bytes already read
+	 */
+
+	size_t stopDmaRead();
+
+	/**
+	 * \brief Stops DMA-based write.
+	 *
+	 * \return number of bytes already written
+	 */
+
+	size_t stopDmaWrite();
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/// reference to configuration parameters
 	const Parameters& parameters_;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/// functor used for notifications from \a rxDmaStream_
+	RxDmaStreamFunctor rxDmaStreamFunctor_;
+
+	/// functor used for notifications from \a txDmaStream_
+	TxDmaStreamFunctor txDmaStreamFunctor_;
+
+	/// pointer to DMA stream used for reception, nullptr if driver doesn't use DMA
+	DmaStream* rxDmaStream_;
+
+	/// pointer to DMA stream used for transmission, nullptr if driver doesn't use DMA
+	DmaStream* txDmaStream_;
+
+	/// channel (request) number of \a rxDmaStream_
+	uint8_t rxDmaChannel_;
+
+	/// channel (request) number of \a txDmaStream_
+	uint8_t txDmaChannel_;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/// pointer to UartBase object associated with this one
 	devices::UartBase* uartBase_;
 
@@ -2,7 +2,7 @@
  * \file
  * \brief ChipUartLowLevel class implementation for USARTv2 in STM32
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,6 +16,12 @@
 
 #include "distortos/devices/communication/UartBase.hpp"
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+#include "distortos/chip/DmaStream.hpp"
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 #ifndef DISTORTOS_BITBANDING_SUPPORTED
 
 #include "distortos/InterruptMaskingLock.hpp"
@@ -92,6 +98,13 @@ public:
 			rxneieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_RXNEIE)},
 			tcieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_TCIE)},
 			txeieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_TXEIE)},
+#ifdef CONFIG_CHIP_STM32_DMAV2
+			idleieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_IDLEIE)},
+			peieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR1, USART_CR1_PEIE)},
+			eieBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR3, USART_CR3_EIE)},
+			dmarBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR3, USART_CR3_DMAR)},
+			dmatBbAddress_{STM32_BITBAND_IMPLEMENTATION(uartBase, USART_TypeDef, CR3, USART_CR3_DMAT)},
+#endif	// def CONFIG_CHIP_STM32_DMAV2
 			rccEnBbAddress_{rccEnBbAddress},
 			rccRstBbAddress_{rccRstBbAddress}
 	{
@@ -124,6 +137,46 @@ public:
 
 #endif	// !def DISTORTOS_BITBANDING_SUPPORTED
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Enables or disables error interrupts (framing, noise, overrun and parity) of UART.
+	 *
+	 * \param [in] enable selects whether the interrupts will be enabled (true) or disabled (false)
+	 */
+
+	void enableErrorInterrupts(const bool enable) const
+	{
+#ifdef DISTORTOS_BITBANDING_SUPPORTED
+		*reinterpret_cast<volatile unsigned long*>(eieBbAddress_) = enable;
+		*reinterpret_cast<volatile unsigned long*>(peieBbAddress_) = enable;
+#else	// !def DISTORTOS_BITBANDING_SUPPORTED
+		auto& uart = getUart();
+		const InterruptMaskingLock interruptMaskingLock;
+		uart.CR3 = (uart.CR3 & ~USART_CR3_EIE) | (enable == true ? USART_CR3_EIE : 0);
+		uart.CR1 = (uart.CR1 & ~USART_CR1_PEIE) | (enable == true ? USART_CR1_PEIE : 0);
+#endif	// !def DISTORTOS_BITBANDING_SUPPORTED
+	}
+
+	/**
+	 * \brief Enables or disables IDLE interrupt of UART.
+	 *
+	 * \param [in] enable selects whether the interrupt will be enabled (true) or disabled (false)
+	 */
+
+	void enableIdleInterrupt(const bool enable) const
+	{
+#ifdef DISTORTOS_BITBANDING_SUPPORTED
+		*reinterpret_cast<volatile unsigned long*>(idleieBbAddress_) = enable;
+#else	// !def DISTORTOS_BITBANDING_SUPPORTED
+		auto& uart = getUart();
+		const InterruptMaskingLock interruptMaskingLock;
+		uart.CR1 = (uart.CR1 & ~USART_CR1_IDLEIE) | (enable == true ? USART_CR1_IDLEIE : 0);
+#endif	// !def DISTORTOS_BITBANDING_SUPPORTED
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief Enables or disables peripheral clock in RCC.
 	 *
@@ -141,6 +194,27 @@ public:
 #endif	// !def DISTORTOS_BITBANDING_SUPPORTED
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Enables or disables DMA request for reception in UART.
+	 *
+	 * \param [in] enable selects whether the request will be enabled (true) or disabled (false)
+	 */
+
+	void enableRxDma(const bool enable) const
+	{
+#ifdef DISTORTOS_BITBANDING_SUPPORTED
+		*reinterpret_cast<volatile unsigned long*>(dmarBbAddress_) = enable;
+#else	// !def DISTORTOS_BITBANDING_SUPPORTED
+		auto& uart = getUart();
+		const InterruptMaskingLock interruptMaskingLock;
+		uart.CR3 = (uart.CR3 & ~USART_CR3_DMAR) | (enable == true ? USART_CR3_DMAR : 0);
+#endif	// !def DISTORTOS_BITBANDING_SUPPORTED
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief Enables or disables RXNE interrupt of UART.
 	 *
@@ -175,6 +249,27 @@ public:
 #endif	// !def DISTORTOS_BITBANDING_SUPPORTED
 	}
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/**
+	 * \brief Enables or disables DMA request for transmission in UART.
+	 *
+	 * \param [in] enable selects whether the request will be enabled (true) or disabled (false)
+	 */
+
+	void enableTxDma(const bool enable) const
+	{
+#ifdef DISTORTOS_BITBANDING_SUPPORTED
+		*reinterpret_cast<volatile unsigned long*>(dmatBbAddress_) = enable;
+#else	// !def DISTORTOS_BITBANDING_SUPPORTED
+		auto& uart = getUart();
+		const InterruptMaskingLock interruptMaskingLock;
+		uart.CR3 = (uart.CR3 & ~USART_CR3_DMAT) | (enable == true ? USART_CR3_DMAT : 0);
+#endif	// !def DISTORTOS_BITBANDING_SUPPORTED
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/**
 	 * \brief Enables or disables TXE interrupt of UART.
 	 *
@@ -264,6 +359,25 @@ private:
 	/// address of bitband alias of TXEIE bit in USART_CR1 register
 	uintptr_t txeieBbAddress_;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	/// address of bitband alias of IDLEIE bit in USART_CR1 register
+	uintptr_t idleieBbAddress_;
+
+	/// address of bitband alias of PEIE bit in USART_CR1 register
+	uintptr_t peieBbAddress_;
+
+	/// address of bitband alias of EIE bit in USART_CR3 register
+	uintptr_t eieBbAddress_;
+
+	/// address of bitband alias of DMAR bit in USART_CR3 register
+	uintptr_t dmarBbAddress_;
+
+	/// address of bitband alias of DMAT bit in USART_CR3 register
+	uintptr_t dmatBbAddress_;
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	/// address of bitband alias of appropriate U[S]ARTxEN bit in RCC register
 	uintptr_t rccEnBbAddress_;
 
@@ -391,6 +505,18 @@ ChipUartLowLevel::~ChipUartLowLevel()
 	if (isStarted() == false)
 		return;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true)
+	{
+		rxDmaStream_->stopTransfer();
+		txDmaStream_->stopTransfer();
+		rxDmaStream_->release();
+		txDmaStream_->release();
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.resetPeripheral();
 	parameters_.enablePeripheralClock(false);
 }
@@ -399,10 +525,27 @@ void ChipUartLowLevel::interruptHandler()
 {
 	auto& uart = parameters_.getUart();
 	const auto characterLength = parameters_.getCharacterLength();
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if ((uart.CR3 & USART_CR3_EIE) != 0)	// receive errors during DMA-based read?
+	{
+		const auto isr = uart.ISR;
+		const auto isrErrorFlags = isr & (USART_ISR_FE | USART_ISR_NE | USART_ISR_ORE | USART_ISR_PE);
+		if (isrErrorFlags != 0)
+		{
+			uart.ICR = isrErrorFlags;	// clear served error flags
+			uartBase_->receiveErrorEvent(decodeErrors(isr));
+		}
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	uint32_t isr;
 	uint32_t maskedIsr;
 	// loop while there are enabled interrupt sources waiting to be served
-	while (isr = uart.ISR, (maskedIsr = isr & uart.CR1 & (USART_ISR_RXNE | USART_ISR_TXE | USART_ISR_TC)) != 0)
+	while (isr = uart.ISR, (maskedIsr = isr & uart.CR1 &
+			(USART_ISR_RXNE | USART_ISR_TXE | USART_ISR_TC | USART_ISR_IDLE)) != 0)
 	{
 		if ((maskedIsr & USART_ISR_RXNE) != 0)		// read & receive errors
 		{
@@ -423,6 +566,15 @@ void ChipUartLowLevel::interruptHandler()
 			if (readPosition == readSize_)
 				uartBase_->readCompleteEvent(stopRead());
 		}
+#ifdef CONFIG_CHIP_STM32_DMAV2
+		else if ((maskedIsr & USART_ISR_IDLE) != 0)	// idle line during DMA-based read
+		{
+			uart.ICR = USART_ICR_IDLECF;
+			const size_t characterSize = characterLength > 8 ? 2 : 1;
+			if (rxDmaStream_->getTransactionsLeft() * characterSize != readSize_)	// any characters received?
+				uartBase_->readCompleteEvent(stopRead());
+		}
+#endif	// def CONFIG_CHIP_STM32_DMAV2
 		else if ((maskedIsr & USART_ISR_TXE) != 0)	// write
 		{
 			const auto writeBuffer = writeBuffer_;
@@ -461,6 +613,27 @@ std::pair<int, uint32_t> ChipUartLowLevel::start(devices::UartBase& uartBase, co
 	if (realCharacterLength < minCharacterLength + 1 || realCharacterLength > maxCharacterLength)
 		return {EINVAL, {}};
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true)
+	{
+		{
+			const auto ret = rxDmaStream_->reserve(rxDmaChannel_, rxDmaStreamFunctor_);
+			if (ret != 0)
+				return {ret, {}};
+		}
+		{
+			const auto ret = txDmaStream_->reserve(txDmaChannel_, txDmaStreamFunctor_);
+			if (ret != 0)
+			{
+				rxDmaStream_->release();
+				return {ret, {}};
+			}
+		}
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enablePeripheralClock(true);
 	parameters_.resetPeripheral();
 
@@ -489,12 +662,28 @@ int ChipUartLowLevel::startRead(void* const buffer, const size_t size)
 	if (isReadInProgress() == true)
 		return EBUSY;
 
-	if (parameters_.getCharacterLength() > 8 && size % 2 != 0)
+	const auto characterLength = parameters_.getCharacterLength();
+	if (characterLength > 8 && size % 2 != 0)
 		return EINVAL;
 
 	readBuffer_ = static_cast<uint8_t*>(buffer);
 	readSize_ = size;
 	readPosition_ = 0;
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	const size_t characterSize = characterLength > 8 ? 2 : 1;
+	// for characters shorter than 8 bits with parity control enabled the parity bit would be copied by DMA
+	if (isDmaBased() == true && size / characterSize <= DmaStream::maxTransactions &&
+			reinterpret_cast<uintptr_t>(buffer) % characterSize == 0 &&
+			(characterLength >= 8 || (parameters_.getUart().CR1 & USART_CR1_PCE) == 0))
+	{
+		startDmaRead(characterSize);
+		return 0;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enableRxneInterrupt(true);
 	return 0;
 }
@@ -510,7 +699,8 @@ int ChipUartLowLevel::startWrite(const void* const buffer, const size_t size)
 	if (isWriteInProgress() == true)
 		return EBUSY;
 
-	if (parameters_.getCharacterLength() > 8 && size % 2 != 0)
+	const auto characterLength = parameters_.getCharacterLength();
+	if (characterLength > 8 && size % 2 != 0)
 		return EINVAL;
 
 	writeBuffer_ = static_cast<const uint8_t*>(buffer);
@@ -521,6 +711,18 @@ int ChipUartLowLevel::startWrite(const void* const buffer, const size_t size)
 	if ((parameters_.getUart().ISR & USART_ISR_TC) != 0)
 		uartBase_->transmitStartEvent();
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	const size_t characterSize = characterLength > 8 ? 2 : 1;
+	if (isDmaBased() == true && size / characterSize <= DmaStream::maxTransactions &&
+			reinterpret_cast<uintptr_t>(buffer) % characterSize == 0)
+	{
+		startDmaWrite(characterSize);
+		return 0;
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enableTxeInterrupt(true);
 	return 0;
 }
@@ -533,6 +735,16 @@ int ChipUartLowLevel::stop()
 	if (isReadInProgress() == true || isWriteInProgress() == true)
 		return EBUSY;
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if (isDmaBased() == true)
+	{
+		rxDmaStream_->release();
+		txDmaStream_->release();
+	}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.resetPeripheral();
 	parameters_.enablePeripheralClock(false);
 	uartBase_ = nullptr;
@@ -545,7 +757,15 @@ size_t ChipUartLowLevel::stopRead()
 		return 0;
 
 	parameters_.enableRxneInterrupt(false);
-	const auto bytesRead = readPosition_;
+	auto bytesRead = readPosition_;
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if ((parameters_.getUart().CR3 & USART_CR3_DMAR) != 0)	// DMA-based read?
+		bytesRead = stopDmaRead();
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	readPosition_ = {};
 	readSize_ = {};
 	readBuffer_ = {};
@@ -558,14 +778,90 @@ size_t ChipUartLowLevel::stopWrite()
 		return 0;
 
 	parameters_.enableTxeInterrupt(false);
+	auto bytesWritten = writePosition_;
+
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+	if ((parameters_.getUart().CR3 & USART_CR3_DMAT) != 0)	// DMA-based write?
+		bytesWritten = stopDmaWrite();
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 	parameters_.enableTcInterrupt(true);
-	const auto bytesWritten = writePosition_;
 	writePosition_ = {};
 	writeSize_ = {};
 	writeBuffer_ = {};
 	return bytesWritten;
 }
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ChipUartLowLevel::RxDmaStreamFunctor::transferCompleteEvent()
+{
+	owner_.uartBase_->readCompleteEvent(owner_.stopRead());
+}
+
+void ChipUartLowLevel::RxDmaStreamFunctor::transferErrorEvent(size_t)
+{
+	owner_.uartBase_->readCompleteEvent(owner_.stopRead());
+}
+
+void ChipUartLowLevel::TxDmaStreamFunctor::transferCompleteEvent()
+{
+	owner_.uartBase_->writeCompleteEvent(owner_.stopWrite());
+}
+
+void ChipUartLowLevel::TxDmaStreamFunctor::transferErrorEvent(size_t)
+{
+	owner_.uartBase_->writeCompleteEvent(owner_.stopWrite());
+}
+
+void ChipUartLowLevel::startDmaRead(const size_t characterSize)
+{
+	const uint32_t dataSize = characterSize == 1 ? DmaStream::dataSize1 : DmaStream::dataSize2;
+	// reception has higher priority to prevent overrun errors
+	rxDmaStream_->startTransfer(reinterpret_cast<uintptr_t>(readBuffer_),
+			reinterpret_cast<uintptr_t>(&parameters_.getUart().RDR), readSize_ / characterSize,
+			DmaStream::peripheralToMemory | DmaStream::memoryIncrement | dataSize | DmaStream::highPriority);
+	parameters_.enableRxDma(true);
+	parameters_.enableIdleInterrupt(true);
+	parameters_.enableErrorInterrupts(true);
+}
+
+void ChipUartLowLevel::startDmaWrite(const size_t characterSize)
+{
+	const uint32_t dataSize = characterSize == 1 ? DmaStream::dataSize1 : DmaStream::dataSize2;
+	txDmaStream_->startTransfer(reinterpret_cast<uintptr_t>(writeBuffer_),
+			reinterpret_cast<uintptr_t>(&parameters_.getUart().TDR), writeSize_ / characterSize,
+			DmaStream::memoryToPeripheral | DmaStream::memoryIncrement | dataSize | DmaStream::mediumPriority);
+	parameters_.enableTxDma(true);
+}
+
+size_t ChipUartLowLevel::stopDmaRead()
+{
+	parameters_.enableErrorInterrupts(false);
+	parameters_.enableIdleInterrupt(false);
+	const auto transactionsLeft = rxDmaStream_->stopTransfer();
+	// character which is not read by DMA is left in RDR until next read is started
+	parameters_.enableRxDma(false);
+	const size_t characterSize = parameters_.getCharacterLength() > 8 ? 2 : 1;
+	return readSize_ - transactionsLeft * characterSize;
+}
+
+size_t ChipUartLowLevel::stopDmaWrite()
+{
+	const auto transactionsLeft = txDmaStream_->stopTransfer();
+	parameters_.enableTxDma(false);
+	const size_t characterSize = parameters_.getCharacterLength() > 8 ? 2 : 1;
+	return writeSize_ - transactionsLeft * characterSize;
+}
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 }	// namespace chip
 
 }	// namespace distortos
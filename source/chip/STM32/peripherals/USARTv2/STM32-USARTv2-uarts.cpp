@@ -2,7 +2,7 @@
  * \file
  * \brief Definitions of low-level UART drivers for USARTv2 in STM32
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,12 @@
 
 #include "distortos/chip/ChipUartLowLevel.hpp"
 
+#ifdef CONFIG_CHIP_STM32_DMAV2
+
+#include "distortos/chip/dmas.hpp"
+
+#endif	// def CONFIG_CHIP_STM32_DMAV2
+
 namespace distortos
 {
 
@@ -25,26 +31,74 @@ namespace chip
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_USART1_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_USARTV2_USART1_DMA_BASED
+
+ChipUartLowLevel usart1 {ChipUartLowLevel::usart1Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_USART1_DMA, CONFIG_CHIP_STM32_USARTV2_USART1_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_USART1_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_USART1_DMA, CONFIG_CHIP_STM32_USARTV2_USART1_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_USART1_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_USARTV2_USART1_DMA_BASED
+
 ChipUartLowLevel usart1 {ChipUartLowLevel::usart1Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_USARTV2_USART1_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_USARTV2_USART1_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_USART2_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_USARTV2_USART2_DMA_BASED
+
+ChipUartLowLevel usart2 {ChipUartLowLevel::usart2Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_USART2_DMA, CONFIG_CHIP_STM32_USARTV2_USART2_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_USART2_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_USART2_DMA, CONFIG_CHIP_STM32_USARTV2_USART2_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_USART2_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_USARTV2_USART2_DMA_BASED
+
 ChipUartLowLevel usart2 {ChipUartLowLevel::usart2Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_USARTV2_USART2_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_USARTV2_USART2_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_USART3_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_USARTV2_USART3_DMA_BASED
+
+ChipUartLowLevel usart3 {ChipUartLowLevel::usart3Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_USART3_DMA, CONFIG_CHIP_STM32_USARTV2_USART3_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_USART3_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_USART3_DMA, CONFIG_CHIP_STM32_USARTV2_USART3_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_USART3_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_USARTV2_USART3_DMA_BASED
+
 ChipUartLowLevel usart3 {ChipUartLowLevel::usart3Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_USARTV2_USART3_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_USARTV2_USART3_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_UART4_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_USARTV2_UART4_DMA_BASED
+
+ChipUartLowLevel uart4 {ChipUartLowLevel::uart4Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_UART4_DMA, CONFIG_CHIP_STM32_USARTV2_UART4_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_UART4_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_UART4_DMA, CONFIG_CHIP_STM32_USARTV2_UART4_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_UART4_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_USARTV2_UART4_DMA_BASED
+
 ChipUartLowLevel uart4 {ChipUartLowLevel::uart4Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_USARTV2_UART4_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_USARTV2_UART4_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_USART4_ENABLE
@@ -55,8 +109,20 @@ ChipUartLowLevel usart4 {ChipUartLowLevel::usart4Parameters};
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_UART5_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_USARTV2_UART5_DMA_BASED
+
+ChipUartLowLevel uart5 {ChipUartLowLevel::uart5Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_UART5_DMA, CONFIG_CHIP_STM32_USARTV2_UART5_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_UART5_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_UART5_DMA, CONFIG_CHIP_STM32_USARTV2_UART5_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_UART5_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_USARTV2_UART5_DMA_BASED
+
 ChipUartLowLevel uart5 {ChipUartLowLevel::uart5Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_USARTV2_UART5_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_USARTV2_UART5_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_USART5_ENABLE
@@ -67,14 +133,38 @@ ChipUartLowLevel usart5 {ChipUartLowLevel::usart5Parameters};
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_USART6_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_USARTV2_USART6_DMA_BASED
+
+ChipUartLowLevel usart6 {ChipUartLowLevel::usart6Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_USART6_DMA, CONFIG_CHIP_STM32_USARTV2_USART6_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_USART6_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_USART6_DMA, CONFIG_CHIP_STM32_USARTV2_USART6_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_USART6_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_USARTV2_USART6_DMA_BASED
+
 ChipUartLowLevel usart6 {ChipUartLowLevel::usart6Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_USARTV2_USART6_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_USARTV2_USART6_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_UART7_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_USARTV2_UART7_DMA_BASED
+
+ChipUartLowLevel uart7 {ChipUartLowLevel::uart7Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_UART7_DMA, CONFIG_CHIP_STM32_USARTV2_UART7_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_UART7_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_UART7_DMA, CONFIG_CHIP_STM32_USARTV2_UART7_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_UART7_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_USARTV2_UART7_DMA_BASED
+
 ChipUartLowLevel uart7 {ChipUartLowLevel::uart7Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_USARTV2_UART7_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_USARTV2_UART7_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_USART7_ENABLE
@@ -85,8 +175,20 @@ ChipUartLowLevel usart7 {ChipUartLowLevel::usart7Parameters};
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_UART8_ENABLE
 
+#ifdef CONFIG_CHIP_STM32_USARTV2_UART8_DMA_BASED
+
+ChipUartLowLevel uart8 {ChipUartLowLevel::uart8Parameters,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_UART8_DMA, CONFIG_CHIP_STM32_USARTV2_UART8_RX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_UART8_RX_DMA_CHANNEL,
+		STM32_DMAV2_STREAM(CONFIG_CHIP_STM32_USARTV2_UART8_DMA, CONFIG_CHIP_STM32_USARTV2_UART8_TX_DMA_STREAM),
+		CONFIG_CHIP_STM32_USARTV2_UART8_TX_DMA_CHANNEL};
+
+#else	// !def CONFIG_CHIP_STM32_USARTV2_UART8_DMA_BASED
+
 ChipUartLowLevel uart8 {ChipUartLowLevel::uart8Parameters};
 
+#endif	// !def CONFIG_CHIP_STM32_USARTV2_UART8_DMA_BASED
+
 #endif	// def CONFIG_CHIP_STM32_USARTV2_UART8_ENABLE
 
 #ifdef CONFIG_CHIP_STM32_USARTV2_USART8_ENABLE
@@ -9,6 +9,7 @@
 
 if(CONFIG_CHIP_STM32)
 
+	include(${CMAKE_CURRENT_LIST_DIR}/DMAv2/distortos-sources.cmake)
 	include(${CMAKE_CURRENT_LIST_DIR}/GPIOv1/distortos-sources.cmake)
 	include(${CMAKE_CURRENT_LIST_DIR}/GPIOv2/distortos-sources.cmake)
 	include(${CMAKE_CURRENT_LIST_DIR}/SPIv1/distortos-sources.cmake)
@@ -2,7 +2,7 @@
  * \file
  * \brief SerialPort class implementation
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -17,6 +17,7 @@
 
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/Semaphore.hpp"
+#include "distortos/ThisThread.hpp"
 
 #include "estd/ScopeGuard.hpp"
 
@@ -113,6 +114,76 @@ SerialPort::~SerialPort()
 	uart_.stop();
 }
 
+std::pair<int, std::pair<const uint8_t*, size_t>> SerialPort::acquireReadBlock(const size_t minSize,
+		const TickClock::time_point* const timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	{
+		const auto ret = minSize == 0 ? readMutex_.tryLock() :
+				timePoint != nullptr ? readMutex_.tryLockUntil(*timePoint) : readMutex_.lock();
+		if (ret != 0)
+			return {ret != EBUSY ? ret : EAGAIN, {}};
+	}
+	auto readMutexScopeGuard = estd::makeScopeGuard(
+			[this]()
+			{
+				readMutex_.unlock();
+			});
+
+	if (openCount_ == 0)
+		return {EBADF, {}};
+
+	{
+		const auto ret = waitForReadBlock(minSize, timePoint);
+		if (ret != 0)
+			return {ret, {}};
+	}
+
+	const auto readBlock = readBuffer_.getReadBlock();
+	if (readBlock.second == 0)
+		return {EAGAIN, {}};
+
+	readBlockOwner_ = &ThisThread::get();
+	readMutexScopeGuard.release();	// mutex will be unlocked in releaseReadBlock()
+	return {{}, readBlock};
+}
+
+std::pair<int, std::pair<uint8_t*, size_t>> SerialPort::acquireWriteBlock(const size_t minSize,
+		const TickClock::time_point* const timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	{
+		const auto ret = minSize == 0 ? writeMutex_.tryLock() :
+				timePoint != nullptr ? writeMutex_.tryLockUntil(*timePoint) : writeMutex_.lock();
+		if (ret != 0)
+			return {ret != EBUSY ? ret : EAGAIN, {}};
+	}
+	auto writeMutexScopeGuard = estd::makeScopeGuard(
+			[this]()
+			{
+				writeMutex_.unlock();
+			});
+
+	if (openCount_ == 0)
+		return {EBADF, {}};
+
+	{
+		const auto ret = waitForWriteBlock(minSize, timePoint);
+		if (ret != 0)
+			return {ret, {}};
+	}
+
+	const auto writeBlock = writeBuffer_.getWriteBlock();
+	if (writeBlock.second == 0)
+		return {EAGAIN, {}};
+
+	writeBlockOwner_ = &ThisThread::get();
+	writeMutexScopeGuard.release();	// mutex will be unlocked in releaseWriteBlock()
+	return {{}, writeBlock};
+}
+
 int SerialPort::close()
 {
 	readMutex_.lock();
@@ -241,6 +312,49 @@ std::pair<int, size_t> SerialPort::read(void* const buffer, const size_t size, c
 	return {ret != 0 || bytesRead != 0 ? ret : EAGAIN, bytesRead};
 }
 
+int SerialPort::releaseReadBlock(const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	if (readBlockOwner_ != &ThisThread::get())
+		return EPERM;
+
+	const auto readMutexScopeGuard = estd::makeScopeGuard(
+			[this]()
+			{
+				readBlockOwner_ = {};
+				readMutex_.unlock();
+			});
+
+	if (size > readBuffer_.getReadBlock().second || (characterLength_ > 8 && size % 2 != 0))
+		return EINVAL;
+
+	readBuffer_.increaseReadPosition(size);
+	// reception may have been stopped because internal buffer was full
+	return startReadWrapper();
+}
+
+int SerialPort::releaseWriteBlock(const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	if (writeBlockOwner_ != &ThisThread::get())
+		return EPERM;
+
+	const auto writeMutexScopeGuard = estd::makeScopeGuard(
+			[this]()
+			{
+				writeBlockOwner_ = {};
+				writeMutex_.unlock();
+			});
+
+	if (size > writeBuffer_.getWriteBlock().second || (characterLength_ > 8 && size % 2 != 0))
+		return EINVAL;
+
+	writeBuffer_.increaseWritePosition(size);
+	return startWriteWrapper();
+}
+
 std::pair<int, size_t> SerialPort::write(const void* const buffer, const size_t size, const size_t minSize,
 		const TickClock::time_point* const timePoint)
 {
@@ -452,6 +566,47 @@ int SerialPort::readImplementation(CircularBuffer& buffer, const size_t minSize,
 	return scopeGuardRet != 0 ? scopeGuardRet : semaphoreRet;
 }
 
+int SerialPort::startReadNotification(Semaphore& semaphore)
+{
+	{
+		const auto ret = readMutex_.tryLock();
+		if (ret != 0)
+			return ret;
+	}
+	auto readMutexScopeGuard = estd::makeScopeGuard(
+			[this]()
+			{
+				readMutex_.unlock();
+			});
+
+	if (openCount_ == 0)
+		return EBADF;
+
+	{
+		// Current read transfer (if any) must be stopped for a short moment to get the amount of data available in the
+		// internal circular buffer (interrupts are masked to prevent preemption). If the buffer is empty, notification
+		// after receiving single character will mean that the serial port is readable.
+		const InterruptMaskingLock interruptMaskingLock;
+		stopReadWrapper();
+		if (readBuffer_.isEmpty() == true)
+		{
+			// when character length is greater than 8 bits, single character occupies 2 bytes
+			readLimit_ = characterLength_ <= 8 ? 1 : 2;
+			readSemaphore_ = &semaphore;
+		}
+		const auto ret = startReadWrapper();
+		if (ret != 0)
+		{
+			readLimit_ = {};
+			readSemaphore_ = {};
+			return ret;
+		}
+	}
+
+	readMutexScopeGuard.release();	// mutex will be unlocked in stopReadNotification()
+	return 0;
+}
+
 int SerialPort::startReadWrapper()
 {
 	if (readInProgress_ == true)
@@ -490,6 +645,17 @@ int SerialPort::startWriteWrapper()
 			std::min({readBlock.second, writeBufferHalf, writeLimit != 0 ? writeLimit : SIZE_MAX}));
 }
 
+void SerialPort::stopReadNotification()
+{
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+		readLimit_ = {};
+		readSemaphore_ = {};
+	}
+
+	readMutex_.unlock();
+}
+
 size_t SerialPort::stopReadWrapper()
 {
 	const auto bytesRead = uart_.stopRead();
@@ -510,6 +676,80 @@ size_t SerialPort::stopWriteWrapper()
 	return bytesWritten;
 }
 
+int SerialPort::waitForReadBlock(const size_t minSize, const TickClock::time_point* const timePoint)
+{
+	// when character length is greater than 8 bits, round up "minSize" value
+	const auto adjustedMinSize =
+			std::min(readBuffer_.getCapacity(), characterLength_ <= 8 ? minSize : ((minSize + 1) / 2) * 2);
+
+	if (readBuffer_.getSize() >= adjustedMinSize)
+		return 0;
+
+	Semaphore semaphore {0};
+	const auto scopeGuard = estd::makeScopeGuard(
+			[this]()
+			{
+				readLimit_ = {};
+				readSemaphore_ = {};
+			});
+
+	{
+		// Current read transfer (if any) must be stopped for a short moment to get the amount of data available in the
+		// internal circular buffer (interrupts are masked to prevent preemption). Notification after receiving the
+		// difference between this value and the minimum size will mean that the buffer has enough data.
+		const InterruptMaskingLock interruptMaskingLock;
+		stopReadWrapper();
+		const auto bytesAvailable = readBuffer_.getSize();
+		if (adjustedMinSize > bytesAvailable)	// is blocking required?
+		{
+			readLimit_ = adjustedMinSize - bytesAvailable;
+			readSemaphore_ = &semaphore;
+		}
+		const auto ret = startReadWrapper();
+		if (ret != 0 || adjustedMinSize <= bytesAvailable)
+			return ret;
+	}
+
+	return timePoint != nullptr ? semaphore.tryWaitUntil(*timePoint) : semaphore.wait();
+}
+
+int SerialPort::waitForWriteBlock(const size_t minSize, const TickClock::time_point* const timePoint)
+{
+	// when character length is greater than 8 bits, round up "minSize" value
+	const auto capacity = writeBuffer_.getCapacity();
+	const auto adjustedMinSize = std::min(capacity, characterLength_ <= 8 ? minSize : ((minSize + 1) / 2) * 2);
+
+	if (capacity - writeBuffer_.getSize() >= adjustedMinSize)
+		return 0;
+
+	Semaphore semaphore {0};
+	const auto scopeGuard = estd::makeScopeGuard(
+			[this]()
+			{
+				writeLimit_ = {};
+				writeSemaphore_ = {};
+			});
+
+	{
+		// Current write transfer (if any) must be stopped for a short moment to get the amount of free space in the
+		// internal circular buffer (interrupts are masked to prevent preemption). Notification after transmitting the
+		// difference between the minimum size and this value will mean that the buffer is "empty enough".
+		const InterruptMaskingLock interruptMaskingLock;
+		stopWriteWrapper();
+		const auto bytesFree = capacity - writeBuffer_.getSize();
+		if (adjustedMinSize > bytesFree)	// is blocking required?
+		{
+			writeLimit_ = adjustedMinSize - bytesFree;
+			writeSemaphore_ = &semaphore;
+		}
+		const auto ret = startWriteWrapper();
+		if (ret != 0 || adjustedMinSize <= bytesFree)
+			return ret;
+	}
+
+	return timePoint != nullptr ? semaphore.tryWaitUntil(*timePoint) : semaphore.wait();
+}
+
 int SerialPort::writeImplementation(CircularBuffer& buffer, const size_t minSize,
 		const TickClock::time_point* const timePoint)
 {
@@ -2,7 +2,7 @@
  * \file
  * \brief SpiEeprom class implementation
  *
- * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -20,6 +20,7 @@
 
 #include "estd/ScopeGuard.hpp"
 
+#include <array>
 #include <tuple>
 
 #include <cerrno>
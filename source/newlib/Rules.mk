@@ -1,12 +1,14 @@
 #
 # file: Rules.mk
 #
-# author: Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+# author: Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
 #
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #
 
+ifneq ($(CONFIG_ARCHITECTURE_HOST),y)
+
 #-----------------------------------------------------------------------------------------------------------------------
 # compilation flags
 #-----------------------------------------------------------------------------------------------------------------------
@@ -19,3 +21,5 @@ CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) $(ARCHITECTURE_INCLUDES)
 #-----------------------------------------------------------------------------------------------------------------------
 
 include $(DISTORTOS_PATH)footer.mk
+
+endif	# neq ($(CONFIG_ARCHITECTURE_HOST),y)
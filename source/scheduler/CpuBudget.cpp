@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief CpuBudget class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/CpuBudget.hpp"
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+TickClock::duration CpuBudget::getRemainingBudget() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return cpuBudgetControlBlock_.getRemainingBudget();
+}
+
+bool CpuBudget::isThrottled() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return cpuBudgetControlBlock_.isThrottled();
+}
+
+}	// namespace distortos
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
@@ -0,0 +1,101 @@
+/**
+ * \file
+ * \brief CpuBudgetControlBlock class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/CpuBudgetControlBlock.hpp"
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include "distortos/assert.h"
+#include "distortos/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+CpuBudgetControlBlock::CpuBudgetControlBlock(const TickClock::duration budget, const TickClock::duration period) :
+		threadList_{},
+		replenishmentTimer_{*this},
+		budget_{budget},
+		remainingBudget_{budget},
+		throttled_{}
+{
+	assert(budget > TickClock::duration{} && "Invalid budget!");
+	assert(period > TickClock::duration{} && "Invalid period!");
+
+	replenishmentTimer_.start(period, period);
+}
+
+CpuBudgetControlBlock::~CpuBudgetControlBlock()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	while (threadList_.empty() == false)
+		threadList_.front().setCpuBudget(nullptr);
+}
+
+void CpuBudgetControlBlock::add(ThreadControlBlock& threadControlBlock)
+{
+	threadList_.push_back(threadControlBlock);
+	threadControlBlock.setThrottled(throttled_);
+}
+
+void CpuBudgetControlBlock::remove(ThreadControlBlock& threadControlBlock)
+{
+	threadControlBlock.setThrottled(false);
+	List::erase(List::iterator{threadControlBlock});
+}
+
+void CpuBudgetControlBlock::tickInterruptHandler()
+{
+	if (throttled_ == true)
+		return;
+
+	--remainingBudget_;
+	if (remainingBudget_ <= TickClock::duration{})
+		setThrottled(true);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void CpuBudgetControlBlock::ReplenishmentTimer::run()
+{
+	owner_.replenish();
+}
+
+void CpuBudgetControlBlock::replenish()
+{
+	remainingBudget_ = budget_;
+	if (throttled_ == true)
+		setThrottled(false);
+}
+
+void CpuBudgetControlBlock::setThrottled(const bool throttled)
+{
+	throttled_ = throttled;
+	for (auto& threadControlBlock : threadList_)
+		threadControlBlock.setThrottled(throttled);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
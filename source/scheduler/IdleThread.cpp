@@ -9,6 +9,10 @@
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include "distortos/architecture/ticklessIdle.hpp"
+
+#include "distortos/internal/scheduler/getIdleThread.hpp"
+
 #include "distortos/internal/memory/DeferredThreadDeleter.hpp"
 #include "distortos/internal/memory/getDeferredThreadDeleter.hpp"
 
@@ -33,9 +37,11 @@ void idleThreadFunction();
 /// size of idle thread's stack, bytes
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 constexpr size_t idleThreadStackSize {320};
-#else	// !def CONFIG_THREAD_DETACH_ENABLE
+#elif defined(CONFIG_TICKLESS_IDLE_ENABLE)
+constexpr size_t idleThreadStackSize {192};
+#else	// !def CONFIG_THREAD_DETACH_ENABLE && !def CONFIG_TICKLESS_IDLE_ENABLE
 constexpr size_t idleThreadStackSize {128};
-#endif	// !def CONFIG_THREAD_DETACH_ENABLE
+#endif	// !def CONFIG_THREAD_DETACH_ENABLE && !def CONFIG_TICKLESS_IDLE_ENABLE
 
 /// type of idle thread
 using IdleThread = decltype(makeStaticThread<idleThreadStackSize>(0, idleThreadFunction));
@@ -64,6 +70,12 @@ void idleThreadFunction()
 		getDeferredThreadDeleter().tryCleanup();	/// \todo error handling?
 
 #endif	// def CONFIG_THREAD_DETACH_ENABLE
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+		architecture::ticklessIdle();
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
 	}
 }
 
@@ -83,6 +95,15 @@ BIND_LOW_LEVEL_INITIALIZER(20, idleThreadLowLevelInitializer);
 
 }	// namespace
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+Thread& getIdleThread()
+{
+	return reinterpret_cast<IdleThread&>(idleThreadStorage);
+}
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -0,0 +1,150 @@
+/**
+ * \file
+ * \brief RunnableThreadList class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/RunnableThreadList.hpp"
+
+#if CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+#include "distortos/architecture/countLeadingZeros.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+RunnableThreadList::iterator RunnableThreadList::insert(reference newElement)
+{
+	const auto element = UnsortedIntrusiveList::insert(findInsertPosition(newElement, false), newElement);
+	registerElement(element, newElement.getEffectivePriority());
+	return element;
+}
+
+void RunnableThreadList::reposition(const iterator element, const uint8_t oldPriority, const bool loweringBefore)
+{
+	unregisterElement(element, oldPriority);
+	UnsortedIntrusiveList::splice(findInsertPosition(*element, loweringBefore), element);
+	registerElement(element, element->getEffectivePriority());
+}
+
+void RunnableThreadList::splice(const iterator splicedElement)
+{
+	const auto priority = splicedElement->getEffectivePriority();
+	if (splicedElement->getList() == this)
+		unregisterElement(splicedElement, priority);
+	UnsortedIntrusiveList::splice(findInsertPosition(*splicedElement, false), splicedElement);
+	registerElement(splicedElement, priority);
+}
+
+void RunnableThreadList::spliceTo(ThreadList& container, const iterator splicedElement)
+{
+	unregisterElement(splicedElement, splicedElement->getEffectivePriority());
+	container.splice(splicedElement);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+RunnableThreadList::iterator RunnableThreadList::findInsertPosition(const_reference element, const bool front)
+{
+	const auto priority = element.getEffectivePriority();
+	const auto levelEmpty = (levelBitmap_[priority / bitsPerWord_] & (1u << priority % bitsPerWord_)) == 0;
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	const auto deadline = element.getDeadline();
+	// elements with the same effective priority are sorted by deadline, linear search is needed, unless the element
+	// has no deadline and should be linked at the tail of its level
+	if (levelEmpty == false && (front == true || deadline != TickClock::time_point::max()))
+	{
+		auto position = levelHeads_[priority];
+		while (position != end() && position->getEffectivePriority() == priority &&
+				(&*position == &element || position->getDeadline() < deadline ||
+				(front == false && position->getDeadline() == deadline)))
+			++position;
+		return position;
+	}
+
+#else	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE != 1
+
+	if (front == true && levelEmpty == false)
+		return levelHeads_[priority];
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE != 1
+
+	const auto lowerLevel = findLowerLevel(priority);
+	return lowerLevel < 0 ? end() : levelHeads_[lowerLevel];
+}
+
+int RunnableThreadList::findLowerLevel(const uint8_t priority) const
+{
+	const auto word = priority / bitsPerWord_;
+	const auto lowerBits = levelBitmap_[word] & ((1u << priority % bitsPerWord_) - 1);
+	if (lowerBits != 0)
+		return word * bitsPerWord_ + bitsPerWord_ - 1 - architecture::countLeadingZeros(lowerBits);
+
+	const auto lowerWords = levelBitmapSummary_ & ((1u << word) - 1);
+	if (lowerWords == 0)
+		return -1;
+
+	const auto lowerWord = bitsPerWord_ - 1 - architecture::countLeadingZeros(lowerWords);
+	return lowerWord * bitsPerWord_ + bitsPerWord_ - 1 - architecture::countLeadingZeros(levelBitmap_[lowerWord]);
+}
+
+void RunnableThreadList::registerElement(const iterator element, const uint8_t priority)
+{
+	auto& word = levelBitmap_[priority / bitsPerWord_];
+	const uint32_t bit {1u << priority % bitsPerWord_};
+	// element was linked in non-empty level, but not at its head?
+	if ((word & bit) != 0 && std::next(element) != levelHeads_[priority])
+		return;
+
+	levelHeads_[priority] = element;
+	word |= bit;
+	levelBitmapSummary_ |= 1u << priority / bitsPerWord_;
+}
+
+void RunnableThreadList::unregisterElement(const iterator element, const uint8_t priority)
+{
+	if (levelHeads_[priority] != element)	// element is not the first one in its level
+		return;
+
+	const auto next = std::next(element);
+	if (next != end() && next->getEffectivePriority() == priority)
+	{
+		levelHeads_[priority] = next;
+		return;
+	}
+
+	// element is the last one in its level
+	auto& word = levelBitmap_[priority / bitsPerWord_];
+	word &= ~(1u << priority % bitsPerWord_);
+	if (word == 0)
+		levelBitmapSummary_ &= ~(1u << priority / bitsPerWord_);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private static member variables
++---------------------------------------------------------------------------------------------------------------------*/
+
+constexpr size_t RunnableThreadList::levels_;
+constexpr size_t RunnableThreadList::bitsPerWord_;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
@@ -11,8 +11,10 @@
 
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#include "distortos/architecture/getCycleCounter.hpp"
 #include "distortos/architecture/requestContextSwitch.hpp"
 
+#include "distortos/internal/scheduler/CpuBudgetControlBlock.hpp"
 #include "distortos/internal/scheduler/forceContextSwitch.hpp"
 
 #include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
@@ -20,6 +22,7 @@
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/StaticSoftwareTimer.hpp"
 
+#include <algorithm>
 #include <cerrno>
 
 namespace distortos
@@ -178,12 +181,39 @@ uint64_t Scheduler::getContextSwitchCount() const
 	return contextSwitchCount_;
 }
 
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+TickClock::duration Scheduler::getTicklessIdleDuration() const
+{
+	if (std::next(runnableList_.begin()) != runnableList_.end())	// idle thread is not the only runnable thread?
+		return TickClock::duration{};
+
+	const auto timePoint = softwareTimerSupervisor_.getNextTimePoint();
+	if (timePoint == TickClock::time_point::max())
+		return TickClock::duration::max();
+
+	// software timer which already expired (but wasn't executed yet) allows only regular wait for next "tick" interrupt
+	return std::max(timePoint - TickClock::time_point{TickClock::duration{tickCount_}}, TickClock::duration{1});
+}
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 uint64_t Scheduler::getTickCount() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
 	return tickCount_;
 }
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+uint64_t Scheduler::getTotalRunTime() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return totalRunTime_;
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 int Scheduler::initialize(ThreadControlBlock& mainThreadControlBlock)
 {
 	const auto ret = addInternal(mainThreadControlBlock);
@@ -215,6 +245,22 @@ int Scheduler::remove()
 	return 0;
 }
 
+int Scheduler::requeue(ThreadList& container, const ThreadList::iterator iterator, const ThreadState state)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	auto& threadControlBlock = *iterator;
+	const auto list = threadControlBlock.getList();
+	if (list == nullptr || list == &runnableList_ || list == &suspendedList_)
+		return EINVAL;
+
+	container.splice(iterator);
+	threadControlBlock.setList(&container);
+	threadControlBlock.setState(state);
+
+	return 0;
+}
+
 int Scheduler::resume(const ThreadList::iterator iterator)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -252,6 +298,13 @@ void* Scheduler::switchContext(void* const stackPointer)
 #endif	// def CONFIG_CHECK_STACK_GUARD_CONTEXT_SWITCH_ENABLE
 
 	stack.setStackPointer(stackPointer);
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	updateRunTime();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	currentThreadControlBlock_ = runnableList_.begin();
 	getCurrentThreadControlBlock().switchedToHook();
 	return getCurrentThreadControlBlock().getStack().getStackPointer();
@@ -270,6 +323,12 @@ bool Scheduler::tickInterruptHandler()
 
 	++tickCount_;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	updateRunTime();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	getCurrentThreadControlBlock().getRoundRobinQuantum().decrement();
 
 	// if the object is on the "runnable" list, it uses SchedulingPolicy::roundRobin and it used its round-robin
@@ -283,6 +342,18 @@ bool Scheduler::tickInterruptHandler()
 		runnableList_.splice(currentThreadControlBlock_);
 	}
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+	{
+		// charge this tick to CPU budget of current thread - if the budget gets exhausted, all its threads are
+		// throttled and context switch may be requested
+		const auto cpuBudgetControlBlock = getCurrentThreadControlBlock().getCpuBudgetControlBlock();
+		if (cpuBudgetControlBlock != nullptr)
+			cpuBudgetControlBlock->tickInterruptHandler();
+	}
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
 	softwareTimerSupervisor_.tickInterruptHandler(TickClock::time_point{TickClock::duration{tickCount_}});
 
 	return isContextSwitchRequired();
@@ -329,7 +400,7 @@ int Scheduler::blockInternal(ThreadList& container, const ThreadList::iterator i
 	if (threadControlBlock.getList() != &runnableList_)
 		return EINVAL;
 
-	container.splice(iterator);
+	runnableList_.spliceTo(container, iterator);
 	threadControlBlock.setList(&container);
 	threadControlBlock.setState(state);
 	threadControlBlock.blockHook(unblockFunctor);
@@ -357,6 +428,25 @@ void Scheduler::unblockInternal(const ThreadList::iterator iterator, const Unblo
 	threadControlBlock.unblockHook(unblockReason);
 }
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+void Scheduler::updateRunTime()
+{
+#ifdef CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER
+	const uint32_t runTimeCounter {architecture::getCycleCounter()};
+#else	// !def CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER
+	const uint32_t runTimeCounter {static_cast<uint32_t>(tickCount_)};
+#endif	// !def CONFIG_ARCHITECTURE_HAS_CYCLE_COUNTER
+
+	// unsigned arithmetic handles wrap-around of the counter, as it is read at least once per tick
+	const uint32_t elapsed {runTimeCounter - runTimeCounter_};
+	runTimeCounter_ = runTimeCounter;
+	totalRunTime_ += elapsed;
+	getCurrentThreadControlBlock().addRunTime(elapsed);
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
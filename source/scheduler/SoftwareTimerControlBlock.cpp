@@ -13,6 +13,7 @@
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
 #include "distortos/InterruptMaskingLock.hpp"
 
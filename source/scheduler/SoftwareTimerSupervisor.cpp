@@ -15,6 +15,14 @@
 
 #include "distortos/InterruptMaskingLock.hpp"
 
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+#include "distortos/architecture/countLeadingZeros.hpp"
+
+#endif	// def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+#include <algorithm>
+
 namespace distortos
 {
 
@@ -25,11 +33,81 @@ namespace internal
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+void SoftwareTimerSupervisor::add(SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	// software timer which already expired is put in the bucket checked at the next tick
+	const auto index = getBucketIndex(std::max(softwareTimerControlBlock.getTimePoint(),
+			lastTimePoint_ + TickClock::duration{1}));
+	buckets_[index].push_back(softwareTimerControlBlock);
+	bucketsBitmap_[index / bitsPerWord_] |= 1u << index % bitsPerWord_;
+}
+
+TickClock::time_point SoftwareTimerSupervisor::getNextTimePoint() const
+{
+	// software timers from the bucket checked at some time point cannot expire before this time point, so the first
+	// marked bucket - starting from the one checked at the next tick - gives the result without examining any software
+	// timer
+	const auto firstTimePoint = lastTimePoint_ + TickClock::duration{1};
+	const auto firstIndex = getBucketIndex(firstTimePoint);
+	auto index = findMarkedBucket(firstIndex, bucketsCount_);
+	if (index == bucketsCount_)
+		index = findMarkedBucket(0, firstIndex);
+	if (index == bucketsCount_)
+		return TickClock::time_point::max();
+
+	return firstTimePoint + TickClock::duration{(index + bucketsCount_ - firstIndex) % bucketsCount_};
+}
+
+void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
+{
+	// check buckets of all time points since previous call, as some ticks may have been skipped (e.g. in tickless idle
+	// mode)
+	const auto firstTimePoint = std::max(lastTimePoint_ + TickClock::duration{1},
+			timePoint - TickClock::duration{bucketsCount_ - 1});
+	lastTimePoint_ = timePoint;
+
+	for (auto checkedTimePoint = firstTimePoint; checkedTimePoint <= timePoint;
+			checkedTimePoint += TickClock::duration{1})
+	{
+		const auto index = getBucketIndex(checkedTimePoint);
+		auto& bucket = buckets_[index];
+		// software timers restarted by executed functions are added directly to the buckets, not to this list
+		SoftwareTimerUnsortedList checkedList;
+		checkedList.swap(bucket);
+
+		while (checkedList.empty() == false)
+		{
+			const auto iterator = checkedList.begin();
+			if (iterator->getTimePoint() > timePoint)	// software timer expires in one of next rounds of the wheel?
+			{
+				SoftwareTimerUnsortedList::splice(bucket.end(), iterator);
+				continue;
+			}
+
+			auto& softwareTimer = *iterator;
+			SoftwareTimerUnsortedList::erase(iterator);
+			softwareTimer.run(*this);
+		}
+
+		if (bucket.empty() == true)
+			bucketsBitmap_[index / bitsPerWord_] &= ~(1u << index % bitsPerWord_);
+	}
+}
+
+#else	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
 void SoftwareTimerSupervisor::add(SoftwareTimerControlBlock& softwareTimerControlBlock)
 {
 	activeList_.insert(softwareTimerControlBlock);
 }
 
+TickClock::time_point SoftwareTimerSupervisor::getNextTimePoint() const
+{
+	return activeList_.empty() == false ? activeList_.begin()->getTimePoint() : TickClock::time_point::max();
+}
+
 void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
 {
 	// execute all software timers that reached their time point
@@ -42,6 +120,40 @@ void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point t
 	}
 }
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t SoftwareTimerSupervisor::findMarkedBucket(const size_t begin, const size_t end) const
+{
+	for (auto index = begin; index < end; index = (index / bitsPerWord_ + 1) * bitsPerWord_)
+	{
+		// bits of buckets starting from index
+		const auto word = bucketsBitmap_[index / bitsPerWord_] >> index % bitsPerWord_;
+		if (word == 0)
+			continue;
+
+		// position of the lowest set bit
+		const auto found = index + bitsPerWord_ - 1 - architecture::countLeadingZeros(word & (~word + 1));
+		return found < end ? found : bucketsCount_;
+	}
+
+	return bucketsCount_;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private static member variables
++---------------------------------------------------------------------------------------------------------------------*/
+
+constexpr size_t SoftwareTimerSupervisor::bitsPerWord_;
+constexpr size_t SoftwareTimerSupervisor::bucketsCount_;
+
+#endif	// def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -73,7 +73,7 @@ size_t adjustSize(void* const storage, const size_t size, void* const adjustedSt
 {
 	const auto storageEnd = reinterpret_cast<uintptr_t>(storage) + size;
 	const auto adjustedStorageEnd = storageEnd / alignment * alignment;
-	return adjustedStorageEnd - reinterpret_cast<decltype(adjustedStorageEnd)>(adjustedStorage);
+	return adjustedStorageEnd - reinterpret_cast<uintptr_t>(adjustedStorage);
 }
 
 }	// namespace
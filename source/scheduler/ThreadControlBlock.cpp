@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadControlBlock class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,13 +11,16 @@
 
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
 
+#include "distortos/internal/scheduler/CpuBudgetControlBlock.hpp"
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/RunnableThread.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 #include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
 
 #include "distortos/internal/synchronization/MutexControlBlock.hpp"
+#include "distortos/internal/synchronization/SharedMutexControlBlock.hpp"
 
+#include "distortos/CpuBudget.hpp"
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/SignalsReceiver.hpp"
 
@@ -37,6 +40,12 @@ namespace
 | local objects
 +---------------------------------------------------------------------------------------------------------------------*/
 
+/// head of the list of threads waiting for update of boosted priority, linked via nextBoostedPriorityUpdate_
+ThreadControlBlock* pendingBoostedPriorityUpdates;
+
+/// true if the list of threads waiting for update of boosted priority is being processed
+bool boostedPriorityUpdateInProgress;
+
 /// next value of sequence number
 uintptr_t nextSequenceNumber;
 
@@ -53,20 +62,41 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 		SignalsReceiver* const signalsReceiver, RunnableThread& owner) :
 				ThreadListNode{priority},
 				ownedProtocolMutexList_{},
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+				cpuBudgetControlBlock_{},
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
 				stack_{std::move(stack)},
 				list_{},
 				owner_{owner},
 				priorityInheritanceMutexControlBlock_{},
+				priorityInheritanceSharedMutexControlBlock_{},
+				conditionVariableMutexControlBlock_{},
+				nextBoostedPriorityUpdate_{},
+				semaphoreRequestedValue_{},
+				eventGroupBits_{},
+				notificationValue_{},
 				signalsReceiverControlBlock_{signalsReceiver != nullptr ?
 						&signalsReceiver->signalsReceiverControlBlock_ : nullptr},
 				threadGroupControlBlock_{threadGroupControlBlock},
 				unblockFunctor_{},
 				roundRobinQuantum_{},
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+				runTime_{},
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+				deadlineMissCount_{},
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+				eventGroupWaitFlags_{},
+				notificationPending_{},
 				schedulingPolicy_{schedulingPolicy},
 				state_{ThreadState::created}
 {
+#ifdef _NEWLIB_VERSION
+
 	_REENT_INIT_PTR(&reent_);
 
+#endif	// def _NEWLIB_VERSION
+
 	const InterruptMaskingLock interruptMaskingLock;
 	sequenceNumber_ = nextSequenceNumber++;
 }
@@ -78,18 +108,39 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 		SignalsReceiver*, RunnableThread& owner) :
 				ThreadListNode{priority},
 				ownedProtocolMutexList_{},
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+				cpuBudgetControlBlock_{},
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
 				stack_{std::move(stack)},
 				list_{},
 				owner_{owner},
 				priorityInheritanceMutexControlBlock_{},
+				priorityInheritanceSharedMutexControlBlock_{},
+				conditionVariableMutexControlBlock_{},
+				nextBoostedPriorityUpdate_{},
+				semaphoreRequestedValue_{},
+				eventGroupBits_{},
+				notificationValue_{},
 				threadGroupControlBlock_{threadGroupControlBlock},
 				unblockFunctor_{},
 				roundRobinQuantum_{},
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+				runTime_{},
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+				deadlineMissCount_{},
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+				eventGroupWaitFlags_{},
+				notificationPending_{},
 				schedulingPolicy_{schedulingPolicy},
 				state_{ThreadState::created}
 {
+#ifdef _NEWLIB_VERSION
+
 	_REENT_INIT_PTR(&reent_);
 
+#endif	// def _NEWLIB_VERSION
+
 	const InterruptMaskingLock interruptMaskingLock;
 	sequenceNumber_ = nextSequenceNumber++;
 }
@@ -100,18 +151,31 @@ ThreadControlBlock::~ThreadControlBlock()
 {
 	sequenceNumber_ = ~sequenceNumber_;
 
+#ifdef _NEWLIB_VERSION
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	_reclaim_reent(&reent_);
+
+#endif	// def _NEWLIB_VERSION
 }
 
 int ThreadControlBlock::addHook()
 {
 	if (threadGroupControlBlock_ == nullptr)
 	{
-		threadGroupControlBlock_ = getScheduler().getCurrentThreadControlBlock().threadGroupControlBlock_;
+		const auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
+		threadGroupControlBlock_ = currentThreadControlBlock.threadGroupControlBlock_;
 		if (threadGroupControlBlock_ == nullptr)
 			return EINVAL;
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+		cpuBudgetControlBlock_ = currentThreadControlBlock.cpuBudgetControlBlock_;
+		if (cpuBudgetControlBlock_ != nullptr)
+			cpuBudgetControlBlock_->add(*this);
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
 	}
 
 	threadGroupControlBlock_->add(*this);
@@ -119,6 +183,75 @@ int ThreadControlBlock::addHook()
 	return 0;
 }
 
+int ThreadControlBlock::notify(const uint32_t value, const NotificationAction action)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (action == NotificationAction::setBits)
+		notificationValue_ |= value;
+	else if (action == NotificationAction::increment)
+	{
+		if (value > std::numeric_limits<decltype(notificationValue_)>::max() - notificationValue_)
+			return EOVERFLOW;
+
+		notificationValue_ += value;
+	}
+	else if (action == NotificationAction::overwrite)
+		notificationValue_ = value;
+	else if (action == NotificationAction::tryOverwrite)
+	{
+		if (notificationPending_ == true)
+			return EBUSY;
+
+		notificationValue_ = value;
+	}
+	else
+		return EINVAL;
+
+	notificationPending_ = true;
+
+	if (state_ == ThreadState::waitingForNotification)
+		getScheduler().unblock(ThreadList::iterator{*this});
+
+	return 0;
+}
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+void ThreadControlBlock::setCpuBudget(CpuBudget* const cpuBudget)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto cpuBudgetControlBlock = cpuBudget != nullptr ? &cpuBudget->cpuBudgetControlBlock_ : nullptr;
+	if (cpuBudgetControlBlock_ == cpuBudgetControlBlock)
+		return;
+
+	if (cpuBudgetControlBlock_ != nullptr)
+		cpuBudgetControlBlock_->remove(*this);
+
+	cpuBudgetControlBlock_ = cpuBudgetControlBlock;
+
+	if (cpuBudgetControlBlock_ != nullptr)
+		cpuBudgetControlBlock_->add(*this);
+}
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+int ThreadControlBlock::setDeadline(const TickClock::time_point deadline)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (schedulingPolicy_ != SchedulingPolicy::earliestDeadlineFirst)
+		return EINVAL;
+
+	changeDeadline(deadline);
+	return 0;
+}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -135,20 +268,61 @@ void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBe
 	if (previousEffectivePriority == getEffectivePriority() || threadListNode.isLinked() == false)
 		return;
 
-	reposition(loweringBefore);
+	reposition(previousEffectivePriority, loweringBefore);
+
+	const auto owner = propagateEffectivePriority();
+	if (owner != nullptr)
+		owner->updateBoostedPriority();
+}
+
+int ThreadControlBlock::setRoundRobinQuantum(const TickClock::duration length)
+{
+	if (length < TickClock::duration{} || length.count() > std::numeric_limits<RoundRobinQuantum::Representation>::max())
+		return EINVAL;
+
+	const InterruptMaskingLock interruptMaskingLock;
 
-	if (priorityInheritanceMutexControlBlock_ != nullptr)
-		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+	roundRobinQuantum_.setLength(length != TickClock::duration{} ?
+			std::chrono::duration_cast<RoundRobinQuantum::Duration>(length) : RoundRobinQuantum::getInitial());
+	return 0;
 }
 
 void ThreadControlBlock::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 {
 	const InterruptMaskingLock interruptMaskingLock;
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	// deadline is used only by threads with earliest-deadline-first scheduling policy
+	if (schedulingPolicy != SchedulingPolicy::earliestDeadlineFirst)
+		changeDeadline(TickClock::time_point::max());
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 	schedulingPolicy_ = schedulingPolicy;
 	roundRobinQuantum_.reset();
 }
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+void ThreadControlBlock::setThrottled(const bool throttled)
+{
+	const auto oldEffectivePriority = getEffectivePriority();
+	throttled_ = throttled;
+	const auto newEffectivePriority = getEffectivePriority();
+
+	if (oldEffectivePriority == newEffectivePriority || threadListNode.isLinked() == false)
+		return;
+
+	reposition(oldEffectivePriority, false);
+
+	const auto owner = propagateEffectivePriority();
+	if (owner != nullptr)
+		owner->updateBoostedPriority();
+}
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
 void ThreadControlBlock::unblockHook(const UnblockReason unblockReason)
 {
 	roundRobinQuantum_.reset();
@@ -158,43 +332,114 @@ void ThreadControlBlock::unblockHook(const UnblockReason unblockReason)
 		(*unblockFunctor)(*this, unblockReason);
 }
 
-void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
+void ThreadControlBlock::updateBoostedPriority()
 {
-	decltype(boostedPriority_) newBoostedPriority {boostedPriority};
+	if (nextBoostedPriorityUpdate_ != nullptr)	// already waiting for update?
+		return;
+
+	nextBoostedPriorityUpdate_ = pendingBoostedPriorityUpdates != nullptr ? pendingBoostedPriorityUpdates : this;
+	pendingBoostedPriorityUpdates = this;
 
-	for (const auto& mutexControlBlock : ownedProtocolMutexList_)
+	// called indirectly from the loop below? the thread will be updated by the outer call
+	if (boostedPriorityUpdateInProgress == true)
+		return;
+
+	// iteration instead of recursion - neither the length of chain of blocked threads nor the number of owners of
+	// shared mutexes affect stack usage
+	boostedPriorityUpdateInProgress = true;
+	while (pendingBoostedPriorityUpdates != nullptr)
 	{
-		const auto mutexBoostedPriority = mutexControlBlock.getBoostedPriority();
-		newBoostedPriority = std::max(newBoostedPriority, mutexBoostedPriority);
+		const auto threadControlBlock = pendingBoostedPriorityUpdates;
+		const auto next = threadControlBlock->nextBoostedPriorityUpdate_;
+		pendingBoostedPriorityUpdates = next != threadControlBlock ? next : nullptr;
+		threadControlBlock->nextBoostedPriorityUpdate_ = nullptr;
+
+		const auto owner = threadControlBlock->recalculateBoostedPriority();
+		if (owner != nullptr)
+			owner->updateBoostedPriority();
 	}
+	boostedPriorityUpdateInProgress = false;
+}
 
-	if (boostedPriority_ == newBoostedPriority)
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+void ThreadControlBlock::changeDeadline(const TickClock::time_point deadline)
+{
+	if (deadline_ == deadline)
 		return;
 
+	const auto effectivePriority = getEffectivePriority();
+	deadline_ = deadline;
+
+	if (threadListNode.isLinked() == false)
+		return;
+
+	reposition(effectivePriority, false);
+}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+ThreadControlBlock* ThreadControlBlock::propagateEffectivePriority() const
+{
+	// all readers of shared mutex may be boosted, so they are updated directly instead of returning single owner
+	if (priorityInheritanceSharedMutexControlBlock_ != nullptr)
+	{
+		priorityInheritanceSharedMutexControlBlock_->updateBoostedPriority();
+		return nullptr;
+	}
+
+	if (priorityInheritanceMutexControlBlock_ == nullptr ||
+			priorityInheritanceMutexControlBlock_->updateBoostedPriority() == false)
+		return nullptr;
+
+	return priorityInheritanceMutexControlBlock_->getOwner();
+}
+
+ThreadControlBlock* ThreadControlBlock::recalculateBoostedPriority()
+{
+	const auto newBoostedPriority = ownedProtocolMutexList_.empty() == false ?
+			ownedProtocolMutexList_.front().getBoostedPriority() : uint8_t{};
+
+	if (boostedPriority_ == newBoostedPriority)
+		return nullptr;
+
 	const auto oldEffectivePriority = getEffectivePriority();
 	boostedPriority_ = newBoostedPriority;
 	const auto newEffectivePriority = getEffectivePriority();
 
 	if (oldEffectivePriority == newEffectivePriority || threadListNode.isLinked() == false)
-		return;
+		return nullptr;
 
 	const auto loweringBefore = newEffectivePriority < oldEffectivePriority;
 
-	reposition(loweringBefore);
+	reposition(oldEffectivePriority, loweringBefore);
 
-	// this code is placed here, even though it could be moved to ThreadControlBlock::reposition(), simplifying
-	// ThreadControlBlock::setPriority(). This way optimizer can remove recursive calls to this function, reducing
-	// memory usage of threads.
-	if (priorityInheritanceMutexControlBlock_ != nullptr)
-		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+	return propagateEffectivePriority();
 }
 
-/*---------------------------------------------------------------------------------------------------------------------+
-| private functions
-+---------------------------------------------------------------------------------------------------------------------*/
-
-void ThreadControlBlock::reposition(const bool loweringBefore)
+void ThreadControlBlock::reposition(const uint8_t oldEffectivePriority, const bool loweringBefore)
 {
+#if CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+	// "runnable" list has its own bookkeeping, which needs the effective priority with which the thread was linked
+	if (state_ == ThreadState::runnable)
+	{
+		static_cast<RunnableThreadList*>(list_)->reposition(ThreadList::iterator{*this}, oldEffectivePriority,
+				loweringBefore);
+		getScheduler().maybeRequestContextSwitch();
+		return;
+	}
+
+#else	// CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE != 1
+
+	static_cast<void>(oldEffectivePriority);	// suppress warning
+
+#endif	// CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE != 1
+
 	const auto oldPriority = priority_;
 
 	if (loweringBefore == true)
@@ -203,8 +448,24 @@ void ThreadControlBlock::reposition(const bool loweringBefore)
 	list_->splice(ThreadList::iterator{*this});
 
 	if (loweringBefore == true)
+	{
 		priority_ = oldPriority;
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+		// thread is at the head of its priority level now, but threads with the same effective priority and earlier
+		// deadlines must still precede it - only this band of the list is scanned
+		auto position = ThreadList::iterator{*this};
+		++position;
+		const auto next = position;
+		while (position != list_->end() && ThreadDescendingEffectivePriority{}(*this, *position) == true)
+			++position;
+		if (position != next)
+			ThreadList::UnsortedIntrusiveList::splice(position, ThreadList::iterator{*this});
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+	}
+
 	getScheduler().maybeRequestContextSwitch();
 }
 
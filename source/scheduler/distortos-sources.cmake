@@ -8,12 +8,15 @@
 #
 
 target_sources(distortos PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/CpuBudgetControlBlock.cpp
+		${CMAKE_CURRENT_LIST_DIR}/CpuBudget.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicSoftwareTimer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/forceContextSwitch.cpp
 		${CMAKE_CURRENT_LIST_DIR}/getScheduler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/IdleThread.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MainThread.cpp
 		${CMAKE_CURRENT_LIST_DIR}/RoundRobinQuantum.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RunnableThreadList.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Scheduler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerCommon.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerControlBlock.cpp
@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,8 +11,13 @@
 
 #include "distortos/statistics.hpp"
 
+#include "distortos/internal/scheduler/getIdleThread.hpp"
 #include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/RunnableThread.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
 
 namespace distortos
 {
@@ -24,11 +29,62 @@ namespace statistics
 | global functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+void forEachThread(const ThreadFunctor& functor)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	// all threads inherit thread group of main thread
+	const auto threadGroupControlBlock =
+			internal::getScheduler().getCurrentThreadControlBlock().getThreadGroupControlBlock();
+	if (threadGroupControlBlock == nullptr)
+		return;
+
+	threadGroupControlBlock->forEach([&functor](const internal::ThreadControlBlock& threadControlBlock)
+			{
+				functor(threadControlBlock.getOwner());
+			});
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 uint64_t getContextSwitchCount()
 {
 	return internal::getScheduler().getContextSwitchCount();
 }
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+uint16_t getCpuLoad()
+{
+	uint64_t idleRunTime;
+	uint64_t totalRunTime;
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+		idleRunTime = getIdleRunTime();
+		totalRunTime = getTotalRunTime();
+	}
+
+	if (totalRunTime == 0)
+		return {};
+
+	return (totalRunTime - idleRunTime) * 1000 / totalRunTime;
+}
+
+uint64_t getIdleRunTime()
+{
+	return internal::getIdleThread().getRunTime();
+}
+
+uint64_t getTotalRunTime()
+{
+	return internal::getScheduler().getTotalRunTime();
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 }	// namespace statistics
 
 }	// namespace distortos
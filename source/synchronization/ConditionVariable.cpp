@@ -22,6 +22,53 @@
 namespace distortos
 {
 
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ConditionVariableUnblockFunctor is a functor executed when unblocking a thread that is blocked on ConditionVariable
+class ConditionVariableUnblockFunctor : public internal::UnblockFunctor
+{
+public:
+
+	/**
+	 * \brief ConditionVariableUnblockFunctor's constructor
+	 *
+	 * \param [in] mutexControlBlock is a reference to MutexControlBlock of mutex released by the thread
+	 */
+
+	constexpr explicit ConditionVariableUnblockFunctor(internal::MutexControlBlock& mutexControlBlock) :
+			mutexControlBlock_{mutexControlBlock}
+	{
+
+	}
+
+	/**
+	 * \brief ConditionVariableUnblockFunctor's function call operator
+	 *
+	 * The wait of the thread may have been moved to the mutex, so internal::MutexControlBlock::unblockHook() is called.
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock that is being unblocked
+	 * \param [in] unblockReason is the reason of thread unblocking
+	 */
+
+	void operator()(internal::ThreadControlBlock& threadControlBlock,
+			const internal::UnblockReason unblockReason) const override
+	{
+		mutexControlBlock_.unblockHook(threadControlBlock, unblockReason);
+	}
+
+private:
+
+	/// reference to MutexControlBlock of mutex released by the thread
+	internal::MutexControlBlock& mutexControlBlock_;
+};
+
+}	// namespace
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -31,7 +78,7 @@ void ConditionVariable::notifyAll()
 	const InterruptMaskingLock interruptMaskingLock;
 
 	while (blockedList_.empty() == false)
-		internal::getScheduler().unblock(blockedList_.begin());
+		notifyFirst();
 }
 
 void ConditionVariable::notifyOne()
@@ -39,11 +86,13 @@ void ConditionVariable::notifyOne()
 	const InterruptMaskingLock interruptMaskingLock;
 
 	if (blockedList_.empty() == false)
-		internal::getScheduler().unblock(blockedList_.begin());
+		notifyFirst();
 }
 
 int ConditionVariable::wait(Mutex& mutex)
 {
+	const auto& currentThreadControlBlock = internal::getScheduler().getCurrentThreadControlBlock();
+
 	{
 		const InterruptMaskingLock interruptMaskingLock;
 
@@ -51,7 +100,11 @@ int ConditionVariable::wait(Mutex& mutex)
 		if (ret != 0)
 			return ret;
 
-		internal::getScheduler().block(blockedList_, ThreadState::blockedOnConditionVariable);
+		// mutex locked recursively is still held by current thread
+		const auto released = mutex.getOwner() != &currentThreadControlBlock;
+		blockInternal(mutex, released, nullptr);
+		if (released == true && mutex.getOwner() == &currentThreadControlBlock)	// lock was handed over on notification?
+			return 0;
 	}
 
 	return mutex.lock();
@@ -64,6 +117,7 @@ int ConditionVariable::waitFor(Mutex& mutex, TickClock::duration duration)
 
 int ConditionVariable::waitUntil(Mutex& mutex, const TickClock::time_point timePoint)
 {
+	const auto& currentThreadControlBlock = internal::getScheduler().getCurrentThreadControlBlock();
 	int blockUntilRet {};
 
 	{
@@ -73,12 +127,48 @@ int ConditionVariable::waitUntil(Mutex& mutex, const TickClock::time_point timeP
 		if (ret != 0)
 			return ret;
 
-		blockUntilRet = internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnConditionVariable,
-				timePoint);
+		// mutex locked recursively is still held by current thread
+		const auto released = mutex.getOwner() != &currentThreadControlBlock;
+		blockUntilRet = blockInternal(mutex, released, &timePoint);
+		if (released == true && mutex.getOwner() == &currentThreadControlBlock)	// lock was handed over on notification?
+			return 0;
 	}
 
 	const auto ret = mutex.lock();
 	return ret != 0 ? ret : blockUntilRet != EINTR ? blockUntilRet : 0;	// don't return EINTR in case of spurious wakeup
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int ConditionVariable::blockInternal(Mutex& mutex, const bool released, const TickClock::time_point* const timePoint)
+{
+	auto& scheduler = internal::getScheduler();
+	auto& currentThreadControlBlock = scheduler.getCurrentThreadControlBlock();
+	internal::MutexControlBlock& mutexControlBlock = mutex;
+
+	currentThreadControlBlock.setConditionVariableMutexControlBlock(released == true ? &mutexControlBlock : nullptr);
+
+	const ConditionVariableUnblockFunctor unblockFunctor {mutexControlBlock};
+	const auto ret = timePoint == nullptr ?
+			scheduler.block(blockedList_, ThreadState::blockedOnConditionVariable, &unblockFunctor) :
+			scheduler.blockUntil(blockedList_, ThreadState::blockedOnConditionVariable, *timePoint, &unblockFunctor);
+
+	currentThreadControlBlock.setConditionVariableMutexControlBlock(nullptr);
+	return ret;
+}
+
+void ConditionVariable::notifyFirst()
+{
+	const auto iterator = blockedList_.begin();
+	const auto mutexControlBlock = iterator->getConditionVariableMutexControlBlock();
+
+	// waiting thread is moved to the mutex if it is locked, so it is woken only when it can get the lock
+	if (mutexControlBlock != nullptr && mutexControlBlock->requeue(iterator) == true)
+		return;
+
+	internal::getScheduler().unblock(iterator);
+}
+
 }	// namespace distortos
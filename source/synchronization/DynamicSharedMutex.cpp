@@ -0,0 +1,29 @@
+/**
+ * \file
+ * \brief DynamicSharedMutex class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/DynamicSharedMutex.hpp"
+
+#include "distortos/internal/memory/storageDeleter.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+DynamicSharedMutex::DynamicSharedMutex(const size_t maxReaders) :
+		SharedMutex{{new Storage[maxReaders], internal::storageDeleter<Storage>}, maxReaders}
+{
+
+}
+
+}	// namespace distortos
@@ -0,0 +1,152 @@
+/**
+ * \file
+ * \brief EventGroup class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/EventGroup.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+EventGroup::Bits EventGroup::clear(const Bits bits)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto previousBits = bits_;
+	bits_ &= ~bits;
+	return previousBits;
+}
+
+EventGroup::Bits EventGroup::set(const Bits bits)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto previousBits = bits_;
+	bits_ |= bits;
+
+	// unblock all waiting threads whose waits are satisfied, in priority order
+	auto iterator = blockedList_.begin();
+	while (bits_ != 0 && iterator != blockedList_.end())
+	{
+		const auto unblockedIterator = iterator++;
+		const auto awaitedBits = unblockedIterator->getEventGroupBits();
+		const auto flags = unblockedIterator->getEventGroupWaitFlags();
+		if (isSatisfied(awaitedBits, flags) == false)
+			continue;
+
+		unblockedIterator->setEventGroupBits(bits_);
+		if ((flags & clearOnExitFlag) != 0)
+			bits_ &= ~awaitedBits;
+		internal::getScheduler().unblock(unblockedIterator);
+	}
+
+	return previousBits;
+}
+
+std::pair<int, EventGroup::Bits> EventGroup::tryWaitAll(const Bits bits, const bool clearOnExit)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return tryWaitInternal(bits, waitAllFlag | (clearOnExit == true ? clearOnExitFlag : 0));
+}
+
+std::pair<int, EventGroup::Bits> EventGroup::tryWaitAllFor(const TickClock::duration duration, const Bits bits,
+		const bool clearOnExit)
+{
+	return tryWaitAllUntil(TickClock::now() + duration + TickClock::duration{1}, bits, clearOnExit);
+}
+
+std::pair<int, EventGroup::Bits> EventGroup::tryWaitAllUntil(const TickClock::time_point timePoint, const Bits bits,
+		const bool clearOnExit)
+{
+	return waitInternal(bits, waitAllFlag | (clearOnExit == true ? clearOnExitFlag : 0), &timePoint);
+}
+
+std::pair<int, EventGroup::Bits> EventGroup::tryWaitAny(const Bits bits, const bool clearOnExit)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return tryWaitInternal(bits, clearOnExit == true ? clearOnExitFlag : 0);
+}
+
+std::pair<int, EventGroup::Bits> EventGroup::tryWaitAnyFor(const TickClock::duration duration, const Bits bits,
+		const bool clearOnExit)
+{
+	return tryWaitAnyUntil(TickClock::now() + duration + TickClock::duration{1}, bits, clearOnExit);
+}
+
+std::pair<int, EventGroup::Bits> EventGroup::tryWaitAnyUntil(const TickClock::time_point timePoint, const Bits bits,
+		const bool clearOnExit)
+{
+	return waitInternal(bits, clearOnExit == true ? clearOnExitFlag : 0, &timePoint);
+}
+
+std::pair<int, EventGroup::Bits> EventGroup::waitAll(const Bits bits, const bool clearOnExit)
+{
+	return waitInternal(bits, waitAllFlag | (clearOnExit == true ? clearOnExitFlag : 0), nullptr);
+}
+
+std::pair<int, EventGroup::Bits> EventGroup::waitAny(const Bits bits, const bool clearOnExit)
+{
+	return waitInternal(bits, clearOnExit == true ? clearOnExitFlag : 0, nullptr);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, EventGroup::Bits> EventGroup::tryWaitInternal(const Bits bits, const uint8_t flags)
+{
+	if (bits == 0)
+		return {EINVAL, bits_};
+
+	if (isSatisfied(bits, flags) == false)
+		return {EAGAIN, bits_};
+
+	const auto currentBits = bits_;
+	if ((flags & clearOnExitFlag) != 0)
+		bits_ &= ~bits;
+	return {{}, currentBits};
+}
+
+std::pair<int, EventGroup::Bits> EventGroup::waitInternal(const Bits bits, const uint8_t flags,
+		const TickClock::time_point* const timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = tryWaitInternal(bits, flags);
+	if (ret.first != EAGAIN)	// wait satisfied or invalid request?
+		return ret;
+
+	auto& scheduler = internal::getScheduler();
+	auto& currentThreadControlBlock = scheduler.getCurrentThreadControlBlock();
+	currentThreadControlBlock.setEventGroupBits(bits);
+	currentThreadControlBlock.setEventGroupWaitFlags(flags);
+	const auto blockRet = timePoint == nullptr ? scheduler.block(blockedList_, ThreadState::blockedOnEventGroup) :
+			scheduler.blockUntil(blockedList_, ThreadState::blockedOnEventGroup, *timePoint);
+	if (blockRet != 0)
+		return {blockRet, bits_};
+
+	return {{}, currentThreadControlBlock.getEventGroupBits()};
+}
+
+}	// namespace distortos
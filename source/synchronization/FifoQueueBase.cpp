@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,8 @@
 
 #include "distortos/InterruptMaskingLock.hpp"
 
+#include <algorithm>
+
 namespace distortos
 {
 
@@ -25,8 +27,8 @@ namespace internal
 
 FifoQueueBase::FifoQueueBase(StorageUniquePointer&& storageUniquePointer, const size_t elementSize,
 		const size_t maxElements) :
-		popSemaphore_{0, maxElements},
-		pushSemaphore_{maxElements, maxElements},
+		popSemaphore_{0, static_cast<Semaphore::Value>(maxElements)},
+		pushSemaphore_{static_cast<Semaphore::Value>(maxElements), static_cast<Semaphore::Value>(maxElements)},
 		storageUniquePointer_{std::move(storageUniquePointer)},
 		storageEnd_{static_cast<uint8_t*>(storageUniquePointer_.get()) + elementSize * maxElements},
 		readPosition_{storageUniquePointer_.get()},
@@ -63,6 +65,46 @@ int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const Q
 	return postSemaphore.post();
 }
 
+std::pair<int, size_t> FifoQueueBase::popPushN(const SemaphoreFunctor& waitSemaphoreFunctor,
+		const QueueBlockFunctor& functor, const size_t count, Semaphore& waitSemaphore, Semaphore& postSemaphore,
+		void*& storage)
+{
+	if (count == 0)
+		return {};
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	{
+		const auto ret = waitSemaphoreFunctor(waitSemaphore);
+		if (ret != 0)
+			return {ret, {}};
+	}
+
+	// first element is already reserved, remaining ones are reserved only if this is possible without blocking - with
+	// masked interrupts this cannot fail
+	const auto additional = std::min<size_t>(count - 1, waitSemaphore.getValue());
+	waitSemaphore.tryWaitN(additional);
+	const size_t reserved {1 + additional};
+
+	// at most two contiguous blocks - before and after wrap-around
+	const auto elementsToEnd =
+			(static_cast<const uint8_t*>(storageEnd_) - static_cast<const uint8_t*>(storage)) / elementSize_;
+	const auto firstBlock = std::min(reserved, elementsToEnd);
+	functor(storage, firstBlock);
+	storage = firstBlock != elementsToEnd ? static_cast<uint8_t*>(storage) + firstBlock * elementSize_ :
+			storageUniquePointer_.get();
+
+	const auto secondBlock = reserved - firstBlock;
+	if (secondBlock != 0)
+	{
+		functor(storage, secondBlock);
+		storage = static_cast<uint8_t*>(storage) + secondBlock * elementSize_;
+	}
+
+	const auto ret = postSemaphore.postN(reserved);
+	return {ret, reserved};
+}
+
 }	// namespace internal
 
 }	// namespace distortos
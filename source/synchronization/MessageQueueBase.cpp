@@ -134,8 +134,8 @@ private:
 
 MessageQueueBase::MessageQueueBase(EntryStorageUniquePointer&& entryStorageUniquePointer,
 		ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements) :
-		popSemaphore_{0, maxElements},
-		pushSemaphore_{maxElements, maxElements},
+		popSemaphore_{0, static_cast<Semaphore::Value>(maxElements)},
+		pushSemaphore_{static_cast<Semaphore::Value>(maxElements), static_cast<Semaphore::Value>(maxElements)},
 		entryStorageUniquePointer_{std::move(entryStorageUniquePointer)},
 		valueStorageUniquePointer_{std::move(valueStorageUniquePointer)},
 		entryList_{},
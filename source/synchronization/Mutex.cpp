@@ -29,18 +29,36 @@ namespace distortos
 
 int Mutex::lock()
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryLockExclusive() == true)	// fast path for unlocked mutex with Protocol::none
+		return 0;
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
 	// break the loop when one of following conditions is true:
 	// - lock successful, recursive lock not possible or deadlock detected;
 	// - lock transferred successfully;
-	while ((ret = tryLockInternal()) == EBUSY && (ret = doBlock()) == EINTR);
+	while ((ret = tryLockInternal()) == EBUSY && isRetryRequired(ret = doBlock()) == true);
 	return ret;
 }
 
 int Mutex::tryLock()
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryLockExclusive() == true)	// fast path for unlocked mutex with Protocol::none
+		return 0;
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	const InterruptMaskingLock interruptMaskingLock;
 	const auto ret = tryLockInternal();
 	return ret != EDEADLK ? ret : EBUSY;
@@ -53,6 +71,15 @@ int Mutex::tryLockFor(const TickClock::duration duration)
 
 int Mutex::tryLockUntil(const TickClock::time_point timePoint)
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryLockExclusive() == true)	// fast path for unlocked mutex with Protocol::none
+		return 0;
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
@@ -60,7 +87,7 @@ int Mutex::tryLockUntil(const TickClock::time_point timePoint)
 	// - lock successful, recursive lock not possible or deadlock detected;
 	// - lock transferred successfully;
 	// - timeout expired;
-	while ((ret = tryLockInternal()) == EBUSY && (ret = doBlockUntil(timePoint)) == EINTR);
+	while ((ret = tryLockInternal()) == EBUSY && isRetryRequired(ret = doBlockUntil(timePoint)) == true);
 	return ret;
 }
 
@@ -68,6 +95,13 @@ int Mutex::unlock()
 {
 	CHECK_FUNCTION_CONTEXT();
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	if (tryUnlockExclusive() == true)	// fast path for mutex with Protocol::none and no waiting threads
+		return 0;
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	if (getType() != Type::normal)
@@ -91,6 +125,15 @@ int Mutex::unlock()
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+bool Mutex::isRetryRequired(const int blockRet) const
+{
+	if (blockRet == EINTR)
+		return true;
+
+	// in Mode::competitive the thread is unblocked without becoming the owner of the mutex
+	return blockRet == 0 && getOwner() != &internal::getScheduler().getCurrentThreadControlBlock();
+}
+
 int Mutex::tryLockInternal()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -14,6 +14,14 @@
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#include "distortos/architecture/exclusiveAccess.hpp"
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#include <algorithm>
+
 namespace distortos
 {
 
@@ -39,7 +47,7 @@ public:
 	 * \param [in] mutexControlBlock is a reference to MutexControlBlock that blocked the thread
 	 */
 
-	constexpr explicit PriorityInheritanceMutexControlBlockUnblockFunctor(const MutexControlBlock& mutexControlBlock) :
+	constexpr explicit PriorityInheritanceMutexControlBlockUnblockFunctor(MutexControlBlock& mutexControlBlock) :
 			mutexControlBlock_{mutexControlBlock}
 	{
 
@@ -48,8 +56,7 @@ public:
 	/**
 	 * \brief PriorityInheritanceMutexControlBlockUnblockFunctor's function call operator
 	 *
-	 * If the wait for mutex was interrupted, requests update of boosted priority of current owner of the mutex. Pointer
-	 * to MutexControlBlock with priorityInheritance protocol which caused the thread to block is reset to nullptr.
+	 * Calls MutexControlBlock::unblockHook().
 	 *
 	 * \param [in] threadControlBlock is a reference to ThreadControlBlock that is being unblocked
 	 * \param [in] unblockReason is the reason of thread unblocking
@@ -57,19 +64,13 @@ public:
 
 	void operator()(ThreadControlBlock& threadControlBlock, const UnblockReason unblockReason) const override
 	{
-		const auto owner = mutexControlBlock_.getOwner();
-
-		// waiting for mutex was interrupted and some thread still holds it?
-		if (unblockReason != UnblockReason::unblockRequest && owner != nullptr)
-			owner->updateBoostedPriority();
-
-		threadControlBlock.setPriorityInheritanceMutexControlBlock(nullptr);
+		mutexControlBlock_.unblockHook(threadControlBlock, unblockReason);
 	}
 
 private:
 
 	/// reference to MutexControlBlock that blocked the thread
-	const MutexControlBlock& mutexControlBlock_;
+	MutexControlBlock& mutexControlBlock_;
 };
 
 }	// namespace
@@ -78,19 +79,78 @@ private:
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-uint8_t MutexControlBlock::getBoostedPriority() const
+bool MutexControlBlock::requeue(const ThreadList::iterator iterator)
 {
-	if (getProtocol() == Protocol::priorityInheritance)
+	// lock handed over with priorityProtect protocol boosts the new owner above the releasing thread, so each transfer
+	// would cause additional preemption instead of preventing one
+	if (getProtocol() == Protocol::priorityProtect)
+		return false;
+
+	auto& threadControlBlock = *iterator;
+
+	if (getOwner() == nullptr)
 	{
-		if (blockedList_.empty() == true)
-			return 0;
-		return blockedList_.front().getEffectivePriority();
+		owner_ = &threadControlBlock;
+
+		if (getProtocol() != Protocol::priorityInheritance)
+			return false;
+
+		getOwner()->getOwnedProtocolMutexList().insert(*this);
+
+		// in Mode::competitive threads may still be blocked on unlocked mutex with priorityInheritance protocol
+		if (blockedList_.empty() == false)
+			getOwner()->updateBoostedPriority();
+
+		return false;
 	}
 
-	if (getProtocol() == Protocol::priorityProtect)
-		return getPriorityCeiling();
+	if (getScheduler().requeue(blockedList_, iterator, ThreadState::blockedOnMutex) != 0)
+		return false;
+
+	if (getProtocol() != Protocol::priorityInheritance)
+		return true;
+
+	threadControlBlock.setPriorityInheritanceMutexControlBlock(this);
+
+	// thread is already on the blocked list, so its effective priority is taken into account
+	if (updateBoostedPriority() == true)
+		getOwner()->updateBoostedPriority();
+
+	return true;
+}
+
+void MutexControlBlock::unblockHook(ThreadControlBlock& threadControlBlock, const UnblockReason unblockReason)
+{
+	if (getProtocol() != Protocol::priorityInheritance)
+		return;
+
+	threadControlBlock.setPriorityInheritanceMutexControlBlock(nullptr);
+
+	// waiting for mutex was interrupted? thread is already removed from the blocked list of the mutex
+	if (unblockReason == UnblockReason::unblockRequest || updateBoostedPriority() == false)
+		return;
+
+	const auto owner = getOwner();
+	if (owner != nullptr)	// some thread still holds the mutex?
+		owner->updateBoostedPriority();
+}
+
+bool MutexControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
+{
+	if (getProtocol() != Protocol::priorityInheritance)
+		return false;
 
-	return 0;
+	const auto newBoostedPriority = blockedList_.empty() == false ?
+			std::max(boostedPriority, blockedList_.front().getEffectivePriority()) : boostedPriority;
+	if (boostedPriority_ == newBoostedPriority)
+		return false;
+
+	boostedPriority_ = newBoostedPriority;
+
+	if (node.isLinked() == true)	// keep the list of mutexes owned by the owner sorted
+		getOwner()->getOwnedProtocolMutexList().splice(MutexList::iterator{*this});
+
+	return true;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -123,9 +183,10 @@ void MutexControlBlock::doLock()
 	if (getProtocol() == Protocol::none)
 		return;
 
-	getOwner()->getOwnedProtocolMutexList().push_front(*this);
+	getOwner()->getOwnedProtocolMutexList().insert(*this);
 
-	if (getProtocol() == Protocol::priorityProtect)
+	// in Mode::competitive threads may still be blocked on unlocked mutex with priorityInheritance protocol
+	if (getProtocol() == Protocol::priorityProtect || blockedList_.empty() == false)
 		getOwner()->updateBoostedPriority();
 }
 
@@ -133,10 +194,12 @@ void MutexControlBlock::doUnlockOrTransferLock()
 {
 	auto& oldOwner = *getOwner();
 
-	if (blockedList_.empty() == false)
+	if (blockedList_.empty() == true)
+		doUnlock();
+	else if (getMode() == Mode::handoff)
 		doTransferLock();
 	else
-		doUnlock();
+		doUnlockAndUnblock();
 
 	if (getProtocol() == Protocol::none)
 		return;
@@ -149,11 +212,55 @@ void MutexControlBlock::doUnlockOrTransferLock()
 	getOwner()->updateBoostedPriority();
 }
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+bool MutexControlBlock::tryLockExclusive()
+{
+	if (getProtocol() != Protocol::none)
+		return false;
+
+	const auto currentThreadControlBlock = &getScheduler().getCurrentThreadControlBlock();
+	while (1)
+	{
+		if (architecture::loadExclusive(owner_) != nullptr)	// mutex is locked?
+		{
+			architecture::clearExclusive();
+			return false;
+		}
+
+		if (architecture::storeExclusive(owner_, currentThreadControlBlock) == true)
+			return true;
+	}
+}
+
+bool MutexControlBlock::tryUnlockExclusive()
+{
+	// recursive locks count may be modified only by the owner, so it can be safely checked before exclusive access
+	if (getProtocol() != Protocol::none || recursiveLocksCount_ != 0)
+		return false;
+
+	const auto currentThreadControlBlock = &getScheduler().getCurrentThreadControlBlock();
+	while (1)
+	{
+		// mutex is not locked by current thread or lock must be transferred to one of waiting threads?
+		if (architecture::loadExclusive(owner_) != currentThreadControlBlock || blockedList_.empty() == false)
+		{
+			architecture::clearExclusive();
+			return false;
+		}
+
+		if (architecture::storeExclusive<ThreadControlBlock*>(owner_, nullptr) == true)
+			return true;
+	}
+}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-void MutexControlBlock::beforeBlock() const
+void MutexControlBlock::beforeBlock()
 {
 	if (getProtocol() != Protocol::priorityInheritance)
 		return;
@@ -163,7 +270,8 @@ void MutexControlBlock::beforeBlock() const
 	currentThreadControlBlock.setPriorityInheritanceMutexControlBlock(this);
 
 	// calling thread is not yet on the blocked list, that's why it's effective priority is given explicitly
-	getOwner()->updateBoostedPriority(currentThreadControlBlock.getEffectivePriority());
+	if (updateBoostedPriority(currentThreadControlBlock.getEffectivePriority()) == true)
+		getOwner()->updateBoostedPriority();
 }
 
 void MutexControlBlock::doTransferLock()
@@ -174,7 +282,11 @@ void MutexControlBlock::doTransferLock()
 	if (node.isLinked() == false)
 		return;
 
-	MutexList::splice(getOwner()->getOwnedProtocolMutexList().begin(), MutexList::iterator{*this});
+	// new owner is no longer blocked on this mutex, so its "boosted priority" must be updated before the mutex is
+	// inserted into the sorted list of the new owner
+	node.unlink();
+	updateBoostedPriority();
+	getOwner()->getOwnedProtocolMutexList().insert(*this);
 
 	if (getProtocol() == Protocol::priorityInheritance)
 		getOwner()->setPriorityInheritanceMutexControlBlock(nullptr);
@@ -190,6 +302,15 @@ void MutexControlBlock::doUnlock()
 	node.unlink();
 }
 
+void MutexControlBlock::doUnlockAndUnblock()
+{
+	doUnlock();
+	getScheduler().unblock(blockedList_.begin());
+
+	// unblocked thread is no longer on the list, so "boosted priority" must be updated before the mutex is locked again
+	updateBoostedPriority();
+}
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -11,6 +11,7 @@
 
 #include "distortos/RawFifoQueue.hpp"
 
+#include "distortos/internal/synchronization/BoundQueueBlockFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPopQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPushQueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
@@ -45,6 +46,14 @@ int RawFifoQueue::pop(void* const buffer, const size_t size)
 	return popInternal(semaphoreWaitFunctor, buffer, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::popN(void* const buffer, const size_t size, const size_t count)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popNInternal(semaphoreWaitFunctor, buffer, size, count);
+}
+
 int RawFifoQueue::push(const void* const data, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -53,6 +62,14 @@ int RawFifoQueue::push(const void* const data, const size_t size)
 	return pushInternal(semaphoreWaitFunctor, data, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::pushN(const void* const data, const size_t size, const size_t count)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return pushNInternal(semaphoreWaitFunctor, data, size, count);
+}
+
 int RawFifoQueue::tryPop(void* const buffer, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
@@ -67,6 +84,30 @@ int RawFifoQueue::tryPopFor(const TickClock::duration duration, void* const buff
 	return popInternal(semaphoreTryWaitForFunctor, buffer, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::tryPopN(void* const buffer, const size_t size, const size_t count)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popNInternal(semaphoreTryWaitFunctor, buffer, size, count);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPopNFor(const TickClock::duration duration, void* const buffer,
+		const size_t size, const size_t count)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return popNInternal(semaphoreTryWaitForFunctor, buffer, size, count);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPopNUntil(const TickClock::time_point timePoint, void* const buffer,
+		const size_t size, const size_t count)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popNInternal(semaphoreTryWaitUntilFunctor, buffer, size, count);
+}
+
 int RawFifoQueue::tryPopUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -89,6 +130,30 @@ int RawFifoQueue::tryPushFor(const TickClock::duration duration, const void* con
 	return pushInternal(semaphoreTryWaitForFunctor, data, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::tryPushN(const void* const data, const size_t size, const size_t count)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return pushNInternal(semaphoreTryWaitFunctor, data, size, count);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPushNFor(const TickClock::duration duration, const void* const data,
+		const size_t size, const size_t count)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return pushNInternal(semaphoreTryWaitForFunctor, data, size, count);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPushNUntil(const TickClock::time_point timePoint, const void* const data,
+		const size_t size, const size_t count)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return pushNInternal(semaphoreTryWaitUntilFunctor, data, size, count);
+}
+
 int RawFifoQueue::tryPushUntil(const TickClock::time_point timePoint, const void* const data, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -111,6 +176,24 @@ int RawFifoQueue::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFun
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, memcpyPopQueueFunctor);
 }
 
+std::pair<int, size_t> RawFifoQueue::popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		void* const buffer, const size_t size, const size_t count)
+{
+	if (size != fifoQueueBase_.getElementSize())
+		return {EMSGSIZE, {}};
+
+	auto destination = static_cast<uint8_t*>(buffer);
+	const auto memcpyPopQueueBlockFunctor = internal::makeBoundQueueBlockFunctor(
+			[&destination, size](void* const storage, const size_t blockCount)
+			{
+				const auto blockSize = blockCount * size;
+				const internal::MemcpyPopQueueFunctor memcpyPopQueueFunctor {destination, blockSize};
+				memcpyPopQueueFunctor(storage);
+				destination += blockSize;
+			});
+	return fifoQueueBase_.popN(waitSemaphoreFunctor, memcpyPopQueueBlockFunctor, count);
+}
+
 int RawFifoQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* const data,
 		const size_t size)
 {
@@ -121,4 +204,22 @@ int RawFifoQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, memcpyPushQueueFunctor);
 }
 
+std::pair<int, size_t> RawFifoQueue::pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const void* const data, const size_t size, const size_t count)
+{
+	if (size != fifoQueueBase_.getElementSize())
+		return {EMSGSIZE, {}};
+
+	auto source = static_cast<const uint8_t*>(data);
+	const auto memcpyPushQueueBlockFunctor = internal::makeBoundQueueBlockFunctor(
+			[&source, size](void* const storage, const size_t blockCount)
+			{
+				const auto blockSize = blockCount * size;
+				const internal::MemcpyPushQueueFunctor memcpyPushQueueFunctor {source, blockSize};
+				memcpyPushQueueFunctor(storage);
+				source += blockSize;
+			});
+	return fifoQueueBase_.pushN(waitSemaphoreFunctor, memcpyPushQueueBlockFunctor, count);
+}
+
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,10 +14,18 @@
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#include "distortos/internal/synchronization/WaitSetControlBlock.hpp"
+
 #include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
 
 #include "distortos/InterruptMaskingLock.hpp"
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#include "distortos/architecture/exclusiveAccess.hpp"
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 #include <cerrno>
 
 namespace distortos
@@ -29,71 +37,185 @@ namespace distortos
 
 int Semaphore::post()
 {
+	return postN(1);
+}
+
+int Semaphore::postN(const Value value)
+{
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	// fast path - if there are no waiting threads and no wait set, the value may be increased without masking
+	// interrupts
+	while (1)
+	{
+		const auto oldValue = architecture::loadExclusive(value_);
+		if (blockedList_.empty() == false || waitSetControlBlock_ != nullptr)
+		{
+			architecture::clearExclusive();
+			break;
+		}
+
+		if (value > maxValue_ - oldValue)
+		{
+			architecture::clearExclusive();
+			return EOVERFLOW;
+		}
+
+		if (architecture::storeExclusive(value_, oldValue + value) == true)
+			return 0;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	const InterruptMaskingLock interruptMaskingLock;
 
-	if (value_ == maxValue_)
+	if (value > maxValue_ - value_)
 		return EOVERFLOW;
 
-	if (blockedList_.empty() == false)
+	value_ += value;
+
+	// unblock all waiting threads whose requests can be satisfied, in priority order
+	auto iterator = blockedList_.begin();
+	while (value_ != 0 && iterator != blockedList_.end())
 	{
-		internal::getScheduler().unblock(blockedList_.begin());
-		return 0;
+		const auto unblockedIterator = iterator++;
+		const auto requestedValue = unblockedIterator->getSemaphoreRequestedValue();
+		if (requestedValue > value_)
+			continue;
+
+		value_ -= requestedValue;
+		internal::getScheduler().unblock(unblockedIterator);
 	}
 
-	++value_;
+	// units not consumed by waiting threads make the semaphore "ready" for the wait set
+	if (value_ != 0 && waitSetControlBlock_ != nullptr)
+		waitSetControlBlock_->notify();
 
 	return 0;
 }
 
 int Semaphore::tryWait()
 {
-	const InterruptMaskingLock interruptMaskingLock;
-	return tryWaitInternal();
+	return tryWaitN(1);
 }
 
 int Semaphore::tryWaitFor(const TickClock::duration duration)
 {
-	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1});
+	return tryWaitNFor(duration, 1);
 }
 
-int Semaphore::tryWaitUntil(const TickClock::time_point timePoint)
+int Semaphore::tryWaitN(const Value value)
+{
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+	return tryWaitInternal(value);
+#else	// !def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+	const InterruptMaskingLock interruptMaskingLock;
+	return tryWaitInternal(value);
+#endif	// !def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+}
+
+int Semaphore::tryWaitNFor(const TickClock::duration duration, const Value value)
+{
+	return tryWaitNUntil(TickClock::now() + duration + TickClock::duration{1}, value);
+}
+
+int Semaphore::tryWaitNUntil(const TickClock::time_point timePoint, const Value value)
 {
 	CHECK_FUNCTION_CONTEXT();
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	{
+		// fast path - try to decrease the value without masking interrupts
+		const auto ret = tryWaitInternal(value);
+		if (ret != EAGAIN)	// lock successful or invalid request?
+			return ret;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	const InterruptMaskingLock interruptMaskingLock;
 
-	const auto ret = tryWaitInternal();
-	if (ret != EAGAIN)	// lock successful?
+	const auto ret = tryWaitInternal(value);
+	if (ret != EAGAIN)	// lock successful or invalid request?
 		return ret;
 
-	return internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnSemaphore, timePoint);
+	auto& scheduler = internal::getScheduler();
+	scheduler.getCurrentThreadControlBlock().setSemaphoreRequestedValue(value);
+	return scheduler.blockUntil(blockedList_, ThreadState::blockedOnSemaphore, timePoint);
+}
+
+int Semaphore::tryWaitUntil(const TickClock::time_point timePoint)
+{
+	return tryWaitNUntil(timePoint, 1);
 }
 
 int Semaphore::wait()
+{
+	return waitN(1);
+}
+
+int Semaphore::waitN(const Value value)
 {
 	CHECK_FUNCTION_CONTEXT();
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	{
+		// fast path - try to decrease the value without masking interrupts
+		const auto ret = tryWaitInternal(value);
+		if (ret != EAGAIN)	// lock successful or invalid request?
+			return ret;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	const InterruptMaskingLock interruptMaskingLock;
 
-	const auto ret = tryWaitInternal();
-	if (ret != EAGAIN)	// lock successful?
+	const auto ret = tryWaitInternal(value);
+	if (ret != EAGAIN)	// lock successful or invalid request?
 		return ret;
 
-	return internal::getScheduler().block(blockedList_, ThreadState::blockedOnSemaphore);
+	auto& scheduler = internal::getScheduler();
+	scheduler.getCurrentThreadControlBlock().setSemaphoreRequestedValue(value);
+	return scheduler.block(blockedList_, ThreadState::blockedOnSemaphore);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-int Semaphore::tryWaitInternal()
+int Semaphore::tryWaitInternal(const Value value)
 {
-	if (value_ == 0)	// lock not possible?
+	// request impossible to satisfy? single unit is always valid, semaphore with max value 0 is just permanently locked
+	if (value > 1 && value > maxValue_)
+		return EINVAL;
+
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	while (1)
+	{
+		const auto oldValue = architecture::loadExclusive(value_);
+		if (oldValue < value)	// lock not possible?
+		{
+			architecture::clearExclusive();
+			return EAGAIN;
+		}
+
+		if (architecture::storeExclusive(value_, oldValue - value) == true)
+			return 0;
+	}
+
+#else	// !def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	if (value_ < value)	// lock not possible?
 		return EAGAIN;
 
-	--value_;
+	value_ -= value;
 
 	return 0;
+
+#endif	// !def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
 }
 
 }	// namespace distortos
@@ -0,0 +1,110 @@
+/**
+ * \file
+ * \brief SharedMutex class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/SharedMutex.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+SharedMutex::SharedMutex(StorageUniquePointer&& storageUniquePointer, const size_t maxReaders) :
+		SharedMutexControlBlock{std::move(storageUniquePointer), maxReaders}
+{
+
+}
+
+SharedMutex::~SharedMutex()
+{
+
+}
+
+int SharedMutex::lock()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return lockImplementation(false, false, nullptr);	// exclusive, blocking mode, no timeout
+}
+
+int SharedMutex::lockShared()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return lockImplementation(true, false, nullptr);	// shared, blocking mode, no timeout
+}
+
+int SharedMutex::tryLock()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return lockImplementation(false, true, nullptr);	// exclusive, non-blocking mode
+}
+
+int SharedMutex::tryLockFor(const TickClock::duration duration)
+{
+	return tryLockUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+int SharedMutex::tryLockShared()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return lockImplementation(true, true, nullptr);	// shared, non-blocking mode
+}
+
+int SharedMutex::tryLockSharedFor(const TickClock::duration duration)
+{
+	return tryLockSharedUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+int SharedMutex::tryLockSharedUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return lockImplementation(true, false, &timePoint);	// shared, blocking mode, with timeout
+}
+
+int SharedMutex::tryLockUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return lockImplementation(false, false, &timePoint);	// exclusive, blocking mode, with timeout
+}
+
+int SharedMutex::unlock()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return unlockImplementation(false);
+}
+
+int SharedMutex::unlockShared()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+	return unlockImplementation(true);
+}
+
+}	// namespace distortos
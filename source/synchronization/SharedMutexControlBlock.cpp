@@ -0,0 +1,272 @@
+/**
+ * \file
+ * \brief SharedMutexControlBlock class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/SharedMutexControlBlock.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include <algorithm>
+#include <new>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// SharedMutexControlBlockUnblockFunctor is a functor executed when unblocking a thread that is blocked on a shared
+/// mutex
+class SharedMutexControlBlockUnblockFunctor : public UnblockFunctor
+{
+public:
+
+	/**
+	 * \brief SharedMutexControlBlockUnblockFunctor's constructor
+	 *
+	 * \param [in] sharedMutexControlBlock is a reference to SharedMutexControlBlock that blocked the thread
+	 */
+
+	constexpr explicit SharedMutexControlBlockUnblockFunctor(SharedMutexControlBlock& sharedMutexControlBlock) :
+			sharedMutexControlBlock_{sharedMutexControlBlock}
+	{
+
+	}
+
+	/**
+	 * \brief SharedMutexControlBlockUnblockFunctor's function call operator
+	 *
+	 * Calls SharedMutexControlBlock::unblockHook().
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock that is being unblocked
+	 * \param [in] unblockReason is the reason of thread unblocking
+	 */
+
+	void operator()(ThreadControlBlock& threadControlBlock, const UnblockReason unblockReason) const override
+	{
+		sharedMutexControlBlock_.unblockHook(threadControlBlock, unblockReason);
+	}
+
+private:
+
+	/// reference to SharedMutexControlBlock that blocked the thread
+	SharedMutexControlBlock& sharedMutexControlBlock_;
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+SharedMutexControlBlock::SharedMutexControlBlock(StorageUniquePointer&& storageUniquePointer,
+		const size_t storageSize) :
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		readersBlockedList_{},
+		writersBlockedList_{},
+		ownersEnd_{reinterpret_cast<Owner*>(&storageUniquePointer_[storageSize])},
+		ownersCount_{},
+		boostedPriority_{},
+		writeLocked_{}
+{
+	for (auto owner = getOwnersBegin(); owner != ownersEnd_; ++owner)
+		new (owner) Owner;
+}
+
+SharedMutexControlBlock::~SharedMutexControlBlock()
+{
+	for (auto owner = getOwnersBegin(); owner != ownersEnd_; ++owner)
+		owner->~Owner();
+}
+
+void SharedMutexControlBlock::unblockHook(ThreadControlBlock& threadControlBlock, const UnblockReason unblockReason)
+{
+	threadControlBlock.setPriorityInheritanceSharedMutexControlBlock(nullptr);
+
+	// waiting for shared mutex was interrupted? thread is already removed from the blocked list of the shared mutex
+	if (unblockReason == UnblockReason::unblockRequest)
+		return;
+
+	updateBoostedPriority();
+}
+
+bool SharedMutexControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
+{
+	auto newBoostedPriority = boostedPriority;
+	if (readersBlockedList_.empty() == false)
+		newBoostedPriority = std::max(newBoostedPriority, readersBlockedList_.front().getEffectivePriority());
+	if (writersBlockedList_.empty() == false)
+		newBoostedPriority = std::max(newBoostedPriority, writersBlockedList_.front().getEffectivePriority());
+
+	if (boostedPriority_ == newBoostedPriority)
+		return false;
+
+	boostedPriority_ = newBoostedPriority;
+
+	for (auto owner = getOwnersBegin(); owner != ownersEnd_; ++owner)
+	{
+		const auto threadControlBlock = owner->getThreadControlBlock();
+		if (threadControlBlock == nullptr)
+			continue;
+
+		owner->setBoostedPriority(newBoostedPriority);
+		// keep the list of mutexes owned by the owner sorted
+		threadControlBlock->getOwnedProtocolMutexList().splice(MutexList::iterator{*owner});
+		threadControlBlock->updateBoostedPriority();
+	}
+
+	return true;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| protected functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int SharedMutexControlBlock::lockImplementation(const bool shared, const bool nonBlocking,
+		const TickClock::time_point* const timePoint)
+{
+	auto& scheduler = getScheduler();
+	auto& currentThreadControlBlock = scheduler.getCurrentThreadControlBlock();
+	auto& blockedList = shared == true ? readersBlockedList_ : writersBlockedList_;
+	const SharedMutexControlBlockUnblockFunctor unblockFunctor {*this};
+
+	int ret;
+	while ((ret = tryLockInternal(shared)) == EBUSY)
+	{
+		if (nonBlocking == true)
+			return ret;
+
+		currentThreadControlBlock.setPriorityInheritanceSharedMutexControlBlock(this);
+		// calling thread is not yet on the blocked list, that's why it's effective priority is given explicitly
+		updateBoostedPriority(currentThreadControlBlock.getEffectivePriority());
+
+		ret = timePoint == nullptr ? scheduler.block(blockedList, ThreadState::blockedOnSharedMutex, &unblockFunctor) :
+				scheduler.blockUntil(blockedList, ThreadState::blockedOnSharedMutex, *timePoint, &unblockFunctor);
+		if (ret == 0)	// lock was handed over to current thread
+			return ret;
+
+		// readers which were blocked only because of this writer may acquire the lock now
+		if (shared == false)
+			transferLocks();
+
+		if (ret != EINTR)
+			return ret;
+	}
+
+	return nonBlocking == false || ret != EDEADLK ? ret : EBUSY;
+}
+
+int SharedMutexControlBlock::unlockImplementation(const bool shared)
+{
+	const auto owner = findOwner(&getScheduler().getCurrentThreadControlBlock());
+	if (owner == nullptr || writeLocked_ == shared)
+		return EPERM;
+
+	release(*owner);
+	writeLocked_ = false;
+	transferLocks();
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SharedMutexControlBlock::acquire(Owner& owner, ThreadControlBlock& threadControlBlock)
+{
+	owner.setThreadControlBlock(&threadControlBlock);
+	owner.setBoostedPriority(boostedPriority_);
+	threadControlBlock.getOwnedProtocolMutexList().insert(owner);
+	++ownersCount_;
+	threadControlBlock.updateBoostedPriority();
+}
+
+SharedMutexControlBlock::Owner* SharedMutexControlBlock::findOwner(const ThreadControlBlock* const threadControlBlock)
+		const
+{
+	const auto owner = std::find_if(getOwnersBegin(), ownersEnd_,
+			[threadControlBlock](const Owner& element) -> bool
+			{
+				return element.getThreadControlBlock() == threadControlBlock;
+			});
+	return owner != ownersEnd_ ? owner : nullptr;
+}
+
+int SharedMutexControlBlock::tryLockInternal(const bool shared)
+{
+	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
+	if (findOwner(&currentThreadControlBlock) != nullptr)
+		return EDEADLK;
+
+	const auto owner = findOwner(nullptr);
+	// writers are preferred - new readers are blocked if any writer is waiting
+	if (shared == true ? writeLocked_ == true || writersBlockedList_.empty() == false || owner == nullptr :
+			ownersCount_ != 0)
+		return EBUSY;
+
+	acquire(*owner, currentThreadControlBlock);
+	writeLocked_ = shared == false;
+	return 0;
+}
+
+void SharedMutexControlBlock::release(Owner& owner)
+{
+	const auto threadControlBlock = owner.getThreadControlBlock();
+	owner.node.unlink();
+	owner.setThreadControlBlock(nullptr);
+	--ownersCount_;
+	threadControlBlock->updateBoostedPriority();
+}
+
+void SharedMutexControlBlock::transferLocks()
+{
+	if (writeLocked_ == true)
+		return;
+
+	auto& scheduler = getScheduler();
+
+	if (writersBlockedList_.empty() == false)
+	{
+		if (ownersCount_ != 0)	// writer must wait until all readers release the shared mutex
+			return;
+
+		auto& threadControlBlock = writersBlockedList_.front();
+		scheduler.unblock(writersBlockedList_.begin());
+		acquire(*findOwner(nullptr), threadControlBlock);
+		writeLocked_ = true;
+	}
+	else
+	{
+		Owner* owner;
+		while (readersBlockedList_.empty() == false && (owner = findOwner(nullptr)) != nullptr)
+		{
+			auto& threadControlBlock = readersBlockedList_.front();
+			scheduler.unblock(readersBlockedList_.begin());
+			acquire(*owner, threadControlBlock);
+		}
+	}
+
+	// threads which acquired the lock are no longer blocked on the shared mutex
+	updateBoostedPriority();
+}
+
+}	// namespace internal
+
+}	// namespace distortos
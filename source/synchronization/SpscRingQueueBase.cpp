@@ -0,0 +1,192 @@
+/**
+ * \file
+ * \brief SpscRingQueueBase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/SpscRingQueueBase.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+SpscRingQueueBase::SpscRingQueueBase(StorageUniquePointer&& storageUniquePointer, const size_t elementSize,
+		const size_t maxElements) :
+		notificationSemaphore_{0, 1},
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		capacity_{maxElements & positionMask_},
+		elementSize_{elementSize},
+		readPosition_{0},
+		writePosition_{0},
+		consumerWaiting_{false}
+{
+
+}
+
+SpscRingQueueBase::~SpscRingQueueBase()
+{
+
+}
+
+std::pair<const void*, size_t> SpscRingQueueBase::getReadBlock() const
+{
+	const auto readPosition = readPosition_.load(std::memory_order_relaxed);
+	const auto writePosition = writePosition_.load(std::memory_order_acquire);
+	if (isEmpty(readPosition, writePosition) == true)
+		return {storageUniquePointer_.get(), {}};
+
+	return getBlock(readPosition, writePosition);
+}
+
+size_t SpscRingQueueBase::getSize() const
+{
+	const auto readPosition = readPosition_.load(std::memory_order_relaxed);
+	const auto writePosition = writePosition_.load(std::memory_order_relaxed);
+	if (isEmpty(readPosition, writePosition) == true)
+		return 0;
+	if (isFull(readPosition, writePosition) == true)
+		return capacity_;
+	const auto maskedReadPosition = readPosition & positionMask_;
+	const auto maskedWritePosition = writePosition & positionMask_;
+	return maskedWritePosition > maskedReadPosition ? maskedWritePosition - maskedReadPosition :
+			capacity_ - maskedReadPosition + maskedWritePosition;
+}
+
+std::pair<void*, size_t> SpscRingQueueBase::getWriteBlock() const
+{
+	const auto readPosition = readPosition_.load(std::memory_order_acquire);
+	const auto writePosition = writePosition_.load(std::memory_order_relaxed);
+	if (isFull(readPosition, writePosition) == true)
+		return {storageUniquePointer_.get(), {}};
+
+	return getBlock(writePosition, readPosition);
+}
+
+void SpscRingQueueBase::increaseReadPosition(const size_t value)
+{
+	if (value == 0)
+		return;
+
+	readPosition_.store(increasePosition(readPosition_.load(std::memory_order_relaxed), value),
+			std::memory_order_release);
+}
+
+void SpscRingQueueBase::increaseWritePosition(const size_t value)
+{
+	if (value == 0)
+		return;
+
+	// sequentially consistent store and load - either the producer sees the flag set by the consumer or the consumer
+	// sees new write position before blocking
+	writePosition_.store(increasePosition(writePosition_.load(std::memory_order_relaxed), value));
+	if (consumerWaiting_.load() == true)
+		notificationSemaphore_.post();	// EOVERFLOW is not an error here - consumer is already notified
+}
+
+size_t SpscRingQueueBase::pop(void* const buffer, const size_t count)
+{
+	auto destination = static_cast<uint8_t*>(buffer);
+	size_t popped {};
+
+	// at most two chunks - before and after wrap-around
+	for (size_t chunk {}; chunk < 2 && popped < count; ++chunk)
+	{
+		const auto readBlock = getReadBlock();
+		const auto chunkSize = std::min(readBlock.second, count - popped);
+		if (chunkSize == 0)
+			break;
+
+		const auto chunkSizeBytes = chunkSize * elementSize_;
+		memcpy(destination, readBlock.first, chunkSizeBytes);
+		destination += chunkSizeBytes;
+		popped += chunkSize;
+		increaseReadPosition(chunkSize);
+	}
+
+	return popped;
+}
+
+size_t SpscRingQueueBase::push(const void* const data, const size_t count)
+{
+	auto source = static_cast<const uint8_t*>(data);
+	size_t pushed {};
+
+	// at most two chunks - before and after wrap-around
+	for (size_t chunk {}; chunk < 2 && pushed < count; ++chunk)
+	{
+		const auto writeBlock = getWriteBlock();
+		const auto chunkSize = std::min(writeBlock.second, count - pushed);
+		if (chunkSize == 0)
+			break;
+
+		const auto chunkSizeBytes = chunkSize * elementSize_;
+		memcpy(writeBlock.first, source, chunkSizeBytes);
+		source += chunkSizeBytes;
+		pushed += chunkSize;
+		increaseWritePosition(chunkSize);
+	}
+
+	return pushed;
+}
+
+int SpscRingQueueBase::wait(const SemaphoreFunctor& waitSemaphoreFunctor)
+{
+	while (isEmpty(readPosition_.load(std::memory_order_relaxed), writePosition_.load()) == true)
+	{
+		consumerWaiting_.store(true);
+
+		// check again - the producer may have pushed something before it could see the flag
+		if (isEmpty(readPosition_.load(std::memory_order_relaxed), writePosition_.load()) == false)
+		{
+			consumerWaiting_.store(false);
+			break;
+		}
+
+		// notification semaphore may be posted by the producer after previous wait was finished, so the loop is
+		// needed to filter such stale notifications
+		const auto ret = waitSemaphoreFunctor(notificationSemaphore_);
+		consumerWaiting_.store(false);
+		if (ret != 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<uint8_t*, size_t> SpscRingQueueBase::getBlock(const size_t begin, const size_t end) const
+{
+	const auto maskedBegin = begin & positionMask_;
+	const auto maskedEnd = end & positionMask_;
+	return {static_cast<uint8_t*>(storageUniquePointer_.get()) + maskedBegin * elementSize_,
+			(maskedEnd > maskedBegin ? maskedEnd : capacity_) - maskedBegin};
+}
+
+size_t SpscRingQueueBase::increasePosition(const size_t position, const size_t value) const
+{
+	const auto maskedPosition = position & positionMask_;
+	const auto msb = position & msbMask_;
+	// in case of wrap-around MSB is inverted and position is 0
+	return maskedPosition + value != capacity_ ? msb | (maskedPosition + value) : msb ^ msbMask_;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
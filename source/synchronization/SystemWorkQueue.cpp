@@ -0,0 +1,89 @@
+/**
+ * \file
+ * \brief System work queue definition, its worker threads and their low-level initializer
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/getSystemWorkQueue.hpp"
+
+#ifdef CONFIG_SYSTEM_WORK_QUEUE_ENABLE
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/StaticThread.hpp"
+#include "distortos/WorkQueue.hpp"
+
+namespace distortos
+{
+
+namespace
+{
+
+void systemWorkQueueThreadFunction();
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of system work queue's worker thread
+using SystemWorkQueueThread = decltype(makeStaticThread<CONFIG_SYSTEM_WORK_QUEUE_THREAD_STACK_SIZE>(
+		CONFIG_SYSTEM_WORK_QUEUE_THREAD_PRIORITY, systemWorkQueueThreadFunction));
+
+/// storage for system work queue instance
+std::aligned_storage<sizeof(WorkQueue), alignof(WorkQueue)>::type systemWorkQueueStorage;
+
+/// storage for system work queue's worker thread instances
+std::aligned_storage<sizeof(SystemWorkQueueThread), alignof(SystemWorkQueueThread)>::type
+		systemWorkQueueThreadsStorage[CONFIG_SYSTEM_WORK_QUEUE_THREADS];
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief System work queue's worker thread function
+ */
+
+void systemWorkQueueThreadFunction()
+{
+	getSystemWorkQueue().process();
+}
+
+/**
+ * \brief Low-level initializer of system work queue and its worker threads
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER().
+ */
+
+void systemWorkQueueLowLevelInitializer()
+{
+	new (&systemWorkQueueStorage) WorkQueue;
+
+	for (auto& systemWorkQueueThreadStorage : systemWorkQueueThreadsStorage)
+	{
+		auto& systemWorkQueueThread = *new (&systemWorkQueueThreadStorage) SystemWorkQueueThread
+				{CONFIG_SYSTEM_WORK_QUEUE_THREAD_PRIORITY, systemWorkQueueThreadFunction};
+		systemWorkQueueThread.start();
+	}
+}
+
+BIND_LOW_LEVEL_INITIALIZER(80, systemWorkQueueLowLevelInitializer);
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+WorkQueue& getSystemWorkQueue()
+{
+	return reinterpret_cast<WorkQueue&>(systemWorkQueueStorage);
+}
+
+}	// namespace distortos
+
+#endif	// def CONFIG_SYSTEM_WORK_QUEUE_ENABLE
@@ -0,0 +1,161 @@
+/**
+ * \file
+ * \brief WaitSet class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/WaitSet.hpp"
+
+#include "distortos/devices/communication/SerialPort.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/RawFifoQueue.hpp"
+#include "distortos/RawMessageQueue.hpp"
+
+#include "estd/ScopeGuard.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| WaitSet::Entry public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+WaitSet::Entry::Entry(RawFifoQueue& rawFifoQueue, const Event event) :
+		Entry{event == Event::readable ? rawFifoQueue.fifoQueueBase_.getPopSemaphore() :
+				rawFifoQueue.fifoQueueBase_.getPushSemaphore()}
+{
+
+}
+
+WaitSet::Entry::Entry(RawMessageQueue& rawMessageQueue, const Event event) :
+		Entry{event == Event::readable ? rawMessageQueue.messageQueueBase_.getPopSemaphore() :
+				rawMessageQueue.messageQueueBase_.getPushSemaphore()}
+{
+
+}
+
+WaitSet::Entry::Entry(devices::SerialPort& serialPort) :
+		semaphore_{},
+		serialPort_{&serialPort},
+		ready_{}
+{
+
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, size_t> WaitSet::tryWait()
+{
+	return waitImplementation(true, nullptr);
+}
+
+std::pair<int, size_t> WaitSet::tryWaitFor(const TickClock::duration duration)
+{
+	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+std::pair<int, size_t> WaitSet::tryWaitUntil(const TickClock::time_point timePoint)
+{
+	return waitImplementation(false, &timePoint);
+}
+
+std::pair<int, size_t> WaitSet::wait()
+{
+	return waitImplementation(false, nullptr);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t WaitSet::updateReadiness()
+{
+	size_t readyEntries {};
+	for (auto entry = entries_; entry != entries_ + entriesCount_; ++entry)
+	{
+		entry->ready_ = entry->semaphore_ != nullptr ? entry->semaphore_->getValue() != 0 :
+				entry->serialPort_->isReadable();
+		if (entry->ready_ == true)
+			++readyEntries;
+	}
+	return readyEntries;
+}
+
+std::pair<int, size_t> WaitSet::waitImplementation(const bool nonBlocking, const TickClock::time_point* const timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const auto entriesEnd = entries_ + entriesCount_;
+
+	// all serial ports post this semaphore when they receive data, so only this one semaphore needs to notify the wait
+	// set on their behalf
+	Semaphore serialPortsSemaphore {0};
+	auto serialPortsEnd = entries_;
+	const auto serialPortsScopeGuard = estd::makeScopeGuard(
+			[this, &serialPortsEnd]()
+			{
+				for (auto entry = entries_; entry != serialPortsEnd; ++entry)
+					if (entry->serialPort_ != nullptr)
+						entry->serialPort_->stopReadNotification();
+			});
+
+	for (; serialPortsEnd != entriesEnd; ++serialPortsEnd)
+		if (serialPortsEnd->serialPort_ != nullptr)
+		{
+			const auto ret = serialPortsEnd->serialPort_->startReadNotification(serialPortsSemaphore);
+			if (ret != 0)
+				return {ret, {}};
+		}
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	auto semaphoresEnd = entries_;
+	const auto semaphoresScopeGuard = estd::makeScopeGuard(
+			[this, &semaphoresEnd, &serialPortsSemaphore]()
+			{
+				serialPortsSemaphore.waitSetControlBlock_ = {};
+				for (auto entry = entries_; entry != semaphoresEnd; ++entry)
+					if (entry->semaphore_ != nullptr)
+						entry->semaphore_->waitSetControlBlock_ = {};
+			});
+
+	serialPortsSemaphore.waitSetControlBlock_ = this;
+	for (; semaphoresEnd != entriesEnd; ++semaphoresEnd)
+		if (semaphoresEnd->semaphore_ != nullptr)
+		{
+			auto& waitSetControlBlock = semaphoresEnd->semaphore_->waitSetControlBlock_;
+			// the same semaphore may appear in multiple entries of this wait set, but not in another wait set
+			if (waitSetControlBlock != nullptr && waitSetControlBlock != this)
+				return {EBUSY, {}};
+
+			waitSetControlBlock = this;
+		}
+
+	while (1)
+	{
+		const auto readyEntries = updateReadiness();
+		if (readyEntries != 0)
+			return {{}, readyEntries};
+
+		if (nonBlocking == true)
+			return {EAGAIN, {}};
+
+		const auto ret = block(timePoint);
+		if (ret != 0)
+			return {ret, {}};
+	}
+}
+
+}	// namespace distortos
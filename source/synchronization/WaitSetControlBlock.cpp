@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief WaitSetControlBlock class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/WaitSetControlBlock.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int WaitSetControlBlock::block(const TickClock::time_point* const timePoint)
+{
+	auto& scheduler = getScheduler();
+	return timePoint == nullptr ? scheduler.block(blockedList_, ThreadState::blockedOnWaitSet) :
+			scheduler.blockUntil(blockedList_, ThreadState::blockedOnWaitSet, *timePoint);
+}
+
+void WaitSetControlBlock::notify()
+{
+	if (blockedList_.empty() == false)
+		getScheduler().unblock(blockedList_.begin());
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief WorkItem class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/WorkItem.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/WorkQueue.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+WorkItem::~WorkItem()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (workQueue_ != nullptr)
+		workQueue_->cancel(*this);
+}
+
+WorkItem::WorkItem(WorkItem&& other) :
+		node_{},
+		workQueue_{}
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	node_.swap(other.node_);
+	workQueue_ = other.workQueue_;
+	other.workQueue_ = {};
+}
+
+bool WorkItem::isPending() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return workQueue_ != nullptr;
+}
+
+}	// namespace distortos
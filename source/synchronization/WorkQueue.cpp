@@ -0,0 +1,126 @@
+/**
+ * \file
+ * \brief WorkQueue class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/WorkQueue.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+WorkQueue::~WorkQueue()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	while (list_.empty() == false)
+	{
+		list_.front().workQueue_ = {};
+		list_.pop_front();
+	}
+}
+
+int WorkQueue::cancel(WorkItem& workItem)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (workItem.workQueue_ != this)
+		return EINVAL;
+
+	List::erase(List::iterator{workItem});
+	workItem.workQueue_ = {};
+	// value of semaphore may be already consumed by a worker thread which didn't remove the work item yet
+	semaphore_.tryWait();
+	return 0;
+}
+
+void WorkQueue::process()
+{
+	while (1)
+		processOne();
+}
+
+int WorkQueue::processOne()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	while (1)
+	{
+		const auto ret = semaphore_.wait();
+		if (ret != 0)
+			return ret;
+
+		// work item may have been cancelled after the semaphore was posted
+		if (executeFirst() == 0)
+			return 0;
+	}
+}
+
+int WorkQueue::submit(WorkItem& workItem)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (workItem.workQueue_ != nullptr)
+		return EBUSY;
+
+	const auto ret = semaphore_.post();
+	if (ret != 0)
+		return ret;
+
+	list_.push_back(workItem);
+	workItem.workQueue_ = this;
+	return 0;
+}
+
+int WorkQueue::tryProcessOne()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	{
+		const auto ret = semaphore_.tryWait();
+		if (ret != 0)
+			return ret;
+	}
+
+	return executeFirst();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int WorkQueue::executeFirst()
+{
+	WorkItem* workItem;
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		if (list_.empty() == true)
+			return EAGAIN;
+
+		workItem = &list_.front();
+		list_.pop_front();
+		workItem->workQueue_ = {};
+	}
+
+	workItem->run();
+	return 0;
+}
+
+}	// namespace distortos
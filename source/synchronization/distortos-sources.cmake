@@ -11,7 +11,9 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ConditionVariable.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicRawFifoQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicRawMessageQueue.cpp
+		${CMAKE_CURRENT_LIST_DIR}/DynamicSharedMutex.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicSignalsReceiver.cpp
+		${CMAKE_CURRENT_LIST_DIR}/EventGroup.cpp
 		${CMAKE_CURRENT_LIST_DIR}/FifoQueueBase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MemcpyPopQueueFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MemcpyPushQueueFunctor.cpp
@@ -25,8 +27,16 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/SemaphoreTryWaitFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SemaphoreTryWaitUntilFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SemaphoreWaitFunctor.cpp
+		${CMAKE_CURRENT_LIST_DIR}/SharedMutexControlBlock.cpp
+		${CMAKE_CURRENT_LIST_DIR}/SharedMutex.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SignalInformationQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SignalsCatcherControlBlock.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SignalSet.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SignalsReceiverControlBlock.cpp
-		${CMAKE_CURRENT_LIST_DIR}/ThisThread-Signals.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/SpscRingQueueBase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/SystemWorkQueue.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThisThread-Signals.cpp
+		${CMAKE_CURRENT_LIST_DIR}/WaitSetControlBlock.cpp
+		${CMAKE_CURRENT_LIST_DIR}/WaitSet.cpp
+		${CMAKE_CURRENT_LIST_DIR}/WorkItem.cpp
+		${CMAKE_CURRENT_LIST_DIR}/WorkQueue.cpp)
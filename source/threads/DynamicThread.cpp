@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThread class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -72,6 +72,20 @@ int DynamicThread::generateSignal(const uint8_t signalNumber)
 
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+uint32_t DynamicThread::getDeadlineMissCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getDeadlineMissCount();
+}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 uint8_t DynamicThread::getEffectivePriority() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -116,6 +130,30 @@ uint8_t DynamicThread::getPriority() const
 	return detachableThread_->getPriority();
 }
 
+TickClock::duration DynamicThread::getRoundRobinQuantum() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getRoundRobinQuantum();
+}
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+uint64_t DynamicThread::getRunTime() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getRunTime();
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 SchedulingPolicy DynamicThread::getSchedulingPolicy() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -168,6 +206,16 @@ int DynamicThread::join()
 	return detachableThread_->join();
 }
 
+int DynamicThread::notify(const uint32_t value, const NotificationAction action)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return EINVAL;
+
+	return detachableThread_->notify(value, action);
+}
+
 #if CONFIG_SIGNALS_ENABLE == 1
 
 int DynamicThread::queueSignal(const uint8_t signalNumber, const sigval value)
@@ -192,6 +240,16 @@ void DynamicThread::setPriority(const uint8_t priority, const bool alwaysBehind)
 	detachableThread_->setPriority(priority, alwaysBehind);
 }
 
+int DynamicThread::setRoundRobinQuantum(const TickClock::duration length)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return EINVAL;
+
+	return detachableThread_->setRoundRobinQuantum(length);
+}
+
 void DynamicThread::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 {
 	const InterruptMaskingLock interruptMaskingLock;
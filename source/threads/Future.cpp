@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief FutureBase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/Future.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int FutureBase::tryWaitFor(const TickClock::duration duration)
+{
+	const auto ret = semaphore_.tryWaitFor(duration);
+	if (ret != 0)
+		return ret;
+
+	// result stays ready for other waiters
+	semaphore_.post();
+	return 0;
+}
+
+int FutureBase::tryWaitUntil(const TickClock::time_point timePoint)
+{
+	const auto ret = semaphore_.tryWaitUntil(timePoint);
+	if (ret != 0)
+		return ret;
+
+	// result stays ready for other waiters
+	semaphore_.post();
+	return 0;
+}
+
+int FutureBase::wait()
+{
+	const auto ret = semaphore_.wait();
+	if (ret != 0)
+		return ret;
+
+	// result stays ready for other waiters
+	semaphore_.post();
+	return 0;
+}
+
+}	// namespace distortos
@@ -0,0 +1,149 @@
+/**
+ * \file
+ * \brief ThisThread::Notifications namespace implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/ThisThread-Notifications.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace ThisThread
+{
+
+namespace Notifications
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Implementation of all take and wait functions from distortos::ThisThread::Notifications.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] take selects whether notification value is used as a counter (true - take functions) or as a set of bits
+ * (false - wait functions)
+ * \param [in] clearOnEntry are the bits of notification value which will be cleared if no notification is pending,
+ * used only if \a take is false
+ * \param [in] clearOnExit are the bits of notification value which will be cleared when notification is received, if
+ * \a take is true, then any non-zero value clears notification value and 0 decrements it
+ * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode (true)
+ * \param [in] timePoint is a pointer to time point at which the wait will be terminated, used only if blocking mode is
+ * selected, nullptr to block without timeout
+ *
+ * \return pair with return code (0 on success, error code otherwise) and notification value before it was modified on
+ * exit (or current notification value if return code is not 0); error codes:
+ * - EAGAIN - notification was not available and non-blocking mode was selected;
+ * - error codes returned by internal::Scheduler::block() (for blocking mode without timeout) /
+ * internal::Scheduler::blockUntil() (for blocking mode with timeout);
+ */
+
+std::pair<int, uint32_t> waitImplementation(const bool take, const uint32_t clearOnEntry, const uint32_t clearOnExit,
+		const bool nonBlocking, const TickClock::time_point* const timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	auto& scheduler = internal::getScheduler();
+	auto& currentThreadControlBlock = scheduler.getCurrentThreadControlBlock();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (take == false && currentThreadControlBlock.isNotificationPending() == false)
+		currentThreadControlBlock.setNotificationValue(currentThreadControlBlock.getNotificationValue() & ~clearOnEntry);
+
+	// each notification unblocks the thread, but in take mode notification value may still be 0
+	while (take == true ? currentThreadControlBlock.getNotificationValue() == 0 :
+			currentThreadControlBlock.isNotificationPending() == false)
+	{
+		if (nonBlocking == true)
+			return {EAGAIN, currentThreadControlBlock.getNotificationValue()};
+
+		internal::ThreadList waitingList;
+		const auto ret = timePoint == nullptr ? scheduler.block(waitingList, ThreadState::waitingForNotification) :
+				scheduler.blockUntil(waitingList, ThreadState::waitingForNotification, *timePoint);
+		if (ret != 0)
+			return {ret, currentThreadControlBlock.getNotificationValue()};
+	}
+
+	const auto value = currentThreadControlBlock.getNotificationValue();
+	if (take == false)
+		currentThreadControlBlock.setNotificationValue(value & ~clearOnExit);
+	else
+		currentThreadControlBlock.setNotificationValue(clearOnExit != 0 ? 0 : value - 1);
+	currentThreadControlBlock.setNotificationPending(false);
+	return {{}, value};
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, uint32_t> take(const bool clearOnExit)
+{
+	return waitImplementation(true, {}, clearOnExit, false, nullptr);	// blocking mode, no timeout
+}
+
+std::pair<int, uint32_t> tryTake(const bool clearOnExit)
+{
+	return waitImplementation(true, {}, clearOnExit, true, nullptr);	// non-blocking mode
+}
+
+std::pair<int, uint32_t> tryTakeFor(const TickClock::duration duration, const bool clearOnExit)
+{
+	return tryTakeUntil(TickClock::now() + duration + TickClock::duration{1}, clearOnExit);
+}
+
+std::pair<int, uint32_t> tryTakeUntil(const TickClock::time_point timePoint, const bool clearOnExit)
+{
+	return waitImplementation(true, {}, clearOnExit, false, &timePoint);	// blocking mode, with timeout
+}
+
+std::pair<int, uint32_t> tryWait(const uint32_t clearOnEntry, const uint32_t clearOnExit)
+{
+	return waitImplementation(false, clearOnEntry, clearOnExit, true, nullptr);	// non-blocking mode
+}
+
+std::pair<int, uint32_t> tryWaitFor(const TickClock::duration duration, const uint32_t clearOnEntry,
+		const uint32_t clearOnExit)
+{
+	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1}, clearOnEntry, clearOnExit);
+}
+
+std::pair<int, uint32_t> tryWaitUntil(const TickClock::time_point timePoint, const uint32_t clearOnEntry,
+		const uint32_t clearOnExit)
+{
+	return waitImplementation(false, clearOnEntry, clearOnExit, false, &timePoint);	// blocking mode, with timeout
+}
+
+std::pair<int, uint32_t> wait(const uint32_t clearOnEntry, const uint32_t clearOnExit)
+{
+	return waitImplementation(false, clearOnEntry, clearOnExit, false, nullptr);	// blocking mode, no timeout
+}
+
+}	// namespace Notifications
+
+}	// namespace ThisThread
+
+}	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief ThisThread namespace implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,7 @@
 
 #include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
 
+#include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/ThreadIdentifier.hpp"
 
 #include <cerrno>
@@ -55,6 +56,24 @@ Thread& get()
 	return internal::getScheduler().getCurrentThreadControlBlock().getOwner();
 }
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+TickClock::time_point getDeadline()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().getDeadline();
+}
+
+uint32_t getDeadlineMissCount()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().getDeadlineMissCount();
+}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 uint8_t getEffectivePriority()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -77,6 +96,13 @@ uint8_t getPriority()
 	return internal::getScheduler().getCurrentThreadControlBlock().getPriority();
 }
 
+TickClock::duration getRoundRobinQuantum()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().getRoundRobinQuantum().getLength();
+}
+
 SchedulingPolicy getSchedulingPolicy()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -94,6 +120,28 @@ size_t getStackSize()
 	return get().getStackSize();
 }
 
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+void setCpuBudget(CpuBudget* const cpuBudget)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	internal::getScheduler().getCurrentThreadControlBlock().setCpuBudget(cpuBudget);
+}
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+int setDeadline(const TickClock::time_point deadline)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().setDeadline(deadline);
+}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 void setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -101,6 +149,13 @@ void setPriority(const uint8_t priority, const bool alwaysBehind)
 	internal::getScheduler().getCurrentThreadControlBlock().setPriority(priority, alwaysBehind);
 }
 
+int setRoundRobinQuantum(const TickClock::duration length)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().setRoundRobinQuantum(length);
+}
+
 void setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -121,6 +176,30 @@ int sleepUntil(const TickClock::time_point timePoint)
 	return ret == ETIMEDOUT ? 0 : ret;
 }
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+int waitForNextPeriod(const TickClock::duration period)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	auto& threadControlBlock = internal::getScheduler().getCurrentThreadControlBlock();
+	if (threadControlBlock.getSchedulingPolicy() != SchedulingPolicy::earliestDeadlineFirst)
+		return EINVAL;
+
+	const auto now = TickClock::now();
+	const auto deadline = threadControlBlock.getDeadline();
+	const auto nextPeriodStart = deadline != TickClock::time_point::max() ? deadline : now;
+	if (now > deadline)
+		threadControlBlock.incrementDeadlineMissCount();
+
+	threadControlBlock.setDeadline(nextPeriodStart + period);
+	return sleepUntil(nextPeriodStart);
+}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 void yield()
 {
 	CHECK_FUNCTION_CONTEXT();
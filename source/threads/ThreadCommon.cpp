@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadCommon class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -61,6 +61,16 @@ int ThreadCommon::generateSignal(const uint8_t signalNumber)
 
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+uint32_t ThreadCommon::getDeadlineMissCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return getThreadControlBlock().getDeadlineMissCount();
+}
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
 uint8_t ThreadCommon::getEffectivePriority() const
 {
 	return getThreadControlBlock().getEffectivePriority();
@@ -91,6 +101,21 @@ uint8_t ThreadCommon::getPriority() const
 	return getThreadControlBlock().getPriority();
 }
 
+TickClock::duration ThreadCommon::getRoundRobinQuantum() const
+{
+	return getThreadControlBlock().getRoundRobinQuantum().getLength();
+}
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+uint64_t ThreadCommon::getRunTime() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return getThreadControlBlock().getRunTime();
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 SchedulingPolicy ThreadCommon::getSchedulingPolicy() const
 {
 	return getThreadControlBlock().getSchedulingPolicy();
@@ -123,6 +148,11 @@ int ThreadCommon::join()
 	return ret;
 }
 
+int ThreadCommon::notify(const uint32_t value, const NotificationAction action)
+{
+	return getThreadControlBlock().notify(value, action);
+}
+
 #if CONFIG_SIGNALS_ENABLE == 1
 
 int ThreadCommon::queueSignal(const uint8_t signalNumber, const sigval value)
@@ -142,6 +172,11 @@ void ThreadCommon::setPriority(const uint8_t priority, const bool alwaysBehind)
 	getThreadControlBlock().setPriority(priority, alwaysBehind);
 }
 
+int ThreadCommon::setRoundRobinQuantum(const TickClock::duration length)
+{
+	return getThreadControlBlock().setRoundRobinQuantum(length);
+}
+
 void ThreadCommon::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 {
 	getThreadControlBlock().setSchedulingPolicy(schedulingPolicy);
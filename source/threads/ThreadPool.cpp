@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \brief ThreadPool class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/ThreadPool.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+ThreadPool::ThreadPool(const size_t threadsCount, const size_t queueSize, const DynamicThreadParameters& parameters) :
+		queue_{queueSize},
+		threadsStorage_{new ThreadStorage[threadsCount]},
+		threadsCount_{threadsCount}
+{
+	for (size_t i {}; i < threadsCount_; ++i)
+	{
+		auto& thread = *new (&threadsStorage_[i]) DynamicThread{parameters, &ThreadPool::worker, this};
+		const auto ret = thread.start();
+		assert(ret == 0 && "Could not start worker thread of thread pool!");
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	for (size_t i {}; i < threadsCount_; ++i)
+		while (queue_.push(nullptr) != 0);
+
+	for (size_t i {}; i < threadsCount_; ++i)
+	{
+		auto& thread = getThread(i);
+		thread.join();
+		thread.~DynamicThread();
+	}
+}
+
+int ThreadPool::submit(Job& job)
+{
+	job.prepare();
+	return queue_.push(&job);
+}
+
+int ThreadPool::trySubmit(Job& job)
+{
+	job.prepare();
+	return queue_.tryPush(&job);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ThreadPool::worker()
+{
+	while (1)
+	{
+		Job* job;
+		if (queue_.pop(job) != 0)
+			continue;
+
+		if (job == nullptr)
+			return;
+
+		job->execute();
+	}
+}
+
+}	// namespace distortos
@@ -10,10 +10,14 @@
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/DynamicThreadBase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicThread.cpp
+		${CMAKE_CURRENT_LIST_DIR}/Future.cpp
+		${CMAKE_CURRENT_LIST_DIR}/Job.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThisThread.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThisThread-Notifications.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadCommon.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Thread.cpp
 		${CMAKE_CURRENT_LIST_DIR}/threadExiter.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadIdentifier.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadPool.cpp
 		${CMAKE_CURRENT_LIST_DIR}/threadRunner.cpp
 		${CMAKE_CURRENT_LIST_DIR}/UndetachableThread.cpp)
@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariableOperationsTestCase class implementation
  *
- * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -21,6 +21,7 @@
 #include "distortos/StaticSoftwareTimer.hpp"
 #include "distortos/statistics.hpp"
 
+#include <array>
 #include <cerrno>
 
 namespace distortos
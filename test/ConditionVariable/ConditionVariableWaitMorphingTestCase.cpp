@@ -0,0 +1,293 @@
+/**
+ * \file
+ * \brief ConditionVariableWaitMorphingTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ConditionVariableWaitMorphingTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+#include "SequenceAsserter.hpp"
+
+#include "distortos/ConditionVariable.hpp"
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// number of test threads in phase1()
+constexpr size_t totalThreads {3};
+
+/// duration used in tests of timeouts
+constexpr TickClock::duration waitDuration {11};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests notifyAll() with locked mutex.
+ *
+ * Notified threads are moved to the mutex without being woken, so notifyAll() causes no context switches. With
+ * priorityInheritance protocol the priority of the notifying thread is boosted by the moved threads. After the mutex is
+ * unlocked, the threads get the lock in priority order.
+ *
+ * \param [in] protocol is the protocol of mutex used in the test
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase1(const Mutex::Protocol protocol)
+{
+	SequenceAsserter sequenceAsserter;
+	ConditionVariable conditionVariable;
+	Mutex mutex {protocol};
+	int results[totalThreads] {-1, -1, -1};
+	const auto priority = ThisThread::getPriority();
+
+	const auto function = [&sequenceAsserter, &conditionVariable, &mutex, &results](const unsigned int sequencePoint)
+			{
+				mutex.lock();
+				results[sequencePoint] = conditionVariable.wait(mutex);
+				sequenceAsserter.sequencePoint(sequencePoint);
+				mutex.unlock();
+			};
+
+	auto thread0 = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 3)}, function, 0);
+	auto thread1 = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 1)}, function, 2);
+	auto thread2 = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 2)}, function, 1);
+
+	bool result {true};
+
+	mutex.lock();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	conditionVariable.notifyAll();
+	if (statistics::getContextSwitchCount() != contextSwitchCount)
+		result = false;
+
+	if (thread0.getState() != ThreadState::blockedOnMutex || thread1.getState() != ThreadState::blockedOnMutex ||
+			thread2.getState() != ThreadState::blockedOnMutex)
+		result = false;
+
+	const auto expectedEffectivePriority = protocol == Mutex::Protocol::priorityInheritance ? priority + 3 : priority;
+	if (ThisThread::getEffectivePriority() != expectedEffectivePriority)
+		result = false;
+
+	mutex.unlock();
+
+	if (ThisThread::getEffectivePriority() != priority || sequenceAsserter.assertSequence(totalThreads) == false)
+		result = false;
+
+	thread0.join();
+	thread1.join();
+	thread2.join();
+
+	for (const auto ret : results)
+		if (ret != 0)
+			result = false;
+
+	return result;
+}
+
+/**
+ * \brief Tests notifyOne() with unlocked mutex.
+ *
+ * Notified thread gets the lock before it is woken, so it runs only once.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	ConditionVariable conditionVariable;
+	Mutex mutex {Mutex::Protocol::priorityInheritance};
+	int ret {-1};
+	auto thread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(ThisThread::getPriority() + 1)},
+			[&conditionVariable, &mutex, &ret]()
+			{
+				mutex.lock();
+				ret = conditionVariable.wait(mutex);
+				mutex.unlock();
+			});
+
+	// 2 context switches: "into" the test thread and "back" to main thread when test thread terminates
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	conditionVariable.notifyOne();
+	const bool result = ret == 0 && statistics::getContextSwitchCount() - contextSwitchCount == 2;
+
+	thread.join();
+
+	return result;
+}
+
+/**
+ * \brief Tests timeout of thread moved to the mutex with priorityInheritance protocol.
+ *
+ * After timeout the priority of notifying thread is no longer boosted, but the thread which timed out blocks on the
+ * mutex again, as it must lock it before returning.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	ConditionVariable conditionVariable;
+	Mutex mutex {Mutex::Protocol::priorityInheritance};
+	int ret {-1};
+	const auto priority = ThisThread::getPriority();
+	auto thread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 1)},
+			[&conditionVariable, &mutex, &ret]()
+			{
+				mutex.lock();
+				ret = conditionVariable.waitFor(mutex, waitDuration);
+				mutex.unlock();
+			});
+
+	bool result {true};
+
+	mutex.lock();
+	conditionVariable.notifyOne();
+	if (thread.getState() != ThreadState::blockedOnMutex || ThisThread::getEffectivePriority() != priority + 1)
+		result = false;
+
+	// timeout removes the thread from the mutex - boosted priority is dropped, but then the thread blocks on the mutex
+	// again before this thread is resumed
+	ThisThread::sleepFor(waitDuration * 2);
+	if (thread.getState() != ThreadState::blockedOnMutex || ret != -1 ||
+			ThisThread::getEffectivePriority() != priority + 1)
+		result = false;
+
+	mutex.unlock();
+
+	if (ret != ETIMEDOUT || ThisThread::getEffectivePriority() != priority)
+		result = false;
+
+	thread.join();
+
+	return result;
+}
+
+/**
+ * \brief Tests notifyOne() with unlocked mutex with priorityInheritance protocol in Mode::competitive.
+ *
+ * Current thread unlocks the mutex on which two threads with lower priorities are blocked. Only the one with higher
+ * priority is unblocked, the other one stays blocked on the unlocked mutex. Notified thread with the lowest priority
+ * gets the lock, so it must be boosted by the thread which is still blocked on the mutex.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	ConditionVariable conditionVariable;
+	Mutex mutex {Mutex::Protocol::priorityInheritance, {}, Mutex::Mode::competitive};
+	int results[3] {-1, -1, -1};
+	const auto priority = ThisThread::getPriority();
+
+	auto waitingThread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority - 3)},
+			[&conditionVariable, &mutex, &results]()
+			{
+				mutex.lock();
+				results[0] = conditionVariable.wait(mutex);
+				mutex.unlock();
+			});
+
+	ThisThread::sleepFor({});	// let the test thread block on the condition variable
+
+	mutex.lock();
+
+	const auto function = [&mutex, &results](const size_t index)
+			{
+				results[index] = mutex.lock();
+				mutex.unlock();
+			};
+
+	auto lowerThread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority - 2)}, function,
+			1);
+	auto higherThread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority - 1)}, function,
+			2);
+
+	ThisThread::sleepFor({});	// let the test threads block on the mutex
+
+	bool result {true};
+
+	if (waitingThread.getState() != ThreadState::blockedOnConditionVariable ||
+			lowerThread.getState() != ThreadState::blockedOnMutex ||
+			higherThread.getState() != ThreadState::blockedOnMutex)
+		result = false;
+
+	mutex.unlock();
+
+	if (lowerThread.getState() != ThreadState::blockedOnMutex || higherThread.getState() != ThreadState::runnable)
+		result = false;
+
+	conditionVariable.notifyOne();
+
+	// notified thread owns the mutex, so it is boosted by the thread still blocked on it
+	if (waitingThread.getState() != ThreadState::runnable || waitingThread.getEffectivePriority() != priority - 2)
+		result = false;
+
+	waitingThread.join();
+	lowerThread.join();
+	higherThread.join();
+
+	for (const auto ret : results)
+		if (ret != 0)
+			result = false;
+
+	return result;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ConditionVariableWaitMorphingTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	for (const auto protocol : {Mutex::Protocol::none, Mutex::Protocol::priorityInheritance})
+		if (phase1(protocol) == false)
+			return false;
+
+	for (const auto& function : {phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
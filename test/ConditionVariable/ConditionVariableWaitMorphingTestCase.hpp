@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief ConditionVariableWaitMorphingTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_CONDITIONVARIABLE_CONDITIONVARIABLEWAITMORPHINGTESTCASE_HPP_
+#define TEST_CONDITIONVARIABLE_CONDITIONVARIABLEWAITMORPHINGTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests moving threads waiting for condition variable directly to the mutex.
+ *
+ * Tests that notified threads are not woken while the mutex is locked, that they inherit priority through the mutex and
+ * that they can still time out while waiting for the mutex.
+ */
+
+class ConditionVariableWaitMorphingTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_CONDITIONVARIABLE_CONDITIONVARIABLEWAITMORPHINGTESTCASE_HPP_
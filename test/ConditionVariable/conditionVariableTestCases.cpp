@@ -13,6 +13,7 @@
 
 #include "ConditionVariablePriorityTestCase.hpp"
 #include "ConditionVariableOperationsTestCase.hpp"
+#include "ConditionVariableWaitMorphingTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -35,11 +36,15 @@ const ConditionVariablePriorityTestCase priorityTestCase;
 /// ConditionVariableOperationsTestCase instance
 const ConditionVariableOperationsTestCase operationsTestCase;
 
+/// ConditionVariableWaitMorphingTestCase instance
+const ConditionVariableWaitMorphingTestCase waitMorphingTestCase;
+
 /// array with references to TestCase objects related to condition variables
 const TestCaseGroup::Range::value_type conditionVariableTestCases_[]
 {
 		TestCaseGroup::Range::value_type{priorityTestCase},
 		TestCaseGroup::Range::value_type{operationsTestCase},
+		TestCaseGroup::Range::value_type{waitMorphingTestCase},
 };
 
 }	// namespace
@@ -10,4 +10,5 @@
 target_sources(distortosTest.elf PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ConditionVariableOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ConditionVariablePriorityTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ConditionVariableWaitMorphingTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/conditionVariableTestCases.cpp)
@@ -0,0 +1,233 @@
+/**
+ * \file
+ * \brief EventGroupOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "EventGroupOperationsTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/EventGroup.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// result of wait - return code and value of event bits
+using Result = std::pair<int, EventGroup::Bits>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for waiting thread, bytes
+constexpr size_t waitingThreadStackSize {512};
+
+/// duration used in tests of timeouts
+constexpr TickClock::duration waitDuration {11};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests non-blocking waits for any and for all event bits, with and without clearing them.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	EventGroup eventGroup {0b0001};
+
+	if (eventGroup.get() != 0b0001 || eventGroup.tryWaitAny(0) != Result{EINVAL, 0b0001} ||
+			eventGroup.tryWaitAll(0) != Result{EINVAL, 0b0001})
+		return false;
+
+	if (eventGroup.set(0b0100) != 0b0001 || eventGroup.get() != 0b0101)
+		return false;
+
+	if (eventGroup.tryWaitAny(0b1010) != Result{EAGAIN, 0b0101} ||
+			eventGroup.tryWaitAll(0b0111) != Result{EAGAIN, 0b0101})
+		return false;
+
+	// successful waits without clearing don't change event bits
+	if (eventGroup.tryWaitAny(0b0110) != Result{0, 0b0101} || eventGroup.tryWaitAll(0b0101) != Result{0, 0b0101} ||
+			eventGroup.get() != 0b0101)
+		return false;
+
+	// successful waits with clearing clear only the awaited bits and return the value before clearing
+	if (eventGroup.tryWaitAny(0b0110, true) != Result{0, 0b0101} || eventGroup.get() != 0b0001)
+		return false;
+
+	if (eventGroup.set(0b1010) != 0b0001 || eventGroup.tryWaitAll(0b1001, true) != Result{0, 0b1011} ||
+			eventGroup.get() != 0b0010)
+		return false;
+
+	// unsuccessful wait with clearing doesn't change event bits
+	if (eventGroup.tryWaitAll(0b0011, true) != Result{EAGAIN, 0b0010} || eventGroup.get() != 0b0010)
+		return false;
+
+	return eventGroup.clear(0b0110) == 0b0010 && eventGroup.get() == 0;
+}
+
+/**
+ * \brief Tests unblocking multiple waiting threads with single set() operation.
+ *
+ * Three threads with priorities higher than current thread wait for the same event group:
+ * - first (highest priority) - for all of bits 0 and 1;
+ * - second - for any of bit 2, clearing it;
+ * - third (lowest priority) - for any of bit 2;
+ *
+ * Single set() of bits 1 and 2 unblocks first and second thread, but not the third one - bit 2 is cleared by the
+ * second thread, which is earlier in priority order.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	EventGroup eventGroup;
+	Result results[3] {};
+	const auto priority = ThisThread::getPriority();
+
+	auto thread0 = makeAndStartDynamicThread({waitingThreadStackSize, static_cast<uint8_t>(priority + 3)},
+			[&eventGroup, &results]()
+			{
+				results[0] = eventGroup.waitAll(0b0011);
+			});
+	auto thread1 = makeAndStartDynamicThread({waitingThreadStackSize, static_cast<uint8_t>(priority + 2)},
+			[&eventGroup, &results]()
+			{
+				results[1] = eventGroup.waitAny(0b0100, true);
+			});
+	auto thread2 = makeAndStartDynamicThread({waitingThreadStackSize, static_cast<uint8_t>(priority + 1)},
+			[&eventGroup, &results]()
+			{
+				results[2] = eventGroup.waitAny(0b0100);
+			});
+
+	bool result {true};
+
+	// wait for all bits is not satisfied by some of them
+	eventGroup.set(0b0001);
+	if (results[0] != Result{} || results[1] != Result{} || results[2] != Result{})
+		result = false;
+
+	// waiting threads preempt this thread before set() returns
+	eventGroup.set(0b0110);
+	if (results[0] != Result{0, 0b0111} || results[1] != Result{0, 0b0111} || results[2] != Result{} ||
+			eventGroup.get() != 0b0011)
+		result = false;
+
+	eventGroup.set(0b0100);
+	if (results[2] != Result{0, 0b0111} || eventGroup.get() != 0b0111)
+		result = false;
+
+	thread0.join();
+	thread1.join();
+	thread2.join();
+
+	return result;
+}
+
+/**
+ * \brief Tests timeouts of waits.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	EventGroup eventGroup {0b0001};
+
+	{
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = eventGroup.tryWaitAllFor(waitDuration, 0b0011);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != Result{ETIMEDOUT, 0b0001} || realDuration != waitDuration + decltype(waitDuration){1})
+			return false;
+	}
+	{
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + waitDuration;
+		const auto ret = eventGroup.tryWaitAnyUntil(requestedTimePoint, 0b0010, true);
+		if (ret != Result{ETIMEDOUT, 0b0001} || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	// wait which can be satisfied immediately never times out
+	return eventGroup.tryWaitAnyFor(TickClock::duration{}, 0b0001, true) == Result{0, 0b0001} &&
+			eventGroup.get() == 0;
+}
+
+/**
+ * \brief Tests setting event bits from interrupt context.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	EventGroup eventGroup;
+	auto softwareTimer = makeStaticSoftwareTimer([&eventGroup]()
+			{
+				eventGroup.set(0b1000);
+			});
+
+	waitForNextTick();
+	softwareTimer.start(waitDuration);
+	const auto start = TickClock::now();
+	const auto ret = eventGroup.tryWaitAnyFor(waitDuration * 2, 0b1100, true);
+	const auto realDuration = TickClock::now() - start;
+	return ret == Result{0, 0b1000} && realDuration == waitDuration + decltype(waitDuration){1} &&
+			eventGroup.get() == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool EventGroupOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
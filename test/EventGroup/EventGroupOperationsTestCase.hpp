@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief EventGroupOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_EVENTGROUP_EVENTGROUPOPERATIONSTESTCASE_HPP_
+#define TEST_EVENTGROUP_EVENTGROUPOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various EventGroup operations.
+ *
+ * Tests non-blocking waits for any and for all event bits (with and without clearing them), unblocking multiple waiting
+ * threads with single set() operation, timeouts of waits and setting event bits from interrupt context.
+ */
+
+class EventGroupOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_EVENTGROUP_EVENTGROUPOPERATIONSTESTCASE_HPP_
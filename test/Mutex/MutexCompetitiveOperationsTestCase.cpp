@@ -0,0 +1,187 @@
+/**
+ * \file
+ * \brief MutexCompetitiveOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MutexCompetitiveOperationsTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests unlocking of mutex with lower priority thread waiting for it.
+ *
+ * In Mode::handoff the waiting thread becomes the owner, so the mutex cannot be locked again by current thread. In
+ * Mode::competitive the mutex can be locked again without any context switch. Waiting thread which runs while the mutex
+ * is locked again blocks on the mutex once more.
+ *
+ * \param [in] mode is the mode of mutex used in the test
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase1(const Mutex::Mode mode)
+{
+	Mutex mutex {Mutex::Type::normal, Mutex::Protocol::none, {}, mode};
+	int ret {-1};
+	auto thread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(ThisThread::getPriority() - 1)},
+			[&mutex, &ret]()
+			{
+				ret = mutex.lock();
+				mutex.unlock();
+			});
+
+	bool result {true};
+
+	mutex.lock();
+	ThisThread::sleepFor({});	// let the test thread block on the mutex
+	if (thread.getState() != ThreadState::blockedOnMutex)
+		result = false;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	mutex.unlock();
+	const auto tryLockRet = mutex.tryLock();
+	if (statistics::getContextSwitchCount() != contextSwitchCount || thread.getState() != ThreadState::runnable)
+		result = false;
+
+	if (mode == Mutex::Mode::handoff)
+	{
+		if (tryLockRet != EBUSY)
+			result = false;
+	}
+	else
+	{
+		if (tryLockRet != 0)
+			result = false;
+
+		ThisThread::sleepFor({});	// test thread fails to lock the mutex and blocks again
+		if (thread.getState() != ThreadState::blockedOnMutex || ret != -1)
+			result = false;
+
+		mutex.unlock();
+	}
+
+	thread.join();
+
+	return result && ret == 0;
+}
+
+/**
+ * \brief Tests priority inheritance when mutex is locked by a thread which was not waiting for it.
+ *
+ * Two threads with higher priorities wait for the mutex with priorityInheritance protocol. Current thread unlocks the
+ * mutex and locks it again before the unblocked thread runs - the other thread is still waiting, so its priority must
+ * be inherited. Then the unblocked thread blocks on the mutex again and its priority is inherited too.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Mutex mutex {Mutex::Protocol::priorityInheritance, {}, Mutex::Mode::competitive};
+	int rets[2] {-1, -1};
+	const auto priority = ThisThread::getPriority();
+
+	mutex.lock();
+
+	// thread with lower priority is started first, so that it preempts this thread before its priority is boosted
+	auto thread1 = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 1)},
+			[&mutex, &rets]()
+			{
+				rets[1] = mutex.lock();
+				mutex.unlock();
+			});
+	auto thread0 = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 2)},
+			[&mutex, &rets]()
+			{
+				rets[0] = mutex.lock();
+				mutex.unlock();
+			});
+
+	bool result {true};
+
+	if (ThisThread::getEffectivePriority() != priority + 2)
+		result = false;
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		mutex.unlock();
+		if (ThisThread::getEffectivePriority() != priority || mutex.tryLock() != 0 ||
+				ThisThread::getEffectivePriority() != priority + 1)
+			result = false;
+	}
+
+	// unblocked test thread preempted this thread, failed to lock the mutex and blocked again
+	if (thread0.getState() != ThreadState::blockedOnMutex || ThisThread::getEffectivePriority() != priority + 2)
+		result = false;
+
+	mutex.unlock();
+
+	if (rets[0] != 0 || rets[1] != 0 || ThisThread::getEffectivePriority() != priority)
+		result = false;
+
+	thread0.join();
+	thread1.join();
+
+	return result;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MutexCompetitiveOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	for (const auto mode : {Mutex::Mode::handoff, Mutex::Mode::competitive})
+		if (phase1(mode) == false)
+			return false;
+
+	if (phase2() == false)
+		return false;
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief MutexCompetitiveOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_MUTEX_MUTEXCOMPETITIVEOPERATIONSTESTCASE_HPP_
+#define TEST_MUTEX_MUTEXCOMPETITIVEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests operations in scenarios specific for competitive mode of mutex.
+ *
+ * Tests:
+ * - locking the mutex again by the thread which unlocked it, before the unblocked thread runs,
+ * - blocking of unblocked thread which lost the mutex,
+ * - priority inheritance when mutex with waiting threads is locked by a thread which was not waiting for it.
+ */
+
+class MutexCompetitiveOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_MUTEX_MUTEXCOMPETITIVEOPERATIONSTESTCASE_HPP_
@@ -8,6 +8,7 @@
 #
 
 target_sources(distortosTest.elf PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/MutexCompetitiveOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MutexErrorCheckingOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MutexOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MutexPriorityInheritanceOperationsTestCase.cpp
@@ -18,6 +18,7 @@
 #include "MutexPriorityProtectOperationsTestCase.hpp"
 #include "MutexPriorityInheritanceOperationsTestCase.hpp"
 #include "MutexPriorityProtocolTestCase.hpp"
+#include "MutexCompetitiveOperationsTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -55,6 +56,9 @@ const MutexPriorityInheritanceOperationsTestCase priorityInheritanceOperationsTe
 /// MutexPriorityProtocolTestCase instance
 const MutexPriorityProtocolTestCase priorityProtocolTestCase;
 
+/// MutexCompetitiveOperationsTestCase instance
+const MutexCompetitiveOperationsTestCase competitiveOperationsTestCase;
+
 /// array with references to TestCase objects related to mutexes
 const TestCaseGroup::Range::value_type mutexTestCases_[]
 {
@@ -65,6 +69,7 @@ const TestCaseGroup::Range::value_type mutexTestCases_[]
 		TestCaseGroup::Range::value_type{priorityProtectOperationsTestCase},
 		TestCaseGroup::Range::value_type{priorityInheritanceOperationsTestCase},
 		TestCaseGroup::Range::value_type{priorityProtocolTestCase},
+		TestCaseGroup::Range::value_type{competitiveOperationsTestCase},
 };
 
 }	// namespace
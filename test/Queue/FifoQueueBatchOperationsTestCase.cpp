@@ -0,0 +1,160 @@
+/**
+ * \file
+ * \brief FifoQueueBatchOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "FifoQueueBatchOperationsTestCase.hpp"
+
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements transferred via tested queues
+using Value = uint32_t;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of tested queues, elements
+constexpr size_t queueSize {5};
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether popped values form expected sequence.
+ *
+ * \param [in] values is a pointer to array with popped values
+ * \param [in] count is the number of values in \a values
+ * \param [in] firstValue is the expected value of first element
+ *
+ * \return true if values form expected sequence, false otherwise
+ */
+
+bool checkSequence(const Value* const values, const size_t count, const Value firstValue)
+{
+	for (size_t i {}; i < count; ++i)
+		if (values[i] != firstValue + i)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests batch operations of single queue.
+ *
+ * \tparam Queue is the type of tested queue - FifoQueue<Value> or RawFifoQueue with element size equal to
+ * sizeof(Value)
+ *
+ * \param [in] queue is a reference to tested queue, it must be empty and have capacity of \a queueSize elements
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Queue>
+bool testQueue(Queue& queue)
+{
+	Value values[queueSize * 2];
+
+	{
+		const auto ret = queue.tryPopN(values, queueSize);
+		if (ret.first != EAGAIN || ret.second != 0)
+			return false;
+	}
+
+	for (size_t i {}; i < sizeof(values) / sizeof(*values); ++i)
+		values[i] = i;
+
+	{
+		const auto ret = queue.pushN(values, 3);
+		if (ret.first != 0 || ret.second != 3)
+			return false;
+	}
+
+	{
+		Value poppedValues[2] {};
+		const auto ret = queue.popN(poppedValues, 2);
+		if (ret.first != 0 || ret.second != 2 || checkSequence(poppedValues, ret.second, 0) == false)
+			return false;
+	}
+
+	// 1 element in the queue, only 4 of 6 elements fit, pushing crosses the wrap-around of storage
+	{
+		const auto ret = queue.tryPushN(values + 3, 6);
+		if (ret.first != 0 || ret.second != queueSize - 1)
+			return false;
+	}
+
+	{
+		const auto ret = queue.tryPushNFor(singleDuration, values, 1);
+		if (ret.first != ETIMEDOUT || ret.second != 0)
+			return false;
+	}
+
+	{
+		Value poppedValues[queueSize * 2] {};
+		const auto ret = queue.tryPopN(poppedValues, sizeof(poppedValues) / sizeof(*poppedValues));
+		if (ret.first != 0 || ret.second != queueSize || checkSequence(poppedValues, ret.second, 2) == false)
+			return false;
+	}
+
+	{
+		const auto ret = queue.tryPopNFor(singleDuration, values, 1);
+		if (ret.first != ETIMEDOUT || ret.second != 0)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool FifoQueueBatchOperationsTestCase::run_() const
+{
+	{
+		StaticFifoQueue<Value, queueSize> fifoQueue;
+		if (testQueue(fifoQueue) == false)
+			return false;
+	}
+
+	{
+		StaticRawFifoQueue2<sizeof(Value), queueSize> rawFifoQueue;
+		if (testQueue(rawFifoQueue) == false)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief FifoQueueBatchOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_FIFOQUEUEBATCHOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_FIFOQUEUEBATCHOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests batch operations of [Raw]FifoQueue.
+ *
+ * Tests pushing (pushN(), tryPushN() and tryPushNFor()) and popping (popN(), tryPopN() and tryPopNFor()) of multiple
+ * elements to/from [Raw]FifoQueue - these operations must transfer expected number of elements (also across the
+ * wrap-around of queue's storage), preserve their order and return expected results when the queue is empty or full.
+ */
+
+class FifoQueueBatchOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_FIFOQUEUEBATCHOPERATIONSTESTCASE_HPP_
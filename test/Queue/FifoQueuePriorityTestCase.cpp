@@ -13,14 +13,13 @@
 
 #include "QueueWrappers.hpp"
 
+#include "getHeapUsage.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 
 #include "distortos/DynamicThread.hpp"
 #include "distortos/statistics.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -100,7 +99,7 @@ bool popFinalCheck(const QueueWrapper& queueWrapper)
 void popPrepare(const QueueWrapper& queueWrapper)
 {
 	for (size_t i = 0; i < totalThreads; ++i)
-		queueWrapper.tryPush(uint8_t{}, OperationCountingType{i});
+		queueWrapper.tryPush(uint8_t{}, OperationCountingType{static_cast<OperationCountingType::Value>(i)});
 }
 
 /**
@@ -171,7 +170,7 @@ void pushThread(SequenceAsserter& sequenceAsserter, const SequencePoints sequenc
 
 bool pushTrigger(const QueueWrapper& queueWrapper, const size_t i)
 {
-	queueWrapper.push(uint8_t{}, OperationCountingType{i + totalThreads});
+	queueWrapper.push(uint8_t{}, OperationCountingType{static_cast<OperationCountingType::Value>(i + totalThreads)});
 	return true;
 }
 
@@ -215,7 +214,7 @@ const std::array<Stage, 2> stages
 
 bool FifoQueuePriorityTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 	std::remove_const<decltype(contextSwitchCount)>::type expectedContextSwitchCount {};
 	constexpr size_t fifoQueueTypes {4};
@@ -293,7 +292,7 @@ bool FifoQueuePriorityTestCase::run_() const
 					}
 
 					// dynamic memory must be deallocated after each test phase
-					if (mallinfo().uordblks != allocatedMemory)
+					if (getHeapUsage() != allocatedMemory)
 						return false;
 				}
 
@@ -13,6 +13,7 @@
 
 #include "QueueWrappers.hpp"
 
+#include "getHeapUsage.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 
@@ -20,8 +21,6 @@
 #include "distortos/statistics.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -102,7 +101,7 @@ bool popFinalCheck(const QueueWrapper& queueWrapper)
 void popPrepare(const QueueWrapper& queueWrapper)
 {
 	for (size_t i = 0; i < totalThreads; ++i)
-		queueWrapper.tryPush(i, OperationCountingType{i});
+		queueWrapper.tryPush(i, OperationCountingType{static_cast<OperationCountingType::Value>(i)});
 }
 
 /**
@@ -177,7 +176,8 @@ void pushThread(SequenceAsserter& sequenceAsserter, const SequencePoints sequenc
 
 bool pushTrigger(const QueueWrapper& queueWrapper, size_t, const ThreadParameters& threadParameters)
 {
-	queueWrapper.push(threadParameters.first, OperationCountingType{totalThreads + threadParameters.second});
+	const auto value = static_cast<OperationCountingType::Value>(totalThreads + threadParameters.second);
+	queueWrapper.push(threadParameters.first, OperationCountingType{value});
 	return true;
 }
 
@@ -221,7 +221,7 @@ const std::array<Stage, 2> stages
 
 bool MessageQueuePriorityTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 	std::remove_const<decltype(contextSwitchCount)>::type expectedContextSwitchCount {};
 	constexpr size_t messageQueueTypes {4};
@@ -305,7 +305,7 @@ bool MessageQueuePriorityTestCase::run_() const
 					}
 
 					// dynamic memory must be deallocated after each test phase
-					if (mallinfo().uordblks != allocatedMemory)
+					if (getHeapUsage() != allocatedMemory)
 						return false;
 				}
 
@@ -13,13 +13,12 @@
 
 #include "QueueWrappers.hpp"
 
+#include "getHeapUsage.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/StaticSoftwareTimer.hpp"
 #include "distortos/statistics.hpp"
 
-#include <malloc.h>
-
 #include <cerrno>
 
 namespace distortos
@@ -1185,7 +1184,7 @@ bool QueueOperationsTestCase::run_() const
 	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
 			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount;
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
 	for (const auto& function : {phase1, phase2, phase3, phase4, phase5, phase6})
@@ -1194,7 +1193,7 @@ bool QueueOperationsTestCase::run_() const
 		if (ret != true)
 			return ret;
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
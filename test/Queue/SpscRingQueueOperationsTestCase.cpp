@@ -0,0 +1,295 @@
+/**
+ * \file
+ * \brief SpscRingQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SpscRingQueueOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/StaticSpscRingQueue.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of tested queue, elements
+constexpr size_t queueSize {5};
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements transferred via tested queue
+using Value = uint32_t;
+
+/// type of tested queue
+using TestQueue = StaticSpscRingQueue<Value, queueSize>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether popped values form expected sequence.
+ *
+ * \param [in] values is a pointer to array with popped values
+ * \param [in] count is the number of values in \a values
+ * \param [in] firstValue is the expected value of first element
+ *
+ * \return true if values form expected sequence, false otherwise
+ */
+
+bool checkSequence(const Value* const values, const size_t count, const Value firstValue)
+{
+	for (size_t i {}; i < count; ++i)
+		if (values[i] != firstValue + i)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests blocking pop() and popN() on empty queue - they must be woken up at expected time by producer running in
+ * software timer.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestQueue queue;
+	Value values[queueSize] {};
+	size_t count {};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&queue, &values, &count]()
+			{
+				queue.tryPushN(values, count);
+			});
+
+	{
+		waitForNextTick();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		values[0] = 0x1a4e0f1f;
+		count = 1;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// queue is currently empty, but pop() should succeed at expected time
+		Value value {};
+		const auto ret = queue.pop(value);
+		if (ret != 0 || wakeUpTimePoint != TickClock::now() || value != values[0] || queue.getSize() != 0)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		for (size_t i {}; i < 3; ++i)
+			values[i] = 0x7c9d3b00 + i;
+		count = 3;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// queue is currently empty, but popN() should succeed at expected time and get all pushed elements
+		Value poppedValues[queueSize] {};
+		const auto ret = queue.popN(poppedValues, queueSize);
+		if (ret.first != 0 || ret.second != count || wakeUpTimePoint != TickClock::now() ||
+				checkSequence(poppedValues, ret.second, values[0]) == false || queue.getSize() != 0)
+			return false;
+	}
+
+	return softwareTimer.isRunning() == false;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests timeouts of tryPopFor() and tryPopUntil() on empty queue and non-blocking operations on empty and full queue.
+ * Element pushed after the timeout must not be lost.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	TestQueue queue;
+	Value value {};
+
+	if (queue.tryPop(value) != EAGAIN)
+		return false;
+
+	{
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = queue.tryPopFor(singleDuration, value);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = queue.tryPopUntil(requestedTimePoint, value);
+		if (ret != ETIMEDOUT || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	{
+		// queue is not empty, so tryPopFor() must succeed immediately
+		constexpr Value magicValue {0x5e81c02d};
+		if (queue.tryPush(magicValue) != 0)
+			return false;
+
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = queue.tryPopFor(longDuration, value);
+		if (ret != 0 || start != TickClock::now() || value != magicValue)
+			return false;
+	}
+
+	for (size_t i {}; i < queueSize; ++i)
+		if (queue.tryPush(i) != 0)
+			return false;
+
+	if (queue.tryPush(queueSize) != EAGAIN || queue.getSize() != queueSize)
+		return false;
+
+	for (size_t i {}; i < queueSize; ++i)
+		if (queue.tryPop(value) != 0 || value != i)
+			return false;
+
+	return queue.tryPop(value) == EAGAIN;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests pushing and popping of multiple elements across the wrap-around of queue's storage, both with tryPushN() /
+ * popN() and with blocks returned by getWriteBlock() / getReadBlock().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	TestQueue queue;
+	Value values[queueSize * 2];
+	for (size_t i {}; i < sizeof(values) / sizeof(*values); ++i)
+		values[i] = i;
+
+	if (queue.getCapacity() != queueSize || queue.tryPushN(values, 3) != 3)
+		return false;
+
+	{
+		Value poppedValues[2] {};
+		const auto ret = queue.popN(poppedValues, 2);
+		if (ret.first != 0 || ret.second != 2 || checkSequence(poppedValues, ret.second, 0) == false)
+			return false;
+	}
+
+	// 1 element in the queue, only 4 of 6 elements fit, pushing crosses the wrap-around of storage
+	if (queue.tryPushN(values + 3, 6) != queueSize - 1 || queue.tryPushN(values, 1) != 0 ||
+			queue.getSize() != queueSize)
+		return false;
+
+	{
+		// popping crosses the wrap-around of storage
+		Value poppedValues[queueSize * 2] {};
+		const auto ret = queue.popN(poppedValues, sizeof(poppedValues) / sizeof(*poppedValues));
+		if (ret.first != 0 || ret.second != queueSize || checkSequence(poppedValues, ret.second, 2) == false)
+			return false;
+	}
+
+	if (queue.tryPopN(values, 1) != 0 || queue.getSize() != 0)
+		return false;
+
+	// queue is empty, read and write positions are 2 elements after the beginning of storage
+	{
+		const auto writeBlock = queue.getWriteBlock();
+		if (writeBlock.second != queueSize - 2)
+			return false;
+
+		for (size_t i {}; i < writeBlock.second; ++i)
+			writeBlock.first[i] = 0x3c5f9e00 + i;
+		queue.increaseWritePosition(writeBlock.second);
+	}
+	{
+		// second block of free slots is at the beginning of storage
+		const auto writeBlock = queue.getWriteBlock();
+		if (writeBlock.second != 2)
+			return false;
+
+		for (size_t i {}; i < writeBlock.second; ++i)
+			writeBlock.first[i] = 0x3c5f9e00 + queueSize - 2 + i;
+		queue.increaseWritePosition(writeBlock.second);
+	}
+
+	if (queue.getWriteBlock().second != 0 || queue.getSize() != queueSize)
+		return false;
+
+	{
+		const auto readBlock = queue.getReadBlock();
+		if (readBlock.second != queueSize - 2 || checkSequence(readBlock.first, readBlock.second, 0x3c5f9e00) == false)
+			return false;
+
+		queue.increaseReadPosition(readBlock.second);
+	}
+	{
+		const auto readBlock = queue.getReadBlock();
+		if (readBlock.second != 2 ||
+				checkSequence(readBlock.first, readBlock.second, 0x3c5f9e00 + queueSize - 2) == false)
+			return false;
+
+		queue.increaseReadPosition(readBlock.second);
+	}
+
+	return queue.getReadBlock().second == 0 && queue.getSize() == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SpscRingQueueOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief SpscRingQueueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_SPSCRINGQUEUEOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_SPSCRINGQUEUEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various SpscRingQueue operations.
+ *
+ * Tests blocking pop() and popN() which are woken up by producer running in software timer, timeouts of tryPopFor()
+ * and tryPopUntil(), pushing and popping of multiple elements across the wrap-around of queue's storage (also with
+ * getWriteBlock() and getReadBlock()) and behavior of the queue when it is empty or full.
+ */
+
+class SpscRingQueueOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_SPSCRINGQUEUEOPERATIONSTESTCASE_HPP_
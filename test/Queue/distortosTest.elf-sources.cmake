@@ -8,8 +8,10 @@
 #
 
 target_sources(distortosTest.elf PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/FifoQueueBatchOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/FifoQueuePriorityTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MessageQueuePriorityTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/QueueOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/queueTestCases.cpp
-		${CMAKE_CURRENT_LIST_DIR}/QueueWrappers.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/QueueWrappers.cpp
+		${CMAKE_CURRENT_LIST_DIR}/SpscRingQueueOperationsTestCase.cpp)
@@ -2,7 +2,7 @@
  * \file
  * \brief SemaphoreOperationsTestCase class implementation
  *
- * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,7 @@
 
 #include "SemaphoreOperationsTestCase.hpp"
 
+#include "SequenceAsserter.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/DynamicThread.hpp"
@@ -55,6 +56,13 @@ constexpr decltype(statistics::getContextSwitchCount()) phase3ThreadContextSwitc
 /// thread blocks on semaphore (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase4SoftwareTimerContextSwitchCount {2};
 
+/// expected number of context switches in phase6 block involving multiple test threads: 1-6 - each of 3 test threads
+/// starts and blocks on semaphore (main -> test -> main), 7 - first postN() unblocks highest and lowest priority test
+/// threads (main -> highest), 8 - highest priority test thread terminates (highest -> lowest), 9 - lowest priority test
+/// thread terminates (lowest -> main), 10 - second postN() unblocks remaining test thread (main -> middle), 11 - this
+/// test thread terminates (middle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase6ThreadsContextSwitchCount {11};
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -432,6 +440,139 @@ bool phase5()
 	return true;
 }
 
+/**
+ * \brief Phase 6 of test case.
+ *
+ * Tests operations on multiple units of semaphore. tryWaitN() must lock either all requested units or none of them.
+ * Main (current) thread waits for multiple units of semaphore, which are posted by two software timers from interrupt
+ * context - the first one posts too few units, so main thread is expected to acquire the semaphore only when the
+ * second one posts the remaining units. Request for more units than max value of semaphore must fail immediately with
+ * EINVAL. Single postN() must unblock all test threads whose requests can be satisfied - in priority order - skipping
+ * higher priority test thread which requests more units than are available.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase6()
+{
+	constexpr Semaphore::Value maxValue {5};
+
+	Semaphore semaphore {0, maxValue};
+
+	{
+		const auto ret = semaphore.postN(3);
+		if (ret != 0 || semaphore.getValue() != 3)
+			return false;
+	}
+
+	{
+		const auto ret = semaphore.tryWaitN(4);
+		if (ret != EAGAIN || semaphore.getValue() != 3)
+			return false;
+	}
+
+	{
+		const auto ret = semaphore.postN(maxValue);
+		if (ret != EOVERFLOW || semaphore.getValue() != 3)
+			return false;
+	}
+
+	{
+		const auto ret = semaphore.tryWaitN(3);
+		if (ret != 0 || semaphore.getValue() != 0)
+			return false;
+	}
+
+	{
+		const auto ret = semaphore.waitN(maxValue + 1);
+		if (ret != EINVAL || semaphore.getValue() != 0)
+			return false;
+	}
+
+	auto softwareTimer1 = makeStaticSoftwareTimer(&Semaphore::postN, std::ref(semaphore), Semaphore::Value{1});
+	auto softwareTimer2 = makeStaticSoftwareTimer(&Semaphore::postN, std::ref(semaphore), Semaphore::Value{2});
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+
+		softwareTimer1.start(wakeUpTimePoint - singleDuration);
+		softwareTimer2.start(wakeUpTimePoint);
+
+		// only 1 of 3 units is posted by first software timer, wait should succeed when second one posts the remaining 2
+		const auto ret = semaphore.tryWaitNUntil(wakeUpTimePoint + longDuration, 3);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || semaphore.getValue() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase4SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = semaphore.postN(1);
+		if (ret != 0 || semaphore.getValue() != 1)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// only 1 unit is available, so tryWaitNUntil() for 2 units should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = semaphore.tryWaitNUntil(requestedTimePoint, 2);
+		if (ret != ETIMEDOUT || requestedTimePoint != TickClock::now() || semaphore.getValue() != 1 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase1TryWaitForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = semaphore.tryWait();
+		if (ret != 0 || semaphore.getValue() != 0)
+			return false;
+	}
+
+	{
+		constexpr size_t testThreadStackSize {512};
+
+		SequenceAsserter sequenceAsserter;
+		const auto waitFunctor = [&semaphore, &sequenceAsserter](const Semaphore::Value value,
+				const unsigned int sequencePoint)
+				{
+					if (semaphore.waitN(value) == 0)
+						sequenceAsserter.sequencePoint(sequencePoint);
+				};
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto priority = ThisThread::getPriority();
+		// test threads have higher priority than main thread, so each of them blocks on semaphore right after start
+		auto highestPriorityThread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 3)},
+				waitFunctor, Semaphore::Value{2}, 0u);
+		auto middlePriorityThread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 2)},
+				waitFunctor, Semaphore::Value{4}, 2u);
+		auto lowestPriorityThread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 1)},
+				waitFunctor, Semaphore::Value{1}, 1u);
+
+		// 3 units are enough for highest (2 units) and lowest (1 unit) priority test threads, request of middle
+		// priority test thread (4 units) is skipped
+		const auto ret1 = semaphore.postN(3);
+		const auto value1 = semaphore.getValue();
+		const auto state1 = middlePriorityThread.getState();
+		const auto ret2 = semaphore.postN(4);
+		highestPriorityThread.join();
+		middlePriorityThread.join();
+		lowestPriorityThread.join();
+		if (ret1 != 0 || value1 != 0 || state1 != ThreadState::blockedOnSemaphore || ret2 != 0 ||
+				semaphore.getValue() != 0 || sequenceAsserter.assertSequence(3) == false ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase6ThreadsContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -448,12 +589,16 @@ bool SemaphoreOperationsTestCase::run_() const
 	constexpr auto phase4ExpectedContextSwitchCount = 6 * waitForNextTickContextSwitchCount +
 			3 * phase4SoftwareTimerContextSwitchCount;
 	constexpr auto phase5ExpectedContextSwitchCount = 1 * waitForNextTickContextSwitchCount;
+	constexpr auto phase6ExpectedContextSwitchCount = 2 * waitForNextTickContextSwitchCount +
+			phase4SoftwareTimerContextSwitchCount + phase1TryWaitForUntilContextSwitchCount +
+			phase6ThreadsContextSwitchCount;
 	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
-			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount;
+			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount +
+			phase6ExpectedContextSwitchCount;
 
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
-	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5, phase6})
 	{
 		const auto ret = function();
 		if (ret != true)
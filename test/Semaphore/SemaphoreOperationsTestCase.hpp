@@ -2,7 +2,7 @@
  * \file
  * \brief SemaphoreOperationsTestCase class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -23,7 +23,8 @@ namespace test
 /**
  * \brief Tests various semaphore operations.
  *
- * Tests waiting (wait(), tryWait(), tryWaitFor() and tryWaitUntil()) and posting of semaphore.
+ * Tests waiting (wait(), tryWait(), tryWaitFor() and tryWaitUntil()) and posting of semaphore, also with multiple
+ * units.
  */
 
 class SemaphoreOperationsTestCase : public TestCaseCommon
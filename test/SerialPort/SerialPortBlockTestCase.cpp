@@ -0,0 +1,374 @@
+/**
+ * \file
+ * \brief SerialPortBlockTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SerialPortBlockTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+
+#include "distortos/devices/communication/SerialPort.hpp"
+#include "distortos/devices/communication/UartLowLevel.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <algorithm>
+
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// size of internal buffers of SerialPort, bytes
+constexpr size_t bufferSize {16};
+
+/// baud rate used for the test, bps
+constexpr uint32_t testBaudRate {115200};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// FakeUart class is a low-level UART driver which receives and transmits data only when requested by the test
+class FakeUart : public devices::UartLowLevel
+{
+public:
+
+	/**
+	 * \brief FakeUart's constructor
+	 */
+
+	constexpr FakeUart() :
+			readBuffer_{},
+			writeBuffer_{},
+			uartBase_{},
+			readSize_{},
+			received_{},
+			writeSize_{}
+	{
+
+	}
+
+	/**
+	 * \brief Emulates reception of data.
+	 *
+	 * Data is copied to the buffer of current read transfer. If the transfer is completed,
+	 * UartBase::readCompleteEvent() is called.
+	 *
+	 * \param [in] data is a pointer to received data
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return number of bytes which were received, may be less than \a size if current read transfer is shorter
+	 */
+
+	size_t receive(const void* const data, const size_t size)
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		const auto bytesReceived = std::min(size, readSize_ - received_);
+		memcpy(readBuffer_ + received_, data, bytesReceived);
+		received_ += bytesReceived;
+		if (readSize_ == 0 || received_ != readSize_)
+			return bytesReceived;
+
+		const auto bytesRead = received_;
+		readBuffer_ = {};
+		readSize_ = {};
+		received_ = {};
+		uartBase_->readCompleteEvent(bytesRead);
+		return bytesReceived;
+	}
+
+	std::pair<int, uint32_t> start(devices::UartBase& uartBase, const uint32_t baudRate, uint8_t, devices::UartParity,
+			bool) override
+	{
+		uartBase_ = &uartBase;
+		return {{}, baudRate};
+	}
+
+	int startRead(void* const buffer, const size_t size) override
+	{
+		readBuffer_ = static_cast<uint8_t*>(buffer);
+		readSize_ = size;
+		received_ = {};
+		return 0;
+	}
+
+	int startWrite(const void* const buffer, const size_t size) override
+	{
+		writeBuffer_ = static_cast<const uint8_t*>(buffer);
+		writeSize_ = size;
+		return 0;
+	}
+
+	int stop() override
+	{
+		uartBase_ = {};
+		return 0;
+	}
+
+	size_t stopRead() override
+	{
+		const auto bytesRead = received_;
+		readBuffer_ = {};
+		readSize_ = {};
+		received_ = {};
+		return bytesRead;
+	}
+
+	size_t stopWrite() override
+	{
+		writeBuffer_ = {};
+		writeSize_ = {};
+		return 0;
+	}
+
+	/**
+	 * \brief Emulates transmission of whole current write transfer.
+	 *
+	 * Data of current write transfer is copied to provided buffer, then UartBase::transmitStartEvent(),
+	 * UartBase::writeCompleteEvent() and UartBase::transmitCompleteEvent() are called.
+	 *
+	 * \param [out] buffer is a pointer to buffer for transmitted data
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return number of bytes which were transmitted, 0 if there is no write transfer or if it does not fit in
+	 * \a buffer
+	 */
+
+	size_t transmit(void* const buffer, const size_t size)
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		const auto bytesWritten = writeSize_;
+		if (bytesWritten == 0 || bytesWritten > size)
+			return 0;
+
+		memcpy(buffer, writeBuffer_, bytesWritten);
+		writeBuffer_ = {};
+		writeSize_ = {};
+		uartBase_->transmitStartEvent();
+		uartBase_->writeCompleteEvent(bytesWritten);
+		uartBase_->transmitCompleteEvent();
+		return bytesWritten;
+	}
+
+private:
+
+	/// buffer of current read transfer
+	uint8_t* readBuffer_;
+
+	/// buffer of current write transfer
+	const uint8_t* writeBuffer_;
+
+	/// pointer to UartBase object passed to start()
+	devices::UartBase* uartBase_;
+
+	/// size of current read transfer, bytes
+	size_t readSize_;
+
+	/// number of bytes received in current read transfer
+	size_t received_;
+
+	/// size of current write transfer, bytes
+	size_t writeSize_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tries to acquire and release blocks of both internal buffers from a thread which did not acquire them.
+ *
+ * \param [in] serialPort is a reference to SerialPort with acquired read block and acquired write block
+ *
+ * \return true if all operations failed as expected, false otherwise
+ */
+
+bool checkForeignThread(devices::SerialPort& serialPort)
+{
+	bool result {};
+	auto thread = makeAndStartDynamicThread({testThreadStackSize, ThisThread::getPriority()},
+			[&serialPort, &result]()
+			{
+				result = serialPort.releaseReadBlock(0) == EPERM && serialPort.releaseWriteBlock(0) == EPERM &&
+						serialPort.acquireReadBlock(0).first == EAGAIN &&
+						serialPort.acquireWriteBlock(0).first == EAGAIN;
+			});
+	thread.join();
+	return result;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests acquiring and releasing blocks of both internal buffers.
+ *
+ * \param [in] serialPort is a reference to opened SerialPort
+ * \param [in] uart is a reference to FakeUart connected to \a serialPort
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1(devices::SerialPort& serialPort, FakeUart& uart)
+{
+	constexpr uint8_t receivedData[] {'a', 'b', 'c', 'd'};
+	constexpr uint8_t writtenData[] {'w', 'x', 'y', 'z'};
+
+	// no data was received yet
+	if (serialPort.acquireReadBlock(0).first != EAGAIN)
+		return false;
+
+	if (uart.receive(receivedData, sizeof(receivedData)) != sizeof(receivedData))
+		return false;
+
+	// received data is available after current read transfer is stopped for a moment, so the wait has to be used
+	const auto timePoint = TickClock::now() + TickClock::duration{1};
+	const auto readBlock = serialPort.acquireReadBlock(sizeof(receivedData), &timePoint);
+	if (readBlock.first != 0 || readBlock.second.second != sizeof(receivedData) ||
+			memcmp(readBlock.second.first, receivedData, sizeof(receivedData)) != 0)
+		return false;
+
+	const auto writeBlock = serialPort.acquireWriteBlock(0);
+	if (writeBlock.first != 0 || writeBlock.second.second < sizeof(writtenData))
+		return false;
+
+	if (checkForeignThread(serialPort) == false)
+		return false;
+
+	memcpy(writeBlock.second.first, writtenData, sizeof(writtenData));
+	if (serialPort.releaseWriteBlock(sizeof(writtenData)) != 0)
+		return false;
+
+	uint8_t transmittedData[bufferSize] {};
+	if (uart.transmit(transmittedData, sizeof(transmittedData)) != sizeof(writtenData) ||
+			memcmp(transmittedData, writtenData, sizeof(writtenData)) != 0)
+		return false;
+
+	if (serialPort.releaseReadBlock(sizeof(receivedData)) != 0)
+		return false;
+
+	// nothing is acquired anymore
+	if (serialPort.releaseReadBlock(0) != EPERM || serialPort.releaseWriteBlock(0) != EPERM)
+		return false;
+
+	// all received data was consumed
+	return serialPort.acquireReadBlock(0).first == EAGAIN;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests releasing blocks with invalid size - devices must be unlocked, but no data may be consumed or committed.
+ *
+ * \param [in] serialPort is a reference to opened SerialPort with empty internal buffers
+ * \param [in] uart is a reference to FakeUart connected to \a serialPort
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2(devices::SerialPort& serialPort, FakeUart& uart)
+{
+	constexpr uint8_t receivedData[] {'e', 'f'};
+
+	if (uart.receive(receivedData, sizeof(receivedData)) != sizeof(receivedData))
+		return false;
+
+	{
+		const auto timePoint = TickClock::now() + TickClock::duration{1};
+		const auto readBlock = serialPort.acquireReadBlock(sizeof(receivedData), &timePoint);
+		if (readBlock.first != 0 || readBlock.second.second != sizeof(receivedData))
+			return false;
+
+		if (serialPort.releaseReadBlock(readBlock.second.second + 1) != EINVAL)
+			return false;
+	}
+	{
+		const auto writeBlock = serialPort.acquireWriteBlock(0);
+		if (writeBlock.first != 0)
+			return false;
+
+		if (serialPort.releaseWriteBlock(writeBlock.second.second + 1) != EINVAL)
+			return false;
+	}
+
+	// devices are unlocked
+	if (serialPort.releaseReadBlock(0) != EPERM || serialPort.releaseWriteBlock(0) != EPERM)
+		return false;
+
+	// received data was not consumed
+	const auto readBlock = serialPort.acquireReadBlock(0);
+	if (readBlock.first != 0 || readBlock.second.second != sizeof(receivedData) ||
+			memcmp(readBlock.second.first, receivedData, sizeof(receivedData)) != 0)
+		return false;
+
+	if (serialPort.releaseReadBlock(sizeof(receivedData)) != 0)
+		return false;
+
+	// nothing was committed for transmission
+	uint8_t transmittedData[bufferSize] {};
+	return uart.transmit(transmittedData, sizeof(transmittedData)) == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SerialPortBlockTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	{
+		uint8_t readBuffer[bufferSize];
+		uint8_t writeBuffer[bufferSize];
+		FakeUart uart;
+		devices::SerialPort serialPort {uart, readBuffer, sizeof(readBuffer), writeBuffer, sizeof(writeBuffer)};
+
+		if (serialPort.open(testBaudRate, 8, devices::UartParity::none, false) != 0)
+			return false;
+
+		for (const auto& function : {phase1, phase2})
+		{
+			const auto ret = function(serialPort, uart);
+			if (ret != true)
+				return ret;
+		}
+
+		if (serialPort.close() != 0)
+			return false;
+	}
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after test
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
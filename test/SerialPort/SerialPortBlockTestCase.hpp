@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief SerialPortBlockTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SERIALPORT_SERIALPORTBLOCKTESTCASE_HPP_
+#define TEST_SERIALPORT_SERIALPORTBLOCKTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests acquiring and releasing blocks of SerialPort's internal buffers.
+ *
+ * SerialPort is connected to a fake low-level UART driver, which "receives" and "transmits" data only when requested by
+ * the test. Tests that acquired blocks contain received data and that written blocks are transmitted, that the device
+ * stays locked until the block is released, that a block cannot be released by a thread which did not acquire it and
+ * that releasing a block with invalid size unlocks the device without consuming or committing any data.
+ */
+
+class SerialPortBlockTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SERIALPORT_SERIALPORTBLOCKTESTCASE_HPP_
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief serialPortTestCases object definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "serialPortTestCases.hpp"
+
+#include "SerialPortBlockTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// SerialPortBlockTestCase instance
+const SerialPortBlockTestCase blockTestCase;
+
+/// array with references to TestCase objects related to serial ports
+const TestCaseGroup::Range::value_type serialPortTestCases_[]
+{
+		TestCaseGroup::Range::value_type{blockTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup serialPortTestCases {TestCaseGroup::Range{serialPortTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,309 @@
+/**
+ * \file
+ * \brief SharedMutexOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SharedMutexOperationsTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicSharedMutex.hpp"
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticSharedMutex.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// duration used in tests of timeouts
+constexpr TickClock::duration waitDuration {11};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests non-blocking locking and error checking of lock and unlock functions.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	StaticSharedMutex<2> sharedMutex;
+
+	if (sharedMutex.tryLockShared() != 0 || sharedMutex.tryLockShared() != EBUSY || sharedMutex.lockShared() != EDEADLK ||
+			sharedMutex.tryLock() != EBUSY || sharedMutex.lock() != EDEADLK || sharedMutex.unlock() != EPERM)
+		return false;
+
+	if (sharedMutex.unlockShared() != 0 || sharedMutex.unlockShared() != EPERM)
+		return false;
+
+	if (sharedMutex.tryLock() != 0 || sharedMutex.tryLockShared() != EBUSY ||
+			sharedMutex.tryLockSharedFor(waitDuration) != EDEADLK || sharedMutex.unlockShared() != EPERM)
+		return false;
+
+	return sharedMutex.unlock() == 0 && sharedMutex.unlock() == EPERM;
+}
+
+/**
+ * \brief Tests concurrent readers, writer preference, priority inheritance and order of handing the lock over.
+ *
+ * Reader with priority higher than current thread locks the shared mutex while current thread also holds a shared
+ * lock, then waits for a semaphore. Writer with even higher priority blocks on the shared mutex, so it boosts both
+ * readers. Second reader with the highest priority cannot lock the shared mutex because a writer is waiting - even
+ * though a slot is free - and it also boosts both readers. When the readers release the shared mutex, it is handed over
+ * to the writer first and then to the second reader.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	DynamicSharedMutex sharedMutex {3};
+	Semaphore semaphore {0};
+	int results[3][2] {{-1, -1}, {-1, -1}, {-1, -1}};
+	int tryLockSharedResult {-1};
+	uint8_t sequence[3] {};
+	uint8_t sequenceCounter {};
+	const auto priority = ThisThread::getPriority();
+
+	if (sharedMutex.lockShared() != 0)
+		return false;
+
+	auto reader1 = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 1)},
+			[&sharedMutex, &semaphore, &results, &sequence, &sequenceCounter]()
+			{
+				results[0][0] = sharedMutex.lockShared();
+				semaphore.wait();
+				sequence[0] = ++sequenceCounter;
+				results[0][1] = sharedMutex.unlockShared();
+			});
+
+	bool result {true};
+
+	// readers don't serialize on each other
+	if (results[0][0] != 0 || reader1.getState() != ThreadState::blockedOnSemaphore)
+		result = false;
+
+	auto writer = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 2)},
+			[&sharedMutex, &results, &sequence, &sequenceCounter]()
+			{
+				results[1][0] = sharedMutex.lock();
+				sequence[1] = ++sequenceCounter;
+				results[1][1] = sharedMutex.unlock();
+			});
+
+	// waiting writer boosts all readers
+	if (writer.getState() != ThreadState::blockedOnSharedMutex || ThisThread::getEffectivePriority() != priority + 2 ||
+			reader1.getEffectivePriority() != priority + 2)
+		result = false;
+
+	auto reader2 = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 3)},
+			[&sharedMutex, &results, &tryLockSharedResult, &sequence, &sequenceCounter]()
+			{
+				tryLockSharedResult = sharedMutex.tryLockShared();
+				results[2][0] = sharedMutex.lockShared();
+				sequence[2] = ++sequenceCounter;
+				results[2][1] = sharedMutex.unlockShared();
+			});
+
+	// writer is preferred, new reader is blocked and boosts all current readers
+	if (tryLockSharedResult != EBUSY || reader2.getState() != ThreadState::blockedOnSharedMutex ||
+			ThisThread::getEffectivePriority() != priority + 3 || reader1.getEffectivePriority() != priority + 3)
+		result = false;
+
+	// writer still waits for the other reader
+	if (sharedMutex.unlockShared() != 0 || ThisThread::getEffectivePriority() != priority ||
+			writer.getState() != ThreadState::blockedOnSharedMutex || reader1.getEffectivePriority() != priority + 3)
+		result = false;
+
+	semaphore.post();
+
+	writer.join();
+	reader1.join();
+	reader2.join();
+
+	if (sequence[0] != 1 || sequence[1] != 2 || sequence[2] != 3)
+		result = false;
+
+	for (const auto& threadResults : results)
+		if (threadResults[0] != 0 || threadResults[1] != 0)
+			result = false;
+
+	return result;
+}
+
+/**
+ * \brief Tests timeouts of waits.
+ *
+ * Writer with timeout and reader without timeout block on the shared mutex locked for shared ownership by current
+ * thread. Reader is blocked only because of writer preference, so it locks the shared mutex when the wait of writer
+ * times out. Wait which can be satisfied immediately never times out.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	StaticSharedMutex<2> sharedMutex;
+	int writerResult {-1};
+	TickClock::duration writerDuration {};
+	int readerResults[2] {-1, -1};
+	const auto priority = ThisThread::getPriority();
+
+	if (sharedMutex.lockShared() != 0)
+		return false;
+
+	waitForNextTick();
+	auto writer = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 2)},
+			[&sharedMutex, &writerResult, &writerDuration]()
+			{
+				const auto start = TickClock::now();
+				writerResult = sharedMutex.tryLockFor(waitDuration);
+				writerDuration = TickClock::now() - start;
+			});
+
+	auto reader = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 1)},
+			[&sharedMutex, &readerResults]()
+			{
+				readerResults[0] = sharedMutex.lockShared();
+				readerResults[1] = sharedMutex.unlockShared();
+			});
+
+	bool result {true};
+
+	// current thread is boosted by the writer, so the reader blocks on the shared mutex only when current thread waits
+	if (writer.getState() != ThreadState::blockedOnSharedMutex || reader.getState() != ThreadState::runnable ||
+			ThisThread::getEffectivePriority() != priority + 2)
+		result = false;
+
+	writer.join();
+	reader.join();
+
+	if (writerResult != ETIMEDOUT || writerDuration != waitDuration + decltype(waitDuration){1} ||
+			readerResults[0] != 0 || readerResults[1] != 0)
+		result = false;
+
+	if (sharedMutex.unlockShared() != 0)
+		return false;
+
+	// wait which can be satisfied immediately never times out
+	return result == true && sharedMutex.tryLockUntil(TickClock::now()) == 0 && sharedMutex.unlock() == 0;
+}
+
+/**
+ * \brief Tests propagation of priority inheritance through a chain of shared mutexes.
+ *
+ * Current thread holds the second shared mutex for shared ownership. Reader with higher priority holds the first shared
+ * mutex for shared ownership and blocks while locking the second one for exclusive ownership. Writer with even higher
+ * priority blocks on the first shared mutex with a timeout, which boosts the reader and - through the second shared
+ * mutex - current thread. When the wait of writer times out, both threads are unboosted back along the same chain.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	StaticSharedMutex<2> firstSharedMutex;
+	StaticSharedMutex<2> secondSharedMutex;
+	int readerResults[4] {-1, -1, -1, -1};
+	int writerResult {-1};
+	const auto priority = ThisThread::getPriority();
+
+	if (secondSharedMutex.lockShared() != 0)
+		return false;
+
+	auto reader = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 1)},
+			[&firstSharedMutex, &secondSharedMutex, &readerResults]()
+			{
+				readerResults[0] = firstSharedMutex.lockShared();
+				readerResults[1] = secondSharedMutex.lock();
+				readerResults[2] = secondSharedMutex.unlock();
+				readerResults[3] = firstSharedMutex.unlockShared();
+			});
+
+	bool result {true};
+
+	// reader boosts current thread through the second shared mutex
+	if (reader.getState() != ThreadState::blockedOnSharedMutex || ThisThread::getEffectivePriority() != priority + 1)
+		result = false;
+
+	auto writer = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(priority + 2)},
+			[&firstSharedMutex, &writerResult]()
+			{
+				writerResult = firstSharedMutex.tryLockFor(waitDuration);
+			});
+
+	// writer boosts the reader, which propagates the boost to current thread
+	if (writer.getState() != ThreadState::blockedOnSharedMutex || reader.getEffectivePriority() != priority + 2 ||
+			ThisThread::getEffectivePriority() != priority + 2)
+		result = false;
+
+	writer.join();
+
+	// timeout of writer unboosts both threads in the chain
+	if (writerResult != ETIMEDOUT || reader.getEffectivePriority() != priority + 1 ||
+			ThisThread::getEffectivePriority() != priority + 1)
+		result = false;
+
+	if (secondSharedMutex.unlockShared() != 0 || ThisThread::getEffectivePriority() != priority)
+		result = false;
+
+	reader.join();
+
+	for (const auto readerResult : readerResults)
+		if (readerResult != 0)
+			result = false;
+
+	return result;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SharedMutexOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
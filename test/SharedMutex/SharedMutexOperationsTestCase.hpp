@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief SharedMutexOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SHAREDMUTEX_SHAREDMUTEXOPERATIONSTESTCASE_HPP_
+#define TEST_SHAREDMUTEX_SHAREDMUTEXOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various SharedMutex operations.
+ *
+ * Tests non-blocking shared and exclusive locking with error checking, concurrent readers, writer preference, priority
+ * inheritance towards all current readers, order of handing the lock over to waiting threads and timeouts of waits.
+ */
+
+class SharedMutexOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SHAREDMUTEX_SHAREDMUTEXOPERATIONSTESTCASE_HPP_
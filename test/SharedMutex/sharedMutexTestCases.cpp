@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief sharedMutexTestCases object definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "sharedMutexTestCases.hpp"
+
+#include "SharedMutexOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// SharedMutexOperationsTestCase instance
+const SharedMutexOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to shared mutexes
+const TestCaseGroup::Range::value_type sharedMutexTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup sharedMutexTestCases {TestCaseGroup::Range{sharedMutexTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
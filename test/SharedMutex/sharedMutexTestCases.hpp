@@ -0,0 +1,34 @@
+/**
+ * \file
+ * \brief sharedMutexTestCases object declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SHAREDMUTEX_SHAREDMUTEXTESTCASES_HPP_
+#define TEST_SHAREDMUTEX_SHAREDMUTEXTESTCASES_HPP_
+
+namespace distortos
+{
+
+namespace test
+{
+
+class TestCaseGroup;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// group of test cases related to shared mutexes
+extern const TestCaseGroup sharedMutexTestCases;
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SHAREDMUTEX_SHAREDMUTEXTESTCASES_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief SignalCatchingOperationsTestCase class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -28,6 +28,10 @@
 #define SIGNAL_CATCHING_OPERATIONS_TEST_CASE_PHASE_1_2_ENABLED CONFIG_MAIN_THREAD_SIGNAL_ACTIONS >= 1 && \
 		CONFIG_MAIN_THREAD_SIGNAL_ACTIONS <= 31
 
+/// configuration required by third phase of SignalCatchingOperationsTestCase - stack of thread cannot be sized to leave
+/// no free space when architecture adds its own overhead to size of each stack
+#define SIGNAL_CATCHING_OPERATIONS_TEST_CASE_PHASE_3_ENABLED (CONFIG_ARCHITECTURE_STACK_OVERHEAD == 0)
+
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
 namespace distortos
@@ -95,7 +99,7 @@ bool phase1()
 		{
 			// last iteration? clip the value so that it is identical to the one from previous iteration
 			const auto realMask = mask <= mainThreadSignalActions ? mask : mainThreadSignalActions;
-			const SignalSet signalMask {((realMask + signalNumber) % mainThreadSignalActions)};
+			const SignalSet signalMask {static_cast<uint32_t>((realMask + signalNumber) % mainThreadSignalActions)};
 			const auto setSignalActionResult = ThisThread::Signals::setSignalAction(signalNumber,
 					{abortSignalHandler, signalMask});
 			if (setSignalActionResult.first != 0)
@@ -107,7 +111,8 @@ bool phase1()
 			}
 			else	// compare returned signal action with the expected one
 			{
-				const SignalSet previousSignalMask {((mask - 1 + signalNumber) % mainThreadSignalActions)};
+				const SignalSet previousSignalMask
+						{static_cast<uint32_t>((mask - 1 + signalNumber) % mainThreadSignalActions)};
 				if (setSignalActionResult.second.getHandler() != abortSignalHandler ||
 						setSignalActionResult.second.getSignalMask().getBitset() != previousSignalMask.getBitset())
 					return false;
@@ -227,6 +232,8 @@ bool phase2()
 
 bool phase3()
 {
+#if SIGNAL_CATCHING_OPERATIONS_TEST_CASE_PHASE_3_ENABLED == 1
+
 	static_assert(SignalCatchingOperationsTestCase::getTestCasePriority() < UINT8_MAX &&
 			SignalCatchingOperationsTestCase::getTestCasePriority() > 1, "Invalid test case priority");
 
@@ -261,6 +268,8 @@ bool phase3()
 			return false;
 	}
 
+#endif	// SIGNAL_CATCHING_OPERATIONS_TEST_CASE_PHASE_3_ENABLED == 1
+
 	return true;
 }
 
@@ -278,7 +287,8 @@ bool SignalCatchingOperationsTestCase::run_() const
 
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
-	constexpr auto phase3ExpectedContextSwitchCount = 2 * phase3ThreadContextSwitchCount;
+	constexpr auto phase3ExpectedContextSwitchCount = SIGNAL_CATCHING_OPERATIONS_TEST_CASE_PHASE_3_ENABLED == 1 ?
+			2 * phase3ThreadContextSwitchCount : 0;
 
 #if SIGNAL_CATCHING_OPERATIONS_TEST_CASE_PHASE_1_2_ENABLED == 1
 	constexpr auto phase2ExpectedContextSwitchCount = 2 * phase2ThreadContextSwitchCount;
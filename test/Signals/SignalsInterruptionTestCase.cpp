@@ -2,7 +2,7 @@
  * \file
  * \brief SignalsInterruptionTestCase class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -188,7 +188,9 @@ private:
 	void signalingThreadFunction(SequenceAsserter& sequenceAsserter, Thread& thread) const
 	{
 		sequenceAsserter.sequencePoint(signalingThreadSequencePoint1_);
-		thread.queueSignal(signalHandlerSequencePoint_, sigval{reinterpret_cast<int>(&sequenceAsserter)});
+		sigval value {};
+		value.sival_ptr = &sequenceAsserter;
+		thread.queueSignal(signalHandlerSequencePoint_, value);
 		sequenceAsserter.sequencePoint(signalingThreadSequencePoint2_);
 	}
 
@@ -2,7 +2,7 @@
  * \file
  * \brief SignalsWaitOperationsTestCase class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -29,6 +29,7 @@
 #include "distortos/ThisThread.hpp"
 #include "distortos/ThisThread-Signals.hpp"
 
+#include <array>
 #include <cerrno>
 
 #endif	// #if SIGNALS_WAIT_OPERATIONS_TEST_CASE_ENABLED == 1
@@ -11,9 +11,9 @@
 
 #include "SoftwareTimerFunctionTypesTestCase.hpp"
 
-#include "distortos/DynamicSoftwareTimer.hpp"
+#include "getHeapUsage.hpp"
 
-#include <malloc.h>
+#include "distortos/DynamicSoftwareTimer.hpp"
 
 namespace distortos
 {
@@ -114,7 +114,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 {
 	constexpr auto singleDuration = TickClock::duration{1};
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 
 	// software timer with regular function
 	{
@@ -133,7 +133,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// software timer with state-less functor
@@ -152,7 +152,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// software timer with member function of object with state
@@ -171,7 +171,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// software timer with capturing lambda
@@ -194,7 +194,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	return true;
@@ -11,13 +11,12 @@
 
 #include "SoftwareTimerOperationsTestCase.hpp"
 
+#include "getHeapUsage.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/DynamicSoftwareTimer.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -147,7 +146,7 @@ private:
 
 bool SoftwareTimerOperationsTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 
 	{
 		volatile uint32_t value {};
@@ -463,7 +462,7 @@ bool SoftwareTimerOperationsTestCase::run_() const
 		}
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after test
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after test
 		return false;
 
 	return true;
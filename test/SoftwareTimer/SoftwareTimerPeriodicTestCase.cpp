@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerPeriodicTestCase class implementation
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,14 +11,14 @@
 
 #include "SoftwareTimerPeriodicTestCase.hpp"
 
+#include "getHeapUsage.hpp"
 #include "SequenceAsserter.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/DynamicSoftwareTimer.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
+#include <array>
 namespace distortos
 {
 
@@ -90,7 +90,7 @@ void softwareTimerFunction(SequenceAsserter& sequenceAsserter, uint32_t& counter
 
 bool SoftwareTimerPeriodicTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 
 	{
 		SequenceAsserter sequenceAsserter;
@@ -127,7 +127,7 @@ bool SoftwareTimerPeriodicTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after test
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after test
 		return false;
 
 	return true;
@@ -0,0 +1,128 @@
+/**
+ * \file
+ * \brief ThreadCpuBudgetTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadCpuBudgetTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+#include "getHeapUsage.hpp"
+
+#include "distortos/CpuBudget.hpp"
+#include "distortos/DynamicThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+namespace distortos
+{
+
+namespace test
+{
+
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// CPU budget used in test
+constexpr TickClock::duration budget {5};
+
+/// replenishment period used in test
+constexpr TickClock::duration period {20};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Runs in a loop until \a stop is set.
+ *
+ * \param [in] stop is a reference to variable which is set to stop the thread
+ */
+
+void thread(volatile bool& stop)
+{
+	while (stop == false);
+}
+
+}	// namespace
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadCpuBudgetTestCase::run_() const
+{
+#if CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+	const auto allocatedMemory = getHeapUsage();
+
+	{
+		const auto priority = ThisThread::getPriority();
+		const uint8_t testThreadPriority = priority + 1;
+		volatile bool stop {};
+		auto testThread = makeDynamicThread({testThreadStackSize, priority}, thread, std::ref(stop));
+
+		// synchronize with tick, so the first replenishment is not earlier than expected
+		ThisThread::sleepFor({});
+		CpuBudget cpuBudget {budget, period};
+		if (cpuBudget.isThrottled() != false || cpuBudget.getRemainingBudget() != budget)
+			return false;
+
+		// test thread inherits CPU budget of this thread, which is then removed from the budget, so it's not charged
+		ThisThread::setCpuBudget(&cpuBudget);
+		testThread.start();
+		ThisThread::setCpuBudget(nullptr);
+
+		// with higher priority test thread preempts this thread, which continues only after test thread is throttled
+		const auto start = TickClock::now();
+		testThread.setPriority(testThreadPriority);
+		const auto elapsed = TickClock::now() - start;
+		const auto throttled = elapsed == budget && cpuBudget.isThrottled() == true &&
+				cpuBudget.getRemainingBudget() == TickClock::duration{} && testThread.getEffectivePriority() == 0 &&
+				testThread.getPriority() == testThreadPriority;
+
+		stop = true;
+		testThread.join();
+
+		if (throttled == false)
+			return false;
+
+		// budget is replenished at the beginning of next period, as terminated test thread is not charged anymore
+		ThisThread::sleepFor(period);
+		if (cpuBudget.isThrottled() != false || cpuBudget.getRemainingBudget() != budget)
+			return false;
+	}
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+#endif	// CONFIG_SCHEDULER_CPU_BUDGET_ENABLE == 1
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief ThreadCpuBudgetTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADCPUBUDGETTESTCASE_HPP_
+#define TEST_THREAD_THREADCPUBUDGETTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests CPU budgets of threads.
+ *
+ * Starts a thread with higher priority, which inherits CPU budget of main thread and runs in a loop. Makes sure that
+ * the thread is throttled after it exhausts its budget - so main thread can run again - and that the budget is
+ * replenished at the beginning of next period.
+ */
+
+class ThreadCpuBudgetTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADCPUBUDGETTESTCASE_HPP_
@@ -0,0 +1,202 @@
+/**
+ * \file
+ * \brief ThreadEarliestDeadlineFirstTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadEarliestDeadlineFirstTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+#include "getHeapUsage.hpp"
+#include "SequenceAsserter.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+#include <cerrno>
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+namespace distortos
+{
+
+namespace test
+{
+
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// priority of test thread
+constexpr uint8_t testThreadPriority {1};
+
+/// period used in tests of ThisThread::waitForNextPeriod()
+constexpr TickClock::duration period {10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Sets deadline (only if the thread uses earliest-deadline-first scheduling policy), sleeps until given time point and
+ * marks the sequence point in SequenceAsserter.
+ *
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] sequencePoint is the sequence point of this instance
+ * \param [in] wakeUpTimePoint is a reference to time point at which the thread is woken
+ * \param [in] relativeDeadline is the deadline of the thread, relative to \a wakeUpTimePoint
+ */
+
+void thread(SequenceAsserter& sequenceAsserter, const unsigned int sequencePoint,
+		const TickClock::time_point& wakeUpTimePoint, const TickClock::duration relativeDeadline)
+{
+	if (ThisThread::getSchedulingPolicy() == SchedulingPolicy::earliestDeadlineFirst)
+		ThisThread::setDeadline(wakeUpTimePoint + relativeDeadline);
+	ThisThread::sleepUntil(wakeUpTimePoint);
+	sequenceAsserter.sequencePoint(sequencePoint);
+}
+
+/**
+ * \brief Tests ordering of threads with earliest-deadline-first scheduling policy.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	constexpr auto edf = SchedulingPolicy::earliestDeadlineFirst;
+
+	SequenceAsserter sequenceAsserter;
+	TickClock::time_point wakeUpTimePoint;
+
+	// thread with FIFO policy is executed after all threads with earliest-deadline-first policy, even though it is
+	// woken first; threads with equal deadlines are executed in the order in which they are woken
+	std::array<DynamicThread, 6> threads
+	{{
+			makeDynamicThread({testThreadStackSize, testThreadPriority, SchedulingPolicy::fifo}, thread,
+					std::ref(sequenceAsserter), 5, std::cref(wakeUpTimePoint), period),
+			makeDynamicThread({testThreadStackSize, testThreadPriority, edf}, thread, std::ref(sequenceAsserter), 3,
+					std::cref(wakeUpTimePoint), period + TickClock::duration{3}),
+			makeDynamicThread({testThreadStackSize, testThreadPriority, edf}, thread, std::ref(sequenceAsserter), 0,
+					std::cref(wakeUpTimePoint), period),
+			makeDynamicThread({testThreadStackSize, testThreadPriority, edf}, thread, std::ref(sequenceAsserter), 4,
+					std::cref(wakeUpTimePoint), period + TickClock::duration{4}),
+			makeDynamicThread({testThreadStackSize, testThreadPriority, edf}, thread, std::ref(sequenceAsserter), 1,
+					std::cref(wakeUpTimePoint), period + TickClock::duration{1}),
+			makeDynamicThread({testThreadStackSize, testThreadPriority, edf}, thread, std::ref(sequenceAsserter), 2,
+					std::cref(wakeUpTimePoint), period + TickClock::duration{1}),
+	}};
+
+	// test threads have lower priority, so they will not be executed before this thread blocks in join()
+	for (auto& thread : threads)
+		thread.start();
+
+	wakeUpTimePoint = TickClock::now() + TickClock::duration{2};
+
+	for (auto& thread : threads)
+		thread.join();
+
+	if (TickClock::now() != wakeUpTimePoint)
+		return false;
+
+	return sequenceAsserter.assertSequence(threads.size());
+}
+
+/**
+ * \brief Tests ThisThread::waitForNextPeriod() and counting of missed deadlines.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	// functions related to deadlines fail for thread which doesn't use earliest-deadline-first scheduling policy
+	if (ThisThread::setDeadline(TickClock::now()) != EINVAL || ThisThread::waitForNextPeriod(period) != EINVAL)
+		return false;
+
+	const auto schedulingPolicy = ThisThread::getSchedulingPolicy();
+	ThisThread::setSchedulingPolicy(SchedulingPolicy::earliestDeadlineFirst);
+
+	const auto ret = []()
+			{
+				if (ThisThread::getDeadline() != TickClock::time_point::max())
+					return false;
+
+				// first period starts immediately if deadline was not set
+				ThisThread::sleepFor({});
+				const auto start = TickClock::now();
+				if (ThisThread::waitForNextPeriod(period) != 0 || TickClock::now() != start ||
+						ThisThread::getDeadline() != start + period)
+					return false;
+
+				// next period starts at the deadline of the previous one
+				if (ThisThread::waitForNextPeriod(period) != 0 || TickClock::now() != start + period ||
+						ThisThread::getDeadline() != start + period * 2 || ThisThread::getDeadlineMissCount() != 0)
+					return false;
+
+				// deadline is missed, so next period starts immediately
+				const auto lateEnd = start + period * 2 + TickClock::duration{1};
+				ThisThread::sleepUntil(lateEnd);
+				if (ThisThread::waitForNextPeriod(period) != 0 || TickClock::now() != lateEnd ||
+						ThisThread::getDeadline() != start + period * 3 || ThisThread::getDeadlineMissCount() != 1 ||
+						ThisThread::get().getDeadlineMissCount() != 1)
+					return false;
+
+				return ThisThread::setDeadline(start) == 0 && ThisThread::getDeadline() == start;
+			}();
+
+	ThisThread::setSchedulingPolicy(schedulingPolicy);
+
+	// deadline is reset when scheduling policy is changed
+	return ret == true && ThisThread::getDeadline() == TickClock::time_point::max();
+}
+
+}	// namespace
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadEarliestDeadlineFirstTestCase::run_() const
+{
+#if CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	const auto allocatedMemory = getHeapUsage();
+
+	if (phase1() == false)
+		return false;
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	if (phase2() == false)
+		return false;
+
+#endif	// CONFIG_SCHEDULER_EARLIEST_DEADLINE_FIRST_ENABLE == 1
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
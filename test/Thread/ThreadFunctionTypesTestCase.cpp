@@ -11,9 +11,9 @@
 
 #include "ThreadFunctionTypesTestCase.hpp"
 
-#include "distortos/DynamicThread.hpp"
+#include "getHeapUsage.hpp"
 
-#include <malloc.h>
+#include "distortos/DynamicThread.hpp"
 
 namespace distortos
 {
@@ -119,7 +119,7 @@ private:
 
 bool ThreadFunctionTypesTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 
 	// thread with regular function
 	{
@@ -134,7 +134,7 @@ bool ThreadFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// thread with state-less functor
@@ -150,7 +150,7 @@ bool ThreadFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// thread with member function of object with state
@@ -166,7 +166,7 @@ bool ThreadFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// thread with capturing lambda
@@ -185,7 +185,7 @@ bool ThreadFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	return true;
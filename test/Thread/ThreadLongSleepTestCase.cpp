@@ -0,0 +1,161 @@
+/**
+ * \file
+ * \brief ThreadLongSleepTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadLongSleepTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+#include <functional>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// duration of long sleep - much longer than the longest period of "tick" interrupt suppression in tickless idle
+constexpr auto longDuration = std::chrono::duration_cast<TickClock::duration>(std::chrono::seconds{1});
+
+/// durations after which software timers expire, all shorter than longDuration
+constexpr TickClock::duration timerDurations[]
+{
+		TickClock::duration{1},
+		TickClock::duration{2},
+		longDuration / 3,
+		longDuration / 2 + TickClock::duration{1},
+		longDuration - TickClock::duration{1},
+};
+
+/// number of software timers
+constexpr size_t totalTimers {sizeof(timerDurations) / sizeof(*timerDurations)};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of software timers used in test
+using SoftwareTimer =
+		StaticSoftwareTimer<void(&)(TickClock::time_point&), std::reference_wrapper<TickClock::time_point>>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Software timer's function
+ *
+ * \param [out] timePoint is a reference to variable for storing time point of execution
+ */
+
+void storeTimePoint(TickClock::time_point& timePoint)
+{
+	timePoint = TickClock::now();
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether long sleepFor() and sleepUntil() wake the thread up exactly at expected time point.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	{
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = ThisThread::sleepFor(longDuration);
+		// sleepFor() always sleeps one tick longer
+		if (ret != 0 || TickClock::now() - start != longDuration + TickClock::duration{1})
+			return false;
+	}
+
+	{
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + longDuration;
+		const auto ret = ThisThread::sleepUntil(requestedTimePoint);
+		if (ret != 0 || TickClock::now() != requestedTimePoint)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether software timers which expire during long sleep are executed exactly at expected time points.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	std::array<TickClock::time_point, totalTimers> timePoints {{}};
+	std::array<SoftwareTimer, totalTimers> softwareTimers
+	{{
+			{storeTimePoint, std::ref(timePoints[0])},
+			{storeTimePoint, std::ref(timePoints[1])},
+			{storeTimePoint, std::ref(timePoints[2])},
+			{storeTimePoint, std::ref(timePoints[3])},
+			{storeTimePoint, std::ref(timePoints[4])},
+	}};
+
+	waitForNextTick();
+	const auto start = TickClock::now();
+	for (size_t i {}; i < totalTimers; ++i)
+		if (softwareTimers[i].start(start + timerDurations[i]) != 0)
+			return false;
+
+	const auto ret = ThisThread::sleepUntil(start + longDuration);
+	if (ret != 0 || TickClock::now() != start + longDuration)
+		return false;
+
+	for (size_t i {}; i < totalTimers; ++i)
+		if (softwareTimers[i].isRunning() != false || timePoints[i] != start + timerDurations[i])
+			return false;
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadLongSleepTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief ThreadLongSleepTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADLONGSLEEPTESTCASE_HPP_
+#define TEST_THREAD_THREADLONGSLEEPTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests long sleeps of the only runnable thread.
+ *
+ * Main test thread sleeps for up to a few seconds while software timers expire in the middle of the sleep, asserting
+ * that the tick count is exact when each timer's function is executed and when the thread is woken up. With tickless
+ * idle enabled each of these sleeps spans several periods in which "tick" interrupt is suppressed.
+ */
+
+class ThreadLongSleepTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief ThreadLongSleepTestCase's constructor
+	 */
+
+	constexpr ThreadLongSleepTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADLONGSLEEPTESTCASE_HPP_
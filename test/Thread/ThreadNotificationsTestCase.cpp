@@ -0,0 +1,201 @@
+/**
+ * \file
+ * \brief ThreadNotificationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadNotificationsTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThisThread-Notifications.hpp"
+
+#include <cerrno>
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// result of take or wait - return code and notification value
+using Result = std::pair<int, uint32_t>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// duration used in tests of timeouts
+constexpr TickClock::duration waitDuration {11};
+
+/// all bits of notification value
+constexpr uint32_t allBits {UINT32_MAX};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests all notification actions and non-blocking take and wait functions.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	auto& thread = ThisThread::get();
+
+	if (ThisThread::Notifications::tryWait({}, allBits) != Result{EAGAIN, 0} ||
+			ThisThread::Notifications::tryTake() != Result{EAGAIN, 0})
+		return false;
+
+	// bits are set, only bits selected for clearing on exit are cleared
+	if (thread.notify(0b0101, NotificationAction::setBits) != 0 ||
+			thread.notify(0b0100, NotificationAction::setBits) != 0 ||
+			ThisThread::Notifications::tryWait({}, 0b0001) != Result{0, 0b0101} ||
+			ThisThread::Notifications::tryWait({}, allBits) != Result{EAGAIN, 0b0100})
+		return false;
+
+	// bits selected for clearing on entry are cleared only if notification is not pending
+	if (ThisThread::Notifications::tryWait(0b0100, allBits) != Result{EAGAIN, 0} ||
+			thread.notify(0b0011, NotificationAction::setBits) != 0 ||
+			ThisThread::Notifications::tryWait(0b0011, allBits) != Result{0, 0b0011})
+		return false;
+
+	// overwrite always succeeds, try-overwrite fails if notification is pending
+	if (thread.notify(5, NotificationAction::tryOverwrite) != 0 ||
+			thread.notify(6, NotificationAction::tryOverwrite) != EBUSY ||
+			thread.notify(7, NotificationAction::overwrite) != 0 ||
+			ThisThread::Notifications::tryWait({}, allBits) != Result{0, 7})
+		return false;
+
+	// notification value used as a counter is either decremented or cleared on exit
+	if (thread.notify(2, NotificationAction::increment) != 0 || thread.notify(2, NotificationAction::increment) != 0 ||
+			ThisThread::Notifications::tryTake(false) != Result{0, 4} ||
+			ThisThread::Notifications::tryTake(true) != Result{0, 3} ||
+			ThisThread::Notifications::tryTake() != Result{EAGAIN, 0})
+		return false;
+
+	if (thread.notify(allBits, NotificationAction::overwrite) != 0 ||
+			thread.notify(1, NotificationAction::increment) != EOVERFLOW ||
+			thread.notify({}, static_cast<NotificationAction>(UINT8_MAX)) != EINVAL)
+		return false;
+
+	return ThisThread::Notifications::tryTake() == Result{0, allBits};
+}
+
+/**
+ * \brief Tests unblocking of a thread with higher priority which takes or waits for notification.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Result results[2] {};
+	auto thread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(ThisThread::getPriority() + 1)},
+			[&results]()
+			{
+				results[0] = ThisThread::Notifications::take();
+				results[1] = ThisThread::Notifications::wait({}, allBits);
+			});
+
+	bool result {true};
+
+	// test thread preempts this thread before notify() returns
+	if (thread.getState() != ThreadState::waitingForNotification ||
+			thread.notify(3, NotificationAction::increment) != 0 ||
+			results[0] != Result{0, 3} || results[1] != Result{})
+		result = false;
+
+	if (thread.getState() != ThreadState::waitingForNotification ||
+			thread.notify(0b1000, NotificationAction::setBits) != 0 || results[1] != Result{0, 0b1000})
+		result = false;
+
+	thread.join();
+
+	return result;
+}
+
+/**
+ * \brief Tests timeouts of waits and notifying a thread from interrupt context.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	{
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = ThisThread::Notifications::tryTakeFor(waitDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != Result{ETIMEDOUT, 0} || realDuration != waitDuration + decltype(waitDuration){1})
+			return false;
+	}
+	{
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + waitDuration;
+		const auto ret = ThisThread::Notifications::tryWaitUntil(requestedTimePoint, {}, allBits);
+		if (ret != Result{ETIMEDOUT, 0} || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	auto& thread = ThisThread::get();
+	auto softwareTimer = makeStaticSoftwareTimer([&thread]()
+			{
+				thread.notify(0b0001, NotificationAction::setBits);
+			});
+
+	waitForNextTick();
+	softwareTimer.start(waitDuration);
+	const auto start = TickClock::now();
+	const auto ret = ThisThread::Notifications::tryWaitFor(waitDuration * 2, {}, allBits);
+	const auto realDuration = TickClock::now() - start;
+	return ret == Result{0, 0b0001} && realDuration == waitDuration + decltype(waitDuration){1};
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadNotificationsTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
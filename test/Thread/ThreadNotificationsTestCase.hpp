@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief ThreadNotificationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADNOTIFICATIONSTESTCASE_HPP_
+#define TEST_THREAD_THREADNOTIFICATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests direct-to-thread notifications.
+ *
+ * Tests all notification actions and non-blocking take and wait functions, then unblocking of a thread with higher
+ * priority which takes or waits for notification, timeouts of waits and notifying a thread from interrupt context.
+ */
+
+class ThreadNotificationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADNOTIFICATIONSTESTCASE_HPP_
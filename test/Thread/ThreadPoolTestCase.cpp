@@ -0,0 +1,145 @@
+/**
+ * \file
+ * \brief ThreadPoolTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadPoolTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+
+#include "distortos/StaticJob.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThreadPool.hpp"
+
+#include <array>
+#include <cerrno>
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for worker threads, bytes
+constexpr size_t workerThreadStackSize {512};
+
+/// number of worker threads
+constexpr size_t totalThreads {2};
+
+/// size of queue of jobs
+constexpr size_t queueSize {4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Job function with result.
+ *
+ * \param [in,out] sequence is a reference to sequence counter shared by all jobs
+ * \param [in] value is the value which will be multiplied
+ *
+ * \return \a value multiplied by 3 in lower 16 bits, value of \a sequence (before increment) in upper 16 bits
+ */
+
+uint32_t multiply(unsigned int& sequence, const uint32_t value)
+{
+	return value * 3 | sequence++ << 16;
+}
+
+/**
+ * \brief Job function without result.
+ *
+ * \param [in,out] sequence is a reference to sequence counter shared by all jobs
+ * \param [out] mark is a reference to variable to which value of \a sequence (before increment) will be written
+ */
+
+void setMark(unsigned int& sequence, unsigned int& mark)
+{
+	mark = sequence++;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadPoolTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	{
+		unsigned int sequence {};
+		unsigned int mark {UINT32_MAX};
+		std::array<decltype(makeStaticJob(multiply, std::ref(sequence), uint32_t{})), queueSize - 1> jobs
+		{{
+				makeStaticJob(multiply, std::ref(sequence), uint32_t{1}),
+				makeStaticJob(multiply, std::ref(sequence), uint32_t{2}),
+				makeStaticJob(multiply, std::ref(sequence), uint32_t{3}),
+		}};
+		auto voidJob = makeStaticJob(setMark, std::ref(sequence), std::ref(mark));
+
+		{
+			ThreadPool threadPool {totalThreads, queueSize, {workerThreadStackSize,
+					static_cast<uint8_t>(ThisThread::getPriority() - 1)}};
+			if (threadPool.getThreadsCount() != totalThreads)
+				return false;
+
+			// worker threads have lower priority, so they don't execute any job before this thread blocks
+			for (auto& job : jobs)
+				if (threadPool.submit(job) != 0)
+					return false;
+			if (threadPool.trySubmit(voidJob) != 0)
+				return false;
+
+			// queue of jobs is full
+			auto rejectedJob = makeStaticJob(multiply, std::ref(sequence), uint32_t{4});
+			if (threadPool.trySubmit(rejectedJob) != EAGAIN || sequence != 0)
+				return false;
+
+			for (const auto& job : jobs)
+				if (job.isReady() != false)
+					return false;
+			if (voidJob.isReady() != false)
+				return false;
+
+			for (size_t i {}; i < jobs.size(); ++i)
+				if (jobs[i].get() != ((i + 1) * 3 | i << 16))
+					return false;
+
+			voidJob.get();
+			if (mark != jobs.size() || voidJob.isReady() != true)
+				return false;
+
+			// completed job can be submitted again, its previous result is discarded
+			if (threadPool.submit(jobs[0]) != 0 || jobs[0].isReady() != false ||
+					jobs[0].tryWaitFor(TickClock::duration{10}) != 0 || jobs[0].get() != (3 | (jobs.size() + 1) << 16))
+				return false;
+		}
+
+		if (sequence != jobs.size() + 2)
+			return false;
+	}
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief ThreadPoolTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADPOOLTESTCASE_HPP_
+#define TEST_THREAD_THREADPOOLTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests ThreadPool.
+ *
+ * Submits jobs with and without result to thread pool with worker threads which have lower priority than the test
+ * thread, checking that the queue of jobs is bounded, that the results are not ready before the test thread blocks and
+ * that all jobs are executed in the order of submission with correct results.
+ */
+
+class ThreadPoolTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADPOOLTESTCASE_HPP_
@@ -11,14 +11,13 @@
 
 #include "ThreadPriorityTestCase.hpp"
 
+#include "getHeapUsage.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 
 #include "distortos/DynamicThread.hpp"
 #include "distortos/InterruptMaskingLock.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -76,7 +75,7 @@ DynamicThread makeTestThread(const ThreadParameters& threadParameters, SequenceA
 
 bool ThreadPriorityTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 
 	for (const auto& phase : priorityTestPhases)
 	{
@@ -109,7 +108,7 @@ bool ThreadPriorityTestCase::run_() const
 				return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
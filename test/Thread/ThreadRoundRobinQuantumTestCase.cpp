@@ -0,0 +1,197 @@
+/**
+ * \file
+ * \brief ThreadRoundRobinQuantumTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadRoundRobinQuantumTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+
+#include "distortos/internal/scheduler/RoundRobinQuantum.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+#include <cerrno>
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with time points at which test threads were switched in
+using TimePoints = std::array<TickClock::time_point, 6>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// priority of test thread
+constexpr uint8_t testThreadPriority {1};
+
+/// length of round-robin quantum of first test thread
+constexpr TickClock::duration shortQuantum {2};
+
+/// length of round-robin quantum of second test thread
+constexpr TickClock::duration longQuantum {6};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Runs until given time point and records each time point at which it was switched in after the other test thread.
+ *
+ * \param [in] lastIdentifier is a reference to shared identifier of test thread which was switched in last
+ * \param [in] identifier is the identifier of this instance
+ * \param [out] timePoints is a reference to array with time points at which test threads were switched in
+ * \param [in,out] count is a reference to number of time points written to \a timePoints
+ * \param [in] endTimePoint is the time point at which the thread ends its execution
+ */
+
+void thread(volatile unsigned int& lastIdentifier, const unsigned int identifier, TimePoints& timePoints,
+		size_t& count, const TickClock::time_point endTimePoint)
+{
+	while (TickClock::now() < endTimePoint)
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		if (lastIdentifier == identifier)
+			continue;
+
+		lastIdentifier = identifier;
+		if (count < timePoints.size())
+			timePoints[count++] = TickClock::now();
+	}
+}
+
+/**
+ * \brief Tests validation of round-robin quantum's length.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	const auto initial = internal::RoundRobinQuantum::getInitial();
+	if (ThisThread::getRoundRobinQuantum() != initial)
+		return false;
+
+	if (ThisThread::setRoundRobinQuantum(TickClock::duration{-1}) != EINVAL ||
+			ThisThread::setRoundRobinQuantum(TickClock::duration{UINT16_MAX + 1}) != EINVAL ||
+			ThisThread::getRoundRobinQuantum() != initial)
+		return false;
+
+	// lengths above 255 ticks are valid
+	if (ThisThread::setRoundRobinQuantum(TickClock::duration{UINT16_MAX}) != 0 ||
+			ThisThread::getRoundRobinQuantum() != TickClock::duration{UINT16_MAX})
+		return false;
+
+	// 0 restores default length
+	return ThisThread::setRoundRobinQuantum({}) == 0 && ThisThread::getRoundRobinQuantum() == initial;
+}
+
+/**
+ * \brief Tests preemption of threads with different lengths of round-robin quantum.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	volatile unsigned int lastIdentifier {};
+	TimePoints timePoints {};
+	size_t count {};
+	TickClock::time_point endTimePoint;
+
+	std::array<DynamicThread, 2> threads
+	{{
+			makeDynamicThread({testThreadStackSize, testThreadPriority, SchedulingPolicy::roundRobin, shortQuantum},
+					thread, std::ref(lastIdentifier), 1, std::ref(timePoints), std::ref(count),
+					std::cref(endTimePoint)),
+			makeDynamicThread({testThreadStackSize, testThreadPriority, SchedulingPolicy::roundRobin, longQuantum},
+					thread, std::ref(lastIdentifier), 2, std::ref(timePoints), std::ref(count),
+					std::cref(endTimePoint)),
+	}};
+
+	if (threads[0].getRoundRobinQuantum() != shortQuantum || threads[1].getRoundRobinQuantum() != longQuantum)
+		return false;
+
+	// start both threads at the beginning of a tick
+	ThisThread::sleepFor({});
+	TickClock::time_point start;
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		start = TickClock::now();
+		// test threads use the sum of both quanta 2 times, last switch to second thread is at start + 18 ticks
+		endTimePoint = start + (shortQuantum + longQuantum) * 2 + shortQuantum + TickClock::duration{1};
+
+		// test threads have lower priority, so they will not be executed before this thread blocks in join()
+		for (auto& thread : threads)
+			thread.start();
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	if (count != timePoints.size())
+		return false;
+
+	// first thread was switched in first, then the threads alternate after their quanta expire
+	for (size_t i {}; i < timePoints.size(); ++i)
+	{
+		const auto expected = start + (shortQuantum + longQuantum) * (i / 2) + (i % 2 != 0 ? shortQuantum :
+				TickClock::duration{});
+		if (timePoints[i] != expected)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadRoundRobinQuantumTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	if (phase1() == false)
+		return false;
+
+	if (phase2() == false)
+		return false;
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief ThreadRoundRobinQuantumTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADROUNDROBINQUANTUMTESTCASE_HPP_
+#define TEST_THREAD_THREADROUNDROBINQUANTUMTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests per-thread length of round-robin quantum.
+ *
+ * Checks validation of round-robin quantum's length, then starts two threads with the same priority and different
+ * lengths of round-robin quantum, making sure that they preempt each other after the number of ticks selected for each
+ * of them.
+ */
+
+class ThreadRoundRobinQuantumTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADROUNDROBINQUANTUMTESTCASE_HPP_
@@ -0,0 +1,244 @@
+/**
+ * \file
+ * \brief ThreadRunTimeStatisticsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadRunTimeStatisticsTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+#include "getHeapUsage.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThreadIdentifier.hpp"
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// snapshot of run times, in units of run time counter
+struct RunTimes
+{
+	/// run time of idle thread
+	uint64_t idle;
+
+	/// total run time of all threads
+	uint64_t total;
+
+	/// run time of busy test thread
+	uint64_t busy;
+
+	/// run time of sleeping test thread
+	uint64_t sleeping;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// priority of busy test thread
+constexpr uint8_t busyThreadPriority {1};
+
+/// duration of each test phase
+constexpr TickClock::duration phaseDuration {100};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Busy test thread
+ *
+ * Runs in a loop until \a stop is set.
+ *
+ * \param [in] stop is a reference to variable which is set to stop the thread
+ */
+
+void busyThread(volatile bool& stop)
+{
+	while (stop == false);
+}
+
+/**
+ * \brief Sleeping test thread
+ *
+ * \param [in] duration is the duration of sleep
+ */
+
+void sleepingThread(const TickClock::duration duration)
+{
+	ThisThread::sleepFor(duration);
+}
+
+/**
+ * \brief Takes consistent snapshot of run times.
+ *
+ * \param [in] busyTestThread is a reference to busy test thread
+ * \param [in] sleepingTestThread is a reference to sleeping test thread
+ *
+ * \return snapshot of run times
+ */
+
+RunTimes getRunTimes(const Thread& busyTestThread, const Thread& sleepingTestThread)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return {statistics::getIdleRunTime(), statistics::getTotalRunTime(), busyTestThread.getRunTime(),
+			sleepingTestThread.getRunTime()};
+}
+
+/**
+ * \param [in] part is the part of run time
+ * \param [in] whole is the whole run time
+ *
+ * \return true if \a part is at least 90 % of \a whole, false otherwise
+ */
+
+bool isMajority(const uint64_t part, const uint64_t whole)
+{
+	return part * 10 >= whole * 9;
+}
+
+/**
+ * \param [in] part is the part of run time
+ * \param [in] whole is the whole run time
+ *
+ * \return true if \a part is at most 10 % of \a whole, false otherwise
+ */
+
+bool isMinority(const uint64_t part, const uint64_t whole)
+{
+	return part * 10 <= whole;
+}
+
+/**
+ * \brief Tests whether getCpuLoad() is consistent with getIdleRunTime() and getTotalRunTime().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testCpuLoad()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	const auto idleRunTime = statistics::getIdleRunTime();
+	const auto totalRunTime = statistics::getTotalRunTime();
+	const auto cpuLoad = statistics::getCpuLoad();
+	if (totalRunTime == 0 || idleRunTime > totalRunTime || cpuLoad > 1000)
+		return false;
+
+	return cpuLoad == (totalRunTime - idleRunTime) * 1000 / totalRunTime;
+}
+
+}	// namespace
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadRunTimeStatisticsTestCase::run_() const
+{
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	const auto allocatedMemory = getHeapUsage();
+
+	if (testCpuLoad() == false)
+		return false;
+
+	{
+		volatile bool stop {};
+		auto busyTestThread = makeAndStartDynamicThread({testThreadStackSize, busyThreadPriority}, busyThread,
+				std::ref(stop));
+		// sleeping test thread has higher priority, so it blocks before the next statement is executed
+		auto sleepingTestThread = makeAndStartDynamicThread({testThreadStackSize,
+				static_cast<uint8_t>(ThisThread::getPriority() + 1)}, sleepingThread, phaseDuration);
+
+		size_t threads {};
+		bool busyTestThreadFound {};
+		bool sleepingTestThreadFound {};
+		uint64_t runTimeSum {};
+		uint64_t totalRunTime {};
+		{
+			const InterruptMaskingLock interruptMaskingLock;
+			statistics::forEachThread([&](const Thread& thread)
+					{
+						++threads;
+						busyTestThreadFound |= thread.getIdentifier() == busyTestThread.getIdentifier();
+						sleepingTestThreadFound |= thread.getIdentifier() == sleepingTestThread.getIdentifier();
+						runTimeSum += thread.getRunTime();
+					});
+			totalRunTime = statistics::getTotalRunTime();
+		}
+
+		// while this thread and sleeping test thread are blocked, busy test thread uses almost all run time
+		const auto before = getRunTimes(busyTestThread, sleepingTestThread);
+		ThisThread::sleepFor(phaseDuration);
+		const auto after = getRunTimes(busyTestThread, sleepingTestThread);
+
+		stop = true;
+		busyTestThread.join();
+		sleepingTestThread.join();
+
+		// main, idle and both test threads are visited, run time of terminated threads is not included in the sum
+		if (threads < 4 || busyTestThreadFound == false || sleepingTestThreadFound == false ||
+				runTimeSum > totalRunTime)
+			return false;
+
+		const auto total = after.total - before.total;
+		if (total == 0 || isMajority(after.busy - before.busy, total) == false ||
+				isMinority(after.sleeping - before.sleeping, total) == false ||
+				isMinority(after.idle - before.idle, total) == false)
+			return false;
+	}
+
+	{
+		// while all threads are blocked, idle thread uses almost all run time
+		const auto idleRunTime = statistics::getIdleRunTime();
+		const auto totalRunTime = statistics::getTotalRunTime();
+		ThisThread::sleepFor(phaseDuration);
+		const auto total = statistics::getTotalRunTime() - totalRunTime;
+		if (total == 0 || isMajority(statistics::getIdleRunTime() - idleRunTime, total) == false)
+			return false;
+	}
+
+	if (testCpuLoad() == false)
+		return false;
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
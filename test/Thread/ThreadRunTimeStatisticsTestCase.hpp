@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief ThreadRunTimeStatisticsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADRUNTIMESTATISTICSTESTCASE_HPP_
+#define TEST_THREAD_THREADRUNTIMESTATISTICSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests run time statistics of threads.
+ *
+ * Starts a busy thread with low priority and a thread which sleeps for the whole test phase. While this thread sleeps,
+ * the busy thread must get almost all run time and CPU load must be close to 100 %. While all threads sleep, idle
+ * thread must get almost all run time. Also checks that forEachThread() visits test threads and that getCpuLoad() is
+ * consistent with getIdleRunTime() and getTotalRunTime().
+ */
+
+class ThreadRunTimeStatisticsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADRUNTIMESTATISTICSTESTCASE_HPP_
@@ -11,6 +11,7 @@
 
 #include "ThreadSleepForTestCase.hpp"
 
+#include "getHeapUsage.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 #include "wasteTime.hpp"
@@ -19,8 +20,6 @@
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -101,7 +100,7 @@ DynamicThread makeTestThread(const uint8_t priority, const ThreadParameters& thr
 
 bool ThreadSleepForTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 
 	for (const auto& phase : priorityTestPhases)
 	{
@@ -166,7 +165,7 @@ bool ThreadSleepForTestCase::run_() const
 					return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
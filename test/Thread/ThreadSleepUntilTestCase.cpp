@@ -11,6 +11,7 @@
 
 #include "ThreadSleepUntilTestCase.hpp"
 
+#include "getHeapUsage.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 
@@ -18,8 +19,6 @@
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -95,7 +94,7 @@ DynamicThread makeTestThread(const TickClock::time_point now, const ThreadParame
 
 bool ThreadSleepUntilTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getHeapUsage();
 
 	for (const auto& phase : priorityTestPhases)
 	{
@@ -155,7 +154,7 @@ bool ThreadSleepUntilTestCase::run_() const
 					return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
@@ -8,10 +8,17 @@
 #
 
 target_sources(distortosTest.elf PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/ThreadCpuBudgetTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadEarliestDeadlineFirstTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadFunctionTypesTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadLongSleepTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadNotificationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadOperationsTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadPoolTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadPriorityChangeTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadPriorityTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadRoundRobinQuantumTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadRunTimeStatisticsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadSchedulingPolicyTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadSleepForTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadSleepUntilTestCase.cpp
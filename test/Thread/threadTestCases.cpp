@@ -2,7 +2,7 @@
  * \file
  * \brief threadTestCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,8 +16,15 @@
 #include "ThreadFunctionTypesTestCase.hpp"
 #include "ThreadSleepForTestCase.hpp"
 #include "ThreadSleepUntilTestCase.hpp"
+#include "ThreadLongSleepTestCase.hpp"
 #include "ThreadSchedulingPolicyTestCase.hpp"
 #include "ThreadPriorityChangeTestCase.hpp"
+#include "ThreadEarliestDeadlineFirstTestCase.hpp"
+#include "ThreadCpuBudgetTestCase.hpp"
+#include "ThreadRoundRobinQuantumTestCase.hpp"
+#include "ThreadPoolTestCase.hpp"
+#include "ThreadNotificationsTestCase.hpp"
+#include "ThreadRunTimeStatisticsTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -49,12 +56,33 @@ const ThreadSleepForTestCase sleepForTestCase;
 /// ThreadSleepUntilTestCase instance
 const ThreadSleepUntilTestCase sleepUntilTestCase;
 
+/// ThreadLongSleepTestCase instance
+const ThreadLongSleepTestCase longSleepTestCase;
+
 /// ThreadSchedulingPolicyTestCase instance
 const ThreadSchedulingPolicyTestCase schedulingPolicyTestCase;
 
 /// ThreadPriorityChangeTestCase instance
 const ThreadPriorityChangeTestCase priorityChangeTestCase;
 
+/// ThreadEarliestDeadlineFirstTestCase instance
+const ThreadEarliestDeadlineFirstTestCase earliestDeadlineFirstTestCase;
+
+/// ThreadCpuBudgetTestCase instance
+const ThreadCpuBudgetTestCase cpuBudgetTestCase;
+
+/// ThreadRoundRobinQuantumTestCase instance
+const ThreadRoundRobinQuantumTestCase roundRobinQuantumTestCase;
+
+/// ThreadPoolTestCase instance
+const ThreadPoolTestCase threadPoolTestCase;
+
+/// ThreadNotificationsTestCase instance
+const ThreadNotificationsTestCase notificationsTestCase;
+
+/// ThreadRunTimeStatisticsTestCase instance
+const ThreadRunTimeStatisticsTestCase runTimeStatisticsTestCase;
+
 /// array with references to TestCase objects related to threads
 const TestCaseGroup::Range::value_type threadTestCases_[]
 {
@@ -63,8 +91,15 @@ const TestCaseGroup::Range::value_type threadTestCases_[]
 		TestCaseGroup::Range::value_type{functionTypesTestCase},
 		TestCaseGroup::Range::value_type{sleepForTestCase},
 		TestCaseGroup::Range::value_type{sleepUntilTestCase},
+		TestCaseGroup::Range::value_type{longSleepTestCase},
 		TestCaseGroup::Range::value_type{schedulingPolicyTestCase},
 		TestCaseGroup::Range::value_type{priorityChangeTestCase},
+		TestCaseGroup::Range::value_type{earliestDeadlineFirstTestCase},
+		TestCaseGroup::Range::value_type{cpuBudgetTestCase},
+		TestCaseGroup::Range::value_type{roundRobinQuantumTestCase},
+		TestCaseGroup::Range::value_type{threadPoolTestCase},
+		TestCaseGroup::Range::value_type{notificationsTestCase},
+		TestCaseGroup::Range::value_type{runTimeStatisticsTestCase},
 };
 
 }	// namespace
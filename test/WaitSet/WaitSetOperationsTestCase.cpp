@@ -0,0 +1,247 @@
+/**
+ * \file
+ * \brief WaitSetOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "WaitSetOperationsTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticMessageQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/WaitSet.hpp"
+
+#include <cerrno>
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// result of wait - return code and number of ready objects
+using Result = std::pair<int, size_t>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// duration used in tests of timeouts
+constexpr TickClock::duration waitDuration {11};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks readiness of entries.
+ *
+ * \param [in] entries is a pointer to array with entries
+ * \param [in] readiness is the expected readiness of consecutive entries
+ *
+ * \return true if readiness of all entries matches \a readiness, false otherwise
+ */
+
+bool checkReadiness(const WaitSet::Entry* entries, const std::initializer_list<bool> readiness)
+{
+	for (const auto ready : readiness)
+		if ((entries++)->isReady() != ready)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests non-blocking waits for semaphores and queues.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	Semaphore semaphore {0};
+	StaticFifoQueue<uint8_t, 1> fifoQueue;
+	StaticMessageQueue<uint8_t, 1> messageQueue;
+	WaitSet::Entry entries[]
+	{
+			WaitSet::Entry{semaphore},
+			{fifoQueue, WaitSet::Event::readable},
+			{messageQueue, WaitSet::Event::readable},
+			{fifoQueue, WaitSet::Event::writable},
+	};
+	WaitSet waitSet {entries};
+
+	// only the queue which is not full is ready
+	if (waitSet.tryWait() != Result{0, 1} || checkReadiness(entries, {false, false, false, true}) == false)
+		return false;
+
+	if (semaphore.post() != 0 || fifoQueue.push(1) != 0 || messageQueue.push(0, 2) != 0)
+		return false;
+
+	// readiness is checked without modifying the objects
+	if (waitSet.tryWait() != Result{0, 3} || checkReadiness(entries, {true, true, true, false}) == false ||
+			waitSet.tryWait() != Result{0, 3} || semaphore.getValue() != 1)
+		return false;
+
+	uint8_t priority;
+	uint8_t value;
+	if (semaphore.tryWait() != 0 || fifoQueue.tryPop(value) != 0 || messageQueue.tryPop(priority, value) != 0)
+		return false;
+
+	// wait set without the entry for writable queue has no ready objects
+	WaitSet readableWaitSet {entries, 3};
+	return readableWaitSet.tryWait() == Result{EAGAIN, 0};
+}
+
+/**
+ * \brief Tests unblocking of a thread with higher priority which waits on a wait set.
+ *
+ * While the thread waits, objects waited for by it cannot be waited for by another wait set.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Semaphore semaphore {0};
+	StaticFifoQueue<uint8_t, 1> fifoQueue;
+	WaitSet::Entry entries[]
+	{
+			WaitSet::Entry{semaphore},
+			{fifoQueue, WaitSet::Event::readable},
+	};
+	WaitSet waitSet {entries};
+	Result results[2] {};
+	bool readiness[2] {};
+	auto thread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(ThisThread::getPriority() + 1)},
+			[&semaphore, &entries, &waitSet, &results, &readiness]()
+			{
+				results[0] = waitSet.wait();
+				readiness[0] = checkReadiness(entries, {true, false});
+				semaphore.tryWait();
+				results[1] = waitSet.wait();
+				readiness[1] = checkReadiness(entries, {false, true});
+			});
+
+	bool result {true};
+
+	{
+		Semaphore otherSemaphore {1};
+		WaitSet::Entry otherEntries[]
+		{
+				WaitSet::Entry{otherSemaphore},
+				WaitSet::Entry{semaphore},
+		};
+		WaitSet otherWaitSet {otherEntries};
+
+		// object which is waited for by the thread is rejected, other objects are not left registered
+		if (thread.getState() != ThreadState::blockedOnWaitSet || otherWaitSet.tryWait() != Result{EBUSY, 0} ||
+				WaitSet{otherEntries, 1}.tryWait() != Result{0, 1})
+			result = false;
+	}
+
+	// test thread preempts this thread before post() returns
+	if (semaphore.post() != 0 || results[0] != Result{0, 1} || readiness[0] != true ||
+			thread.getState() != ThreadState::blockedOnWaitSet)
+		result = false;
+
+	if (fifoQueue.push(3) != 0 || results[1] != Result{0, 1} || readiness[1] != true)
+		result = false;
+
+	thread.join();
+
+	return result;
+}
+
+/**
+ * \brief Tests timeouts of waits and making an object ready from interrupt context.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	StaticRawFifoQueue2<sizeof(uint8_t), 1> rawFifoQueue;
+	WaitSet::Entry entries[]
+	{
+			{rawFifoQueue, WaitSet::Event::readable},
+	};
+	WaitSet waitSet {entries};
+
+	{
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = waitSet.tryWaitFor(waitDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != Result{ETIMEDOUT, 0} || realDuration != waitDuration + decltype(waitDuration){1})
+			return false;
+	}
+	{
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + waitDuration;
+		const auto ret = waitSet.tryWaitUntil(requestedTimePoint);
+		if (ret != Result{ETIMEDOUT, 0} || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	auto softwareTimer = makeStaticSoftwareTimer([&rawFifoQueue]()
+			{
+				rawFifoQueue.tryPush(uint8_t{4});
+			});
+
+	waitForNextTick();
+	softwareTimer.start(waitDuration);
+	const auto start = TickClock::now();
+	const auto ret = waitSet.tryWaitFor(waitDuration * 2);
+	const auto realDuration = TickClock::now() - start;
+	uint8_t value {};
+	return ret == Result{0, 1} && realDuration == waitDuration + decltype(waitDuration){1} &&
+			rawFifoQueue.tryPop(value) == 0 && value == 4;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool WaitSetOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief WaitSetOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_WAITSET_WAITSETOPERATIONSTESTCASE_HPP_
+#define TEST_WAITSET_WAITSETOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various WaitSet operations.
+ *
+ * Tests non-blocking waits for semaphores and queues (readable and writable), unblocking a thread waiting on a wait set
+ * by posting a semaphore and by pushing to a queue, rejecting an object which is already waited for by another wait
+ * set, timeouts of waits and making an object ready from interrupt context.
+ */
+
+class WaitSetOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_WAITSET_WAITSETOPERATIONSTESTCASE_HPP_
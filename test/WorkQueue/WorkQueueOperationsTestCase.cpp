@@ -0,0 +1,213 @@
+/**
+ * \file
+ * \brief WorkQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "WorkQueueOperationsTestCase.hpp"
+
+#include "getHeapUsage.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/getSystemWorkQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/StaticWorkItem.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/WorkQueue.hpp"
+
+#include <array>
+#include <cerrno>
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with identifiers of executed work items
+using Identifiers = std::array<unsigned int, 4>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for worker thread, bytes
+constexpr size_t workerThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by work items.
+ *
+ * \param [out] identifiers is a reference to array with identifiers of executed work items
+ * \param [in,out] count is a reference to number of identifiers written to \a identifiers
+ * \param [in] identifier is the identifier of work item
+ */
+
+void workItemFunction(Identifiers& identifiers, size_t& count, const unsigned int identifier)
+{
+	if (count < identifiers.size())
+		identifiers[count] = identifier;
+	++count;
+}
+
+/**
+ * \brief Tests submitting, cancelling and executing work items in the order of submission.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	Identifiers identifiers {};
+	size_t count {};
+	WorkQueue workQueue;
+	std::array<decltype(makeStaticWorkItem(workItemFunction, std::ref(identifiers), std::ref(count), 0u)), 4>
+			workItems
+	{{
+			makeStaticWorkItem(workItemFunction, std::ref(identifiers), std::ref(count), 0u),
+			makeStaticWorkItem(workItemFunction, std::ref(identifiers), std::ref(count), 1u),
+			makeStaticWorkItem(workItemFunction, std::ref(identifiers), std::ref(count), 2u),
+			makeStaticWorkItem(workItemFunction, std::ref(identifiers), std::ref(count), 3u),
+	}};
+
+	if (workQueue.tryProcessOne() != EAGAIN || workQueue.cancel(workItems[0]) != EINVAL)
+		return false;
+
+	for (auto& workItem : workItems)
+		if (workQueue.submit(workItem) != 0 || workItem.isPending() != true)
+			return false;
+
+	// work item which is already pending cannot be submitted again
+	if (workQueue.submit(workItems[2]) != EBUSY || count != 0)
+		return false;
+
+	if (workQueue.cancel(workItems[1]) != 0 || workItems[1].isPending() != false ||
+			workQueue.cancel(workItems[1]) != EINVAL)
+		return false;
+
+	// work item can be submitted again after it was cancelled, it is added at the end of the queue
+	if (workQueue.submit(workItems[1]) != 0)
+		return false;
+
+	for (size_t i {}; i < workItems.size(); ++i)
+		if (workQueue.tryProcessOne() != 0 || count != i + 1)
+			return false;
+
+	if (workQueue.tryProcessOne() != EAGAIN)
+		return false;
+
+	for (const auto& workItem : workItems)
+		if (workItem.isPending() != false)
+			return false;
+
+	return identifiers == Identifiers{{0, 2, 3, 1}};
+}
+
+/**
+ * \brief Tests execution of work items by a worker thread with higher priority.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Identifiers identifiers {};
+	size_t count {};
+	WorkQueue workQueue;
+	auto workItem = makeStaticWorkItem(workItemFunction, std::ref(identifiers), std::ref(count), 1u);
+
+	auto workerThread = makeAndStartDynamicThread({workerThreadStackSize, static_cast<uint8_t>(ThisThread::getPriority()
+			+ 1)}, [&identifiers, &workQueue]()
+			{
+				for (size_t i {}; i < identifiers.size(); ++i)
+					workQueue.processOne();
+			});
+
+	// worker thread preempts this thread and executes the work item before submit() returns
+	for (size_t i {}; i < identifiers.size(); ++i)
+		if (workQueue.submit(workItem) != 0 || count != i + 1 || workItem.isPending() != false)
+			return false;
+
+	workerThread.join();
+
+	return identifiers == Identifiers{{1, 1, 1, 1}};
+}
+
+#ifdef CONFIG_SYSTEM_WORK_QUEUE_ENABLE
+
+/**
+ * \brief Tests deferring work from interrupt context to system work queue.
+ *
+ * \return true if the test phase succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	Identifiers identifiers {};
+	size_t count {};
+	Semaphore semaphore {0};
+	auto workItem = makeStaticWorkItem([&identifiers, &count, &semaphore]()
+			{
+				workItemFunction(identifiers, count, 1);
+				semaphore.post();
+			});
+	auto softwareTimer = makeStaticSoftwareTimer([&workItem]()
+			{
+				getSystemWorkQueue().submit(workItem);
+			});
+
+	softwareTimer.start(TickClock::duration{1});
+	if (semaphore.tryWaitFor(TickClock::duration{10}) != 0 || count != 1)
+		return false;
+
+	return workItem.isPending() == false;
+}
+
+#endif	// def CONFIG_SYSTEM_WORK_QUEUE_ENABLE
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool WorkQueueOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getHeapUsage();
+
+	if (phase1() == false)
+		return false;
+
+	if (phase2() == false)
+		return false;
+
+#ifdef CONFIG_SYSTEM_WORK_QUEUE_ENABLE
+
+	if (phase3() == false)
+		return false;
+
+#endif	// def CONFIG_SYSTEM_WORK_QUEUE_ENABLE
+
+	if (getHeapUsage() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
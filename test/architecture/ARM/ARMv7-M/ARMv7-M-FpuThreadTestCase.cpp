@@ -2,7 +2,7 @@
  * \file
  * \brief FpuThreadTestCase class implementation for ARMv7-M
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -22,6 +22,8 @@
 #include "distortos/statistics.hpp"
 #include "distortos/ThisThread.hpp"
 
+#include <array>
+
 #endif	// __FPU_PRESENT == 1 && __FPU_USED == 1
 
 namespace distortos
@@ -8,3 +8,4 @@
 #
 
 include(${CMAKE_CURRENT_LIST_DIR}/ARM/distortosTest.elf-sources.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/host/distortosTest.elf-sources.cmake)
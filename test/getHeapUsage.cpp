@@ -0,0 +1,45 @@
+/**
+ * \file
+ * \brief getHeapUsage() implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "getHeapUsage.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <malloc.h>
+
+namespace distortos
+{
+
+namespace test
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t getHeapUsage()
+{
+#ifdef CONFIG_ARCHITECTURE_HOST
+
+	// glibc deprecated mallinfo(), host architecture provides mallinfo2() which reports only blocks allocated with
+	// interposed functions
+	return mallinfo2().uordblks;
+
+#else	// !def CONFIG_ARCHITECTURE_HOST
+
+	return mallinfo().uordblks;
+
+#endif	// !def CONFIG_ARCHITECTURE_HOST
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief getHeapUsage() header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_GETHEAPUSAGE_HPP_
+#define TEST_GETHEAPUSAGE_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Gets total size of allocated blocks of dynamic memory.
+ *
+ * Returned value changes only when blocks are allocated or deallocated, so it can be used to detect memory leaks.
+ *
+ * \return total size of allocated blocks of dynamic memory, bytes
+ */
+
+size_t getHeapUsage();
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_GETHEAPUSAGE_HPP_
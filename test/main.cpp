@@ -2,7 +2,7 @@
  * \file
  * \brief Main code block.
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -24,6 +24,8 @@
 
 #include "distortos/ThisThread.hpp"
 
+#include <cstdlib>
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | global functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -35,7 +37,7 @@
  * - success - slow blinking, 1 Hz frequency,
  * - failure - fast blinking, 10 Hz frequency.
  * If the board doesn't provide LEDs, the result can be examined with the debugger by checking the value of "result"
- * variable.
+ * variable. On host the result is returned as exit status of the process.
  */
 
 int main()
@@ -50,6 +52,13 @@ int main()
 	// "volatile" to allow examination of the value with debugger - the variable will not be optimized out
 	const volatile auto result = distortos::test::testCases.run();
 
+#ifdef CONFIG_ARCHITECTURE_HOST
+
+	// on host the result is reported with exit status of the process
+	return result == true ? EXIT_SUCCESS : EXIT_FAILURE;
+
+#endif	// def CONFIG_ARCHITECTURE_HOST
+
 	// next line is a good place for a breakpoint that will be hit right after test cases
 	const auto duration = result == true ? std::chrono::milliseconds{500} : std::chrono::milliseconds{50};
 	while (1)
@@ -2,7 +2,7 @@
  * \file
  * \brief priorityTestPhases object declaration
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,9 @@
 
 #include <array>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace distortos
 {
 
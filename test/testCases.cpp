@@ -2,7 +2,7 @@
  * \file
  * \brief testCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -19,6 +19,11 @@
 #include "Queue/queueTestCases.hpp"
 #include "Signals/signalsTestCases.hpp"
 #include "CallOnce/callOnceTestCases.hpp"
+#include "WorkQueue/workQueueTestCases.hpp"
+#include "EventGroup/eventGroupTestCases.hpp"
+#include "SharedMutex/sharedMutexTestCases.hpp"
+#include "WaitSet/waitSetTestCases.hpp"
+#include "SerialPort/serialPortTestCases.hpp"
 #include "architecture/architectureTestCases.hpp"
 
 #include "TestCaseGroup.hpp"
@@ -47,6 +52,11 @@ const TestCaseGroup::Range::value_type testCases_[]
 		TestCaseGroup::Range::value_type{queueTestCases},
 		TestCaseGroup::Range::value_type{signalsTestCases},
 		TestCaseGroup::Range::value_type{callOnceTestCases},
+		TestCaseGroup::Range::value_type{workQueueTestCases},
+		TestCaseGroup::Range::value_type{eventGroupTestCases},
+		TestCaseGroup::Range::value_type{sharedMutexTestCases},
+		TestCaseGroup::Range::value_type{waitSetTestCases},
+		TestCaseGroup::Range::value_type{serialPortTestCases},
 		TestCaseGroup::Range::value_type{architectureTestCases},
 };
 
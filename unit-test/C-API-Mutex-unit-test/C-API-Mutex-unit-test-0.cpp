@@ -81,7 +81,8 @@ TEST_CASE("Testing DISTORTOS_MUTEX_INITIALIZER()", "[initializer]")
 					protocolAssociation.first, randomValue);
 			REQUIRE(mutex.typeProtocol == (typeAssociation.second << distortos_Mutex_typeShift |
 					protocolAssociation.second << distortos_Mutex_protocolShift));
-			REQUIRE(mutex.priorityCeiling == randomValue);
+			REQUIRE(mutex.boostedPriority == (protocolAssociation.second == distortos_Mutex_Protocol_priorityProtect ?
+					randomValue : 0));
 		}
 }
 
@@ -96,7 +97,8 @@ TEST_CASE("Testing DISTORTOS_MUTEX_CONSTRUCT_3()", "[construct]")
 					randomValue);
 			REQUIRE(mutex.typeProtocol == (typeAssociation.second << distortos_Mutex_typeShift |
 					protocolAssociation.second << distortos_Mutex_protocolShift));
-			REQUIRE(mutex.priorityCeiling == randomValue);
+			REQUIRE(mutex.boostedPriority == (protocolAssociation.second == distortos_Mutex_Protocol_priorityProtect ?
+					randomValue : 0));
 		}
 }
 
@@ -109,7 +111,8 @@ TEST_CASE("Testing DISTORTOS_MUTEX_CONSTRUCT_2PC()", "[construct]")
 		DISTORTOS_MUTEX_CONSTRUCT_2PC(mutex, protocolAssociation.first, randomValue);
 		REQUIRE(mutex.typeProtocol == (distortos_Mutex_Type_normal << distortos_Mutex_typeShift |
 				protocolAssociation.second << distortos_Mutex_protocolShift));
-		REQUIRE(mutex.priorityCeiling == randomValue);
+		REQUIRE(mutex.boostedPriority == (protocolAssociation.second == distortos_Mutex_Protocol_priorityProtect ?
+				randomValue : 0));
 	}
 }
 
@@ -121,7 +124,7 @@ TEST_CASE("Testing DISTORTOS_MUTEX_CONSTRUCT_2TP()", "[construct]")
 			DISTORTOS_MUTEX_CONSTRUCT_2TP(mutex, typeAssociation.first, protocolAssociation.first);
 			REQUIRE(mutex.typeProtocol == (typeAssociation.second << distortos_Mutex_typeShift |
 					protocolAssociation.second << distortos_Mutex_protocolShift));
-			REQUIRE(mutex.priorityCeiling == 0);
+			REQUIRE(mutex.boostedPriority == 0);
 		}
 }
 
@@ -132,7 +135,7 @@ TEST_CASE("Testing DISTORTOS_MUTEX_CONSTRUCT_1P()", "[construct]")
 		DISTORTOS_MUTEX_CONSTRUCT_1P(mutex, protocolAssociation.first);
 		REQUIRE(mutex.typeProtocol == (distortos_Mutex_Type_normal << distortos_Mutex_typeShift |
 				protocolAssociation.second << distortos_Mutex_protocolShift));
-		REQUIRE(mutex.priorityCeiling == 0);
+		REQUIRE(mutex.boostedPriority == 0);
 	}
 }
 
@@ -143,7 +146,7 @@ TEST_CASE("Testing DISTORTOS_MUTEX_CONSTRUCT_1T()", "[construct]")
 		DISTORTOS_MUTEX_CONSTRUCT_1T(mutex, typeAssociation.first);
 		REQUIRE(mutex.typeProtocol == (typeAssociation.second << distortos_Mutex_typeShift |
 				distortos_Mutex_Protocol_none << distortos_Mutex_protocolShift));
-		REQUIRE(mutex.priorityCeiling == 0);
+		REQUIRE(mutex.boostedPriority == 0);
 	}
 }
 
@@ -152,7 +155,7 @@ TEST_CASE("Testing DISTORTOS_MUTEX_CONSTRUCT()", "[construct]")
 	DISTORTOS_MUTEX_CONSTRUCT(mutex);
 	REQUIRE(mutex.typeProtocol == (distortos_Mutex_Type_normal << distortos_Mutex_typeShift |
 			distortos_Mutex_Protocol_none << distortos_Mutex_protocolShift));
-	REQUIRE(mutex.priorityCeiling == 0);
+	REQUIRE(mutex.boostedPriority == 0);
 }
 
 TEST_CASE("Testing distortos_Mutex_construct_3()", "[construct]")
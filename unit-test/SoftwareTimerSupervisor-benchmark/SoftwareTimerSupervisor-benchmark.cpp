@@ -0,0 +1,265 @@
+/**
+ * \file
+ * \brief SoftwareTimerSupervisor benchmark
+ *
+ * This test checks whether software timers are executed at proper time points and measures the time of starting,
+ * restarting, stopping and executing many concurrent software timers. It is built once for each implementation of
+ * SoftwareTimerSupervisor (sorted list and timer wheel), so the results can be compared.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
+
+#include "distortos/architecture/enableInterruptMasking.hpp"
+#include "distortos/architecture/restoreInterruptMasking.hpp"
+
+#include "distortos/SoftwareTimer.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using trompeloeil::_;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// TestSoftwareTimer class is a SoftwareTimer which records the time point of its last execution
+class TestSoftwareTimer : public distortos::SoftwareTimer
+{
+public:
+
+	/**
+	 * \brief TestSoftwareTimer's constructor
+	 *
+	 * \param [in] supervisor is a reference to SoftwareTimerSupervisor which manages this timer
+	 * \param [in] currentTimePoint is a reference to variable with current time point
+	 */
+
+	TestSoftwareTimer(distortos::internal::SoftwareTimerSupervisor& supervisor,
+			const distortos::TickClock::time_point& currentTimePoint) :
+					softwareTimerControlBlock_{softwareTimerRunner, *this},
+					supervisor_{supervisor},
+					currentTimePoint_{currentTimePoint},
+					runTimePoint_{}
+	{
+
+	}
+
+	/**
+	 * \return time point of last execution of the timer
+	 */
+
+	distortos::TickClock::time_point getRunTimePoint() const
+	{
+		return runTimePoint_;
+	}
+
+	bool isRunning() const override
+	{
+		return softwareTimerControlBlock_.isRunning();
+	}
+
+	int start(const distortos::TickClock::time_point timePoint, const distortos::TickClock::duration period = {})
+			override
+	{
+		softwareTimerControlBlock_.start(supervisor_, timePoint, period);
+		return 0;
+	}
+
+	int stop() override
+	{
+		softwareTimerControlBlock_.stop();
+		return 0;
+	}
+
+private:
+
+	void run() override
+	{
+		runTimePoint_ = currentTimePoint_;
+	}
+
+	/// internal SoftwareTimerControlBlock object
+	distortos::internal::SoftwareTimerControlBlock softwareTimerControlBlock_;
+
+	/// reference to SoftwareTimerSupervisor which manages this timer
+	distortos::internal::SoftwareTimerSupervisor& supervisor_;
+
+	/// reference to variable with current time point
+	const distortos::TickClock::time_point& currentTimePoint_;
+
+	/// time point of last execution of the timer
+	distortos::TickClock::time_point runTimePoint_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// name of tested implementation of SoftwareTimerSupervisor
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+constexpr char implementationName[] {"timer wheel"};
+#else	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+constexpr char implementationName[] {"sorted list"};
+#endif	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+/// number of concurrent software timers
+constexpr size_t timersCount {2000};
+
+/// max duration (in ticks) of software timer
+constexpr distortos::TickClock::rep maxDuration {5000};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Executes the operation and prints its average duration.
+ *
+ * \tparam Function is the type of function object with the operation
+ *
+ * \param [in] name is the name of the operation
+ * \param [in] count is the number of elementary operations done by \a function
+ * \param [in] function is the function object with the operation
+ */
+
+template<typename Function>
+void measure(const char* const name, const size_t count, Function function)
+{
+	const auto start = std::chrono::steady_clock::now();
+	function();
+	const auto end = std::chrono::steady_clock::now();
+	const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+	std::cout << implementationName << ", " << name << ": " << nanoseconds / count << " ns per operation" <<
+			std::endl;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| tests
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Benchmarking start, restart, stop and execution of many concurrent software timers",
+		"[benchmark]")
+{
+	const distortos::architecture::EnableInterruptMaskingMock enableInterruptMaskingMock;
+	const distortos::architecture::RestoreInterruptMaskingMock restoreInterruptMaskingMock;
+	ALLOW_CALL(enableInterruptMaskingMock, enableInterruptMasking()).RETURN(0);
+	ALLOW_CALL(restoreInterruptMaskingMock, restoreInterruptMasking(_));
+
+	distortos::internal::SoftwareTimerSupervisor supervisor;
+	distortos::TickClock::time_point currentTimePoint {};
+	std::vector<std::unique_ptr<TestSoftwareTimer>> timers;
+	for (size_t i {}; i < timersCount; ++i)
+		timers.emplace_back(new TestSoftwareTimer{supervisor, currentTimePoint});
+
+	std::mt19937 randomGenerator {};
+	std::uniform_int_distribution<distortos::TickClock::rep> distribution {1, maxDuration};
+	std::vector<distortos::TickClock::time_point> timePoints;
+	for (size_t i {}; i < timersCount; ++i)
+		timePoints.emplace_back(distortos::TickClock::duration{distribution(randomGenerator)});
+
+	measure("start", timersCount, [&timers, &timePoints]()
+			{
+				for (size_t i {}; i < timersCount; ++i)
+					timers[i]->start(timePoints[timePoints.size() - 1 - i]);
+			});
+	measure("restart", timersCount, [&timers, &timePoints]()
+			{
+				for (size_t i {}; i < timersCount; ++i)
+					timers[i]->start(timePoints[i]);
+			});
+	measure("tick", maxDuration, [&supervisor, &currentTimePoint]()
+			{
+				for (distortos::TickClock::rep i {1}; i <= maxDuration; ++i)
+				{
+					currentTimePoint = distortos::TickClock::time_point{distortos::TickClock::duration{i}};
+					supervisor.tickInterruptHandler(currentTimePoint);
+				}
+			});
+
+	for (size_t i {}; i < timersCount; ++i)
+	{
+		REQUIRE(timers[i]->isRunning() == false);
+		REQUIRE(timers[i]->getRunTimePoint() == timePoints[i]);
+	}
+
+	currentTimePoint = {};
+	for (size_t i {}; i < timersCount; ++i)
+		timers[i]->start(currentTimePoint + distortos::TickClock::duration{maxDuration * 2 + i});
+
+	measure("stop", timersCount, [&timers]()
+			{
+				for (size_t i {}; i < timersCount; ++i)
+					timers[i]->stop();
+			});
+
+	for (size_t i {}; i < timersCount; ++i)
+		REQUIRE(timers[i]->isRunning() == false);
+}
+
+TEST_CASE("Testing execution of software timers when ticks are skipped up to next time point", "[next]")
+{
+	const distortos::architecture::EnableInterruptMaskingMock enableInterruptMaskingMock;
+	const distortos::architecture::RestoreInterruptMaskingMock restoreInterruptMaskingMock;
+	ALLOW_CALL(enableInterruptMaskingMock, enableInterruptMasking()).RETURN(0);
+	ALLOW_CALL(restoreInterruptMaskingMock, restoreInterruptMasking(_));
+
+	distortos::internal::SoftwareTimerSupervisor supervisor;
+	distortos::TickClock::time_point currentTimePoint {};
+	REQUIRE(supervisor.getNextTimePoint() == distortos::TickClock::time_point::max());
+
+	std::vector<std::unique_ptr<TestSoftwareTimer>> timers;
+	for (size_t i {}; i < timersCount; ++i)
+		timers.emplace_back(new TestSoftwareTimer{supervisor, currentTimePoint});
+
+	std::mt19937 randomGenerator {};
+	std::uniform_int_distribution<distortos::TickClock::rep> distribution {1, maxDuration};
+	std::vector<distortos::TickClock::time_point> timePoints;
+	for (size_t i {}; i < timersCount; ++i)
+	{
+		// sparse time points, so that most ticks are skipped
+		timePoints.emplace_back(distortos::TickClock::duration{distribution(randomGenerator) * 16});
+		timers[i]->start(timePoints[i]);
+	}
+
+	// stopped software timers leave their buckets marked, which may only make the next time point earlier
+	for (size_t i {}; i < timersCount; i += 3)
+		timers[i]->stop();
+
+	const auto earliestTimePoint = *std::min_element(timePoints.begin(), timePoints.end());
+	REQUIRE(supervisor.getNextTimePoint() > currentTimePoint);
+	REQUIRE(supervisor.getNextTimePoint() <= earliestTimePoint);
+
+	size_t ticks {};
+	for (auto nextTimePoint = supervisor.getNextTimePoint(); nextTimePoint != distortos::TickClock::time_point::max();
+			nextTimePoint = supervisor.getNextTimePoint())
+	{
+		REQUIRE(nextTimePoint > currentTimePoint);
+		currentTimePoint = nextTimePoint;
+		supervisor.tickInterruptHandler(currentTimePoint);
+		++ticks;
+	}
+
+	INFO("handled ticks: " << ticks);
+	REQUIRE(ticks < static_cast<size_t>(maxDuration * 16));
+	for (size_t i {}; i < timersCount; ++i)
+	{
+		REQUIRE(timers[i]->isRunning() == false);
+		REQUIRE(timers[i]->getRunTimePoint() == (i % 3 == 0 ? distortos::TickClock::time_point{} : timePoints[i]));
+	}
+}
@@ -0,0 +1,127 @@
+/**
+ * \file
+ * \brief SpscRingQueue benchmark
+ *
+ * This test transfers a long sequence of values from producer thread to consumer thread via SpscRingQueue, checks
+ * whether all values are received in correct order and measures the throughput of single-element and bulk transfers.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/StaticSpscRingQueue.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <thread>
+
+using trompeloeil::_;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of element transferred via queue
+using Element = uint32_t;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of elements transferred in each test
+constexpr Element elementsCount {1000000};
+
+/// size of tested queue, elements
+constexpr size_t queueSize {256};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Transfers \a elementsCount elements from producer thread to consumer thread and prints the throughput.
+ *
+ * Both sides never block - they yield and retry until the queue is not full / not empty.
+ *
+ * \param [in] name is the name of the test
+ * \param [in] chunkSize is the maximum number of elements transferred with one call
+ *
+ * \return number of elements which were received out of order
+ */
+
+size_t transfer(const char* const name, const size_t chunkSize)
+{
+	distortos::StaticSpscRingQueue<Element, queueSize> queue;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	std::thread producer {[&queue, chunkSize]()
+			{
+				std::vector<Element> buffer(chunkSize);
+				Element value {};
+				while (value < elementsCount)
+				{
+					const auto count = std::min<size_t>(chunkSize, elementsCount - value);
+					for (size_t i {}; i < count; ++i)
+						buffer[i] = value + i;
+					size_t pushed {};
+					while (pushed < count)
+					{
+						const auto ret = chunkSize == 1 ? queue.tryPush(buffer[0]) == 0 :
+								queue.tryPushN(buffer.data() + pushed, count - pushed);
+						if (ret == 0)
+							std::this_thread::yield();
+						pushed += ret;
+					}
+					value += count;
+				}
+			}};
+
+	size_t errors {};
+	std::vector<Element> buffer(chunkSize);
+	Element expectedValue {};
+	while (expectedValue < elementsCount)
+	{
+		const auto popped = chunkSize == 1 ? queue.tryPop(buffer[0]) == 0 : queue.tryPopN(buffer.data(), chunkSize);
+		if (popped == 0)
+			std::this_thread::yield();
+		for (size_t i {}; i < popped; ++i)
+			if (buffer[i] != expectedValue++)
+				++errors;
+	}
+
+	producer.join();
+
+	const auto end = std::chrono::steady_clock::now();
+	const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+	std::cout << name << ": " << static_cast<double>(nanoseconds) / elementsCount << " ns per element, " <<
+			elementsCount * 1000.0 / nanoseconds << " M elements per second" << std::endl;
+
+	return errors;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| tests
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Benchmarking throughput of SpscRingQueue with concurrent producer and consumer", "[benchmark]")
+{
+	distortos::Semaphore semaphoreMock;
+	distortos::Semaphore::getProxyInstance() = &semaphoreMock;
+	ALLOW_CALL(semaphoreMock, construct(0u, 1u));
+
+	REQUIRE(transfer("single element", 1) == 0);
+	REQUIRE(transfer("chunks of 16 elements", 16) == 0);
+	REQUIRE(transfer("chunks of 64 elements", 64) == 0);
+
+	distortos::Semaphore::getProxyInstance() = nullptr;
+}
@@ -14,6 +14,9 @@
 
 #include "unit-test-common.hpp"
 
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
 #include "distortos/MutexProtocol.hpp"
 #include "distortos/MutexType.hpp"
 #include "distortos/TickClock.hpp"
@@ -32,11 +35,17 @@ public:
 
 	constexpr static uint8_t typeShift {0};
 	constexpr static uint8_t protocolShift {typeShift + CHAR_BIT / 2};
+
+	virtual ~MutexControlBlock() = default;
+
+	MAKE_CONST_MOCK0(getOwner, ThreadControlBlock*());
+	MAKE_MOCK1(requeue, bool(ThreadList::iterator));
+	MAKE_MOCK2(unblockHook, void(ThreadControlBlock&, UnblockReason));
 };
 
 }	// namespace internal
 
-class Mutex
+class Mutex : public internal::MutexControlBlock
 {
 public:
 
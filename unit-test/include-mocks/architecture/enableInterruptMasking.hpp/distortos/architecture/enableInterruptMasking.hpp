@@ -55,7 +55,7 @@ private:
 	}
 };
 
-InterruptMask enableInterruptMasking()
+inline InterruptMask enableInterruptMasking()
 {
 	return EnableInterruptMaskingMock::getInstance().enableInterruptMasking();
 }
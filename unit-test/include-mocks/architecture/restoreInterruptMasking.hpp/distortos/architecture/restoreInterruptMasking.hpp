@@ -55,7 +55,7 @@ private:
 	}
 };
 
-void restoreInterruptMasking(const InterruptMask interruptMask)
+inline void restoreInterruptMasking(const InterruptMask interruptMask)
 {
 	RestoreInterruptMaskingMock::getInstance().restoreInterruptMasking(interruptMask);
 }
@@ -31,8 +31,12 @@ class ThreadControlBlock : public ThreadListNode
 {
 public:
 
+	MAKE_CONST_MOCK0(getConditionVariableMutexControlBlock, MutexControlBlock*());
 	MAKE_MOCK0(getOwnedProtocolMutexList, MutexList&());
+	MAKE_CONST_MOCK0(getSemaphoreRequestedValue, unsigned int());
+	MAKE_MOCK1(setConditionVariableMutexControlBlock, void(MutexControlBlock*));
 	MAKE_MOCK1(setPriorityInheritanceMutexControlBlock, void(const MutexControlBlock*));
+	MAKE_MOCK1(setSemaphoreRequestedValue, void(unsigned int));
 	MAKE_MOCK0(updateBoostedPriority, void());
 	MAKE_MOCK1(updateBoostedPriority, void(uint8_t));
 };
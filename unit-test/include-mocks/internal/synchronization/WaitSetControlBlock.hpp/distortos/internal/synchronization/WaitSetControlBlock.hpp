@@ -0,0 +1,34 @@
+/**
+ * \file
+ * \brief Mock of WaitSetControlBlock class
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SYNCHRONIZATION_WAITSETCONTROLBLOCK_HPP_DISTORTOS_INTERNAL_SYNCHRONIZATION_WAITSETCONTROLBLOCK_HPP_
+#define UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SYNCHRONIZATION_WAITSETCONTROLBLOCK_HPP_DISTORTOS_INTERNAL_SYNCHRONIZATION_WAITSETCONTROLBLOCK_HPP_
+
+#include "unit-test-common.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class WaitSetControlBlock
+{
+public:
+
+	MAKE_MOCK0(notify, void());
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SYNCHRONIZATION_WAITSETCONTROLBLOCK_HPP_DISTORTOS_INTERNAL_SYNCHRONIZATION_WAITSETCONTROLBLOCK_HPP_